@@ -0,0 +1,89 @@
+#include "BenchmarkCommon.h"
+
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Util/LockFreeRingBuffer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Benchmarks;
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    constexpr size_t g_kRingBufferCapacity = 16384; ///< Matches the application ring buffer.
+
+    /**
+     * @brief Measures a full engine pass: producer write, ring read and all three analyzers.
+     *
+     * Arguments: block size in frames, sample rate in Hz, SignalType.
+     */
+    void BM_EnginePass(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<uint32_t>(state.range(0));
+        const auto sampleRate = static_cast<float>(state.range(1));
+        const auto signalType = static_cast<SignalType>(state.range(2));
+
+        const auto signal = GenerateSignal(signalType, sampleRate);
+        HopCursor cursor(signal, blockSize);
+
+        LockFreeRingBuffer<float> ringBuffer(g_kRingBufferCapacity);
+        AnalysisEngine engine(&ringBuffer, AnalysisConfig(sampleRate, blockSize));
+        engine.RegisterAnalyzer(std::make_shared<FretBuzzDetector>());
+        engine.RegisterAnalyzer(std::make_shared<IntonationAnalyzer>());
+        engine.RegisterAnalyzer(std::make_shared<StringHealthAnalyzer>());
+
+        for (auto _ : state)
+        {
+            ringBuffer.Write(cursor.Next());
+            benchmark::DoNotOptimize(engine.ProcessNextBlock());
+        }
+
+        state.SetLabel(GetSignalName(signalType));
+        ReportHopCounters(state, blockSize, sampleRate);
+    }
+
+    /**
+     * @brief Measures an offline engine pass: a backlog of hops written at once and processed in batches.
+     *
+     * Arguments: hops per batch (SetMaxBatchHops); 1 is the live path, one ProcessBuffer() per hop.
+     */
+    void BM_EngineBatchPass(benchmark::State &state)
+    {
+        constexpr uint32_t blockSize = 512;
+        const auto batchHops = static_cast<size_t>(state.range(0));
+
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, blockSize * batchHops);
+
+        LockFreeRingBuffer<float> ringBuffer(g_kRingBufferCapacity);
+        AnalysisEngine engine(&ringBuffer, AnalysisConfig(48000.0f, blockSize));
+        engine.RegisterAnalyzer(std::make_shared<FretBuzzDetector>());
+        engine.RegisterAnalyzer(std::make_shared<IntonationAnalyzer>());
+        engine.RegisterAnalyzer(std::make_shared<StringHealthAnalyzer>());
+        engine.SetMaxBatchHops(batchHops);
+
+        for (auto _ : state)
+        {
+            ringBuffer.Write(cursor.Next());
+            while (engine.ProcessNextBlock())
+            {
+            }
+        }
+
+        ReportHopCounters(state, blockSize * batchHops, 48000.0f);
+    }
+
+} // namespace
+
+BENCHMARK(BM_EnginePass)
+    ->ArgsProduct({ GetBlockSizes(), { 48000 }, GetSignalTypes() })
+    ->ArgNames({ "block", "rate", "signal" });
+
+BENCHMARK(BM_EngineBatchPass)->Arg(1)->Arg(8)->Arg(16)->ArgNames({ "hops" });
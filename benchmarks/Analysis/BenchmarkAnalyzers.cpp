@@ -0,0 +1,228 @@
+#include "BenchmarkCommon.h"
+
+#include "Analysis/ChannelFeatures.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/StaticPipeline.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Benchmarks;
+
+namespace
+{
+
+    /**
+     * @brief Measures one ProcessBuffer() call (one hop) of an analyzer.
+     *
+     * Arguments: block size in frames, sample rate in Hz, SignalType.
+     */
+    template<typename T> void BM_ProcessBuffer(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<uint32_t>(state.range(0));
+        const auto sampleRate = static_cast<float>(state.range(1));
+        const auto signalType = static_cast<SignalType>(state.range(2));
+
+        const auto signal = GenerateSignal(signalType, sampleRate);
+        HopCursor cursor(signal, blockSize);
+
+        T analyzer;
+        analyzer.Configure(AnalysisConfig(sampleRate, blockSize));
+
+        for (auto _ : state)
+        {
+            analyzer.ProcessBuffer(cursor.Next());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetLabel(GetSignalName(signalType));
+        ReportHopCounters(state, blockSize, sampleRate);
+    }
+
+    /**
+     * @brief Measures one ProcessBlocks() call over a batch of consecutive hops, as in offline runs.
+     *
+     * Compare items_per_second with BM_ProcessBuffer at the same block size; a batch of one hop
+     * goes through the same code with one extra call. Arguments: block size in frames, hops per call.
+     */
+    template<typename T> void BM_ProcessBlocks(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<uint32_t>(state.range(0));
+        const auto hops = static_cast<size_t>(state.range(1));
+
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, blockSize * hops);
+
+        T analyzer;
+        analyzer.Configure(AnalysisConfig(48000.0f, blockSize));
+
+        for (auto _ : state)
+        {
+            analyzer.ProcessBlocks(cursor.Next(), blockSize);
+            benchmark::ClobberMemory();
+        }
+
+        ReportHopCounters(state, blockSize * hops, 48000.0f);
+    }
+
+    /**
+     * @brief Measures Configure(), which runs on every stream (re)start.
+     */
+    template<typename T> void BM_Configure(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<uint32_t>(state.range(0));
+
+        T analyzer;
+        for (auto _ : state)
+        {
+            analyzer.Configure(AnalysisConfig(48000.0f, blockSize));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    /**
+     * @brief Measures one hop through all three analyzers held by value in a StaticPipeline.
+     *
+     * Arguments: block size in frames.
+     */
+    void BM_StaticPipeline(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<uint32_t>(state.range(0));
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, blockSize);
+
+        auto pipeline = std::make_unique<StaticPipeline<FretBuzzDetector, IntonationAnalyzer, StringHealthAnalyzer>>();
+        pipeline->Configure(AnalysisConfig(48000.0f, blockSize));
+
+        for (auto _ : state)
+        {
+            pipeline->ProcessBuffer(cursor.Next());
+            benchmark::ClobberMemory();
+        }
+
+        ReportHopCounters(state, blockSize, 48000.0f);
+    }
+
+    /**
+     * @brief Measures the same hop dispatched through Analyzer pointers, as AnalysisEngine does.
+     *
+     * Arguments: block size in frames.
+     */
+    void BM_DynamicAnalyzers(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<uint32_t>(state.range(0));
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, blockSize);
+
+        std::vector<std::shared_ptr<Analyzer>> analyzers = { std::make_shared<FretBuzzDetector>(),
+            std::make_shared<IntonationAnalyzer>(),
+            std::make_shared<StringHealthAnalyzer>() };
+        for (auto &analyzer : analyzers)
+        {
+            analyzer->Configure(AnalysisConfig(48000.0f, blockSize));
+        }
+
+        for (auto _ : state)
+        {
+            const auto hop = cursor.Next();
+            for (auto &analyzer : analyzers)
+            {
+                analyzer->ProcessBuffer(hop);
+            }
+            benchmark::ClobberMemory();
+        }
+
+        ReportHopCounters(state, blockSize, 48000.0f);
+    }
+
+    /**
+     * @brief Measures the per-hop features of several strings computed one channel at a time with the mono kernels.
+     *
+     * Arguments: channel count. Compare with BM_ChannelFeatureCache at the same count.
+     */
+    void BM_PerChannelFeatures(benchmark::State &state)
+    {
+        constexpr uint32_t blockSize = 512;
+        const auto channelCount = static_cast<size_t>(state.range(0));
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, blockSize);
+        const std::vector<float> previousSpectrum(blockSize / 2, 0.5f);
+        const std::vector<float> spectrum(blockSize / 2, 0.75f);
+        const KernelTable &kernels = KernelRegistry::GetKernels();
+
+        for (auto _ : state)
+        {
+            const auto hop = cursor.Next();
+            for (size_t channel = 0; channel < channelCount; ++channel)
+            {
+                benchmark::DoNotOptimize(kernels.sumOfSquares(hop));
+                benchmark::DoNotOptimize(kernels.peakAbsolute(hop));
+                benchmark::DoNotOptimize(kernels.countZeroCrossings(hop));
+                benchmark::DoNotOptimize(kernels.positiveDifferenceSum(spectrum, previousSpectrum));
+            }
+        }
+
+        ReportHopCounters(state, blockSize, 48000.0f);
+    }
+
+    /**
+     * @brief Measures the same features computed in lockstep by a ChannelFeatureCache, interleaving included.
+     *
+     * Arguments: channel count.
+     */
+    void BM_ChannelFeatureCache(benchmark::State &state)
+    {
+        constexpr uint32_t blockSize = 512;
+        const auto channelCount = static_cast<size_t>(state.range(0));
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, blockSize);
+        const std::vector<float> spectrum(blockSize / 2, 0.75f);
+
+        ChannelFeatureCache cache;
+        cache.Configure(channelCount, blockSize, blockSize / 2, 48000.0f, {});
+
+        for (auto _ : state)
+        {
+            const auto hop = cursor.Next();
+            for (size_t channel = 0; channel < channelCount; ++channel)
+            {
+                cache.SetChannelSamples(channel, hop);
+                cache.SetChannelSpectrum(channel, spectrum);
+            }
+            cache.Compute();
+            benchmark::DoNotOptimize(cache.GetFeatures(0).rms);
+        }
+
+        ReportHopCounters(state, blockSize, 48000.0f);
+    }
+
+    void ApplyHopArguments(benchmark::internal::Benchmark *benchmark)
+    {
+        benchmark->ArgsProduct({ GetBlockSizes(), GetSampleRates(), GetSignalTypes() });
+        benchmark->ArgNames({ "block", "rate", "signal" });
+    }
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ProcessBuffer, FretBuzzDetector)->Apply(ApplyHopArguments);
+BENCHMARK_TEMPLATE(BM_ProcessBuffer, IntonationAnalyzer)->Apply(ApplyHopArguments);
+BENCHMARK_TEMPLATE(BM_ProcessBuffer, StringHealthAnalyzer)->Apply(ApplyHopArguments);
+
+BENCHMARK_TEMPLATE(BM_ProcessBlocks, FretBuzzDetector)->ArgsProduct({ { 512 }, { 1, 8, 32 } });
+BENCHMARK_TEMPLATE(BM_ProcessBlocks, IntonationAnalyzer)->ArgsProduct({ { 512 }, { 1, 8, 32 } });
+BENCHMARK_TEMPLATE(BM_ProcessBlocks, StringHealthAnalyzer)->ArgsProduct({ { 512 }, { 1, 8, 32 } });
+
+BENCHMARK_TEMPLATE(BM_Configure, FretBuzzDetector)->Arg(512);
+BENCHMARK_TEMPLATE(BM_Configure, IntonationAnalyzer)->Arg(512);
+BENCHMARK_TEMPLATE(BM_Configure, StringHealthAnalyzer)->Arg(512);
+
+BENCHMARK(BM_StaticPipeline)->Arg(512)->Arg(2048);
+BENCHMARK(BM_DynamicAnalyzers)->Arg(512)->Arg(2048);
+
+BENCHMARK(BM_PerChannelFeatures)->Arg(1)->Arg(6)->Arg(8)->ArgNames({ "channels" });
+BENCHMARK(BM_ChannelFeatureCache)->Arg(1)->Arg(6)->Arg(8)->ArgNames({ "channels" });
@@ -0,0 +1,71 @@
+#include "BenchmarkCommon.h"
+
+#include "Analysis/FixedFFT.h"
+
+#include <FFTProcessor.h>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Benchmarks;
+
+namespace
+{
+
+    constexpr size_t g_kFftSize = 2048;
+
+    /**
+     * @brief Measures one 2048-point magnitude spectrum with the compile-time FixedFFT.
+     */
+    void BM_FixedFFT(benchmark::State &state)
+    {
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, g_kFftSize);
+
+        auto fft = std::make_unique<FixedFFT<g_kFftSize>>();
+        std::vector<float> magnitudes(FixedFFT<g_kFftSize>::g_kBinCount);
+
+        for (auto _ : state)
+        {
+            fft->ComputeMagnitudes(cursor.Next(), magnitudes);
+            benchmark::DoNotOptimize(magnitudes.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
+    /**
+     * @brief Measures the same spectrum with the runtime-sized GuitarDSP::FFTProcessor the analyzers use.
+     */
+    void BM_RuntimeFFT(benchmark::State &state)
+    {
+        const auto signal = GenerateSignal(SignalType::Pluck, 48000.0f);
+        HopCursor cursor(signal, g_kFftSize);
+
+        GuitarDSP::FFTProcessor fft(g_kFftSize, 48000.0f);
+
+        for (auto _ : state)
+        {
+            fft.ComputeSpectrum(cursor.Next());
+            benchmark::DoNotOptimize(&fft.GetSpectrum());
+            benchmark::ClobberMemory();
+        }
+    }
+
+    /**
+     * @brief Measures constructing the runtime FFT, the per-Configure setup FixedFFT does not have.
+     */
+    void BM_RuntimeFFTSetup(benchmark::State &state)
+    {
+        for (auto _ : state)
+        {
+            auto fft = std::make_unique<GuitarDSP::FFTProcessor>(g_kFftSize, 48000.0f);
+            benchmark::DoNotOptimize(fft.get());
+        }
+    }
+
+} // namespace
+
+BENCHMARK(BM_FixedFFT);
+BENCHMARK(BM_RuntimeFFT);
+BENCHMARK(BM_RuntimeFFTSetup);
@@ -0,0 +1,49 @@
+#include "BenchmarkCommon.h"
+
+#include "Analysis/Resampler.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Benchmarks;
+
+namespace
+{
+
+    constexpr float g_kAnalysisRate = 48000.0f;
+    constexpr size_t g_kDeviceBlock = 512;
+
+    /**
+     * @brief Measures resampling one device block to the analysis rate. Arg: device rate in Hz.
+     */
+    void BM_Resampler(benchmark::State &state)
+    {
+        const auto inputRate = static_cast<float>(state.range(0));
+        const auto signal = GenerateSignal(SignalType::Pluck, inputRate);
+        HopCursor cursor(signal, g_kDeviceBlock);
+
+        Resampler resampler;
+        if (!resampler.Configure(inputRate, g_kAnalysisRate, g_kDeviceBlock))
+        {
+            state.SkipWithError("Unsupported rate");
+            return;
+        }
+        std::vector<float> output(resampler.GetMaxOutputSize(g_kDeviceBlock));
+
+        for (auto _ : state)
+        {
+            const size_t written = resampler.Process(cursor.Next(), output);
+            benchmark::DoNotOptimize(written);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_kDeviceBlock));
+        state.SetLabel(std::to_string(resampler.GetInterpolation()) + "/" + std::to_string(resampler.GetDecimation())
+                       + ", " + std::to_string(resampler.GetTapsPerPhase()) + " taps");
+    }
+
+} // namespace
+
+BENCHMARK(BM_Resampler)->Arg(44100)->Arg(88200)->Arg(96000)->Arg(192000);
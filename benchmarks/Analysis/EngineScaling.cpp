@@ -0,0 +1,605 @@
+/**
+ * @file EngineScaling.cpp
+ * @brief Multi-stream load harness that finds how many inputs one machine can analyze in real time.
+ *
+ * Spins up N independent pipelines (synthetic source -> ring buffer -> AnalysisEngine with all
+ * analyzers), runs them at real-time pace and ramps N until deadline misses or ring overflows
+ * appear. By default N doubles until the first failure and is then bisected. Each step reports
+ * hop time percentiles, deadline misses, dropped samples, per-core CPU utilization and resident
+ * memory per stream.
+ *
+ * Engines are driven by Analysis::AnalysisWorkerPool, as the application's stations are: either
+ * one single-thread pool per stream, or one shared pool of --workers threads for all streams.
+ * Worker threads can be pinned to cores.
+ *
+ * Example: find capacity with a 4-thread shared pool pinned to cores
+ *   GuitarDiagnosticsEngineScaling --workers 4 --pin --seconds 5
+ */
+
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/AnalysisWorkerPool.h"
+#include "Analysis/EngineMetrics.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Audio/SyntheticAudioSource.h"
+#include "Util/LatencyHistogram.h"
+#include "Util/LockFreeRingBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+using namespace GuitarDiagnostics;
+
+namespace
+{
+
+    constexpr std::array<float, 6> g_kOpenStrings = { 82.41f, 110.0f, 146.83f, 196.0f, 246.94f, 329.63f };
+
+    /**
+     * @brief Harness parameters, settable from the command line.
+     */
+    struct ScalingConfig
+    {
+        float sampleRate;      ///< Stream sample rate in Hz.
+        uint32_t bufferSize;   ///< Engine hop size in frames.
+        size_t ringCapacity;   ///< Ring capacity per stream in samples.
+        uint32_t startStreams; ///< First stream count tried.
+        uint32_t maxStreams;   ///< Upper bound of the ramp.
+        uint32_t step;         ///< Linear ramp step, 0 = double then bisect.
+        double warmupSeconds;  ///< Run time discarded before measuring each step.
+        double seconds;        ///< Measured run time of each step.
+        uint32_t workers;      ///< Shared worker threads, 0 = one dedicated thread per stream.
+        bool pin;              ///< Pin worker threads to cores.
+        double missThreshold;  ///< Highest deadline miss ratio still counted as sustainable.
+        std::string jsonPath;  ///< Optional JSON output file.
+
+        ScalingConfig();
+    };
+
+    ScalingConfig::ScalingConfig()
+        : sampleRate(48000.0f), bufferSize(512), ringCapacity(16384), startStreams(1),
+          maxStreams(std::max(4u, 4 * std::thread::hardware_concurrency())), step(0), warmupSeconds(1.0),
+          seconds(3.0), workers(0), pin(false), missThreshold(0.0), jsonPath()
+    {
+    }
+
+    /**
+     * @brief One input stream: synthetic source, ring buffer and analysis engine.
+     */
+    struct Pipeline
+    {
+        Util::LockFreeRingBuffer<float> ringBuffer;  ///< Source-to-engine ring.
+        Audio::SyntheticAudioSource source;          ///< Real-time paced synthetic guitar tone.
+        Analysis::AnalysisEngine engine;             ///< Engine driven by a worker pool.
+        uint64_t droppedAtStart;                     ///< Source drops when measurement started.
+
+        Pipeline(const ScalingConfig &config, const Audio::SyntheticToneConfig &tone);
+    };
+
+    Pipeline::Pipeline(const ScalingConfig &config, const Audio::SyntheticToneConfig &tone)
+        : ringBuffer(config.ringCapacity), source(tone),
+          engine(&ringBuffer, Analysis::AnalysisConfig(config.sampleRate, config.bufferSize)), droppedAtStart(0)
+    {
+        engine.RegisterAnalyzer(std::make_shared<Analysis::FretBuzzDetector>());
+        engine.RegisterAnalyzer(std::make_shared<Analysis::IntonationAnalyzer>());
+        engine.RegisterAnalyzer(std::make_shared<Analysis::StringHealthAnalyzer>());
+        source.SetRingBuffer(&ringBuffer);
+    }
+
+    /**
+     * @brief Cumulative busy and total CPU time per core, from /proc/stat (Linux only).
+     */
+    struct CpuTimes
+    {
+        std::vector<uint64_t> busy;  ///< Busy jiffies per core.
+        std::vector<uint64_t> total; ///< Total jiffies per core.
+    };
+
+    CpuTimes ReadCpuTimes()
+    {
+        CpuTimes times;
+#if defined(__linux__)
+        std::ifstream stat("/proc/stat");
+        std::string line;
+        while (std::getline(stat, line))
+        {
+            if (line.size() < 4 || line.compare(0, 3, "cpu") != 0 || line[3] < '0' || line[3] > '9')
+            {
+                continue;
+            }
+
+            std::istringstream fields(line);
+            std::string label;
+            uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+            fields >> label >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
+
+            const uint64_t idleTime = idle + iowait;
+            const uint64_t total = user + nice + system + idleTime + irq + softirq + steal;
+            times.busy.push_back(total - idleTime);
+            times.total.push_back(total);
+        }
+#endif
+        return times;
+    }
+
+    std::vector<double> GetUtilization(const CpuTimes &before, const CpuTimes &after)
+    {
+        std::vector<double> utilization;
+        const size_t cores = std::min(before.total.size(), after.total.size());
+        for (size_t core = 0; core < cores; ++core)
+        {
+            const uint64_t total = after.total[core] - before.total[core];
+            const uint64_t busy = after.busy[core] - before.busy[core];
+            utilization.push_back(total > 0 ? static_cast<double>(busy) / static_cast<double>(total) : 0.0);
+        }
+        return utilization;
+    }
+
+    /**
+     * @brief Resident set size of the process in bytes, 0 if unavailable.
+     */
+    uint64_t ReadResidentBytes()
+    {
+#if defined(__linux__)
+        std::ifstream statm("/proc/self/statm");
+        uint64_t sizePages = 0;
+        uint64_t residentPages = 0;
+        if (statm >> sizePages >> residentPages)
+        {
+            return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+        return 0;
+    }
+
+    bool PinCurrentThread(uint32_t core)
+    {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        static_cast<void>(core);
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Measurements of one ramp step.
+     */
+    struct StepResult
+    {
+        uint32_t streams;                ///< Concurrent streams.
+        Util::LatencyHistogram hopTimes; ///< Merged per-hop analysis time.
+        uint64_t hops;                   ///< Hops processed in the measured window.
+        uint64_t deadlineMisses;         ///< Hops over budget.
+        uint64_t droppedSamples;         ///< Samples rejected by full rings.
+        double peakFillRatio;            ///< Highest ring fill over capacity.
+        std::vector<double> coreUsage;   ///< Utilization per core, empty if unavailable.
+        uint64_t residentPerStream;      ///< Resident memory growth per stream in bytes.
+        bool sustainable;                ///< No drops and miss ratio within threshold.
+
+        explicit StepResult(uint32_t streams);
+    };
+
+    StepResult::StepResult(uint32_t streams)
+        : streams(streams), hopTimes(), hops(0), deadlineMisses(0), droppedSamples(0), peakFillRatio(0.0),
+          coreUsage(), residentPerStream(0), sustainable(false)
+    {
+    }
+
+    double GetMissRatio(const StepResult &result)
+    {
+        return result.hops == 0 ? 0.0 : static_cast<double>(result.deadlineMisses) / static_cast<double>(result.hops);
+    }
+
+    double GetMeanUsage(const StepResult &result)
+    {
+        if (result.coreUsage.empty())
+        {
+            return 0.0;
+        }
+
+        double sum = 0.0;
+        for (double usage : result.coreUsage)
+        {
+            sum += usage;
+        }
+        return sum / static_cast<double>(result.coreUsage.size());
+    }
+
+    double GetMaxUsage(const StepResult &result)
+    {
+        return result.coreUsage.empty() ? 0.0 : *std::max_element(result.coreUsage.begin(), result.coreUsage.end());
+    }
+
+    std::chrono::nanoseconds ToDuration(double seconds)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(seconds));
+    }
+
+    /**
+     * @brief Runs one step with the given number of streams.
+     */
+    std::unique_ptr<StepResult> RunStep(const ScalingConfig &config, uint32_t streams)
+    {
+        auto result = std::make_unique<StepResult>(streams);
+        const uint64_t residentBefore = ReadResidentBytes();
+
+        std::vector<std::unique_ptr<Pipeline>> pipelines;
+        for (uint32_t i = 0; i < streams; ++i)
+        {
+            // Cycle through the open strings so streams do not all analyze the same note.
+            Audio::SyntheticToneConfig tone;
+            tone.fundamental = g_kOpenStrings[i % g_kOpenStrings.size()];
+            tone.noiseLevel = 0.01f;
+            pipelines.push_back(std::make_unique<Pipeline>(config, tone));
+
+            if (!pipelines.back()->source.Open(config.sampleRate, config.bufferSize))
+            {
+                std::fprintf(stderr, "Failed to open synthetic source %u\n", i);
+                return result;
+            }
+        }
+
+        // A shared pool serves every stream; otherwise each stream gets a pool with one thread of its own.
+        const size_t poolThreads = config.workers > 0 ? config.workers : 1;
+        std::vector<std::unique_ptr<Analysis::AnalysisWorkerPool>> pools;
+        for (uint32_t i = 0; i < streams; ++i)
+        {
+            if (config.workers == 0 || pools.empty())
+            {
+                pools.push_back(std::make_unique<Analysis::AnalysisWorkerPool>(poolThreads));
+            }
+            pools.back()->AddEngine(&pipelines[i]->engine);
+        }
+
+        const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+        uint32_t firstWorker = 0;
+        for (auto &pool : pools)
+        {
+            if (config.pin)
+            {
+                pool->SetThreadStartListener([firstWorker, cores](size_t workerIndex) {
+                    const uint32_t worker = firstWorker + static_cast<uint32_t>(workerIndex);
+                    if (!PinCurrentThread(worker % cores))
+                    {
+                        std::fprintf(stderr, "Failed to pin worker %u\n", worker);
+                    }
+                });
+            }
+            firstWorker += static_cast<uint32_t>(pool->GetThreadCount());
+
+            if (!pool->Start())
+            {
+                std::fprintf(stderr, "Failed to start worker pool\n");
+                return result;
+            }
+        }
+
+        for (auto &pipeline : pipelines)
+        {
+            pipeline->source.Start();
+        }
+
+        std::this_thread::sleep_for(ToDuration(config.warmupSeconds));
+
+        for (auto &pipeline : pipelines)
+        {
+            pipeline->engine.GetMetrics().RequestReset();
+            pipeline->droppedAtStart = pipeline->source.GetDroppedSamples();
+        }
+        const CpuTimes cpuBefore = ReadCpuTimes();
+        const uint64_t residentAfter = ReadResidentBytes();
+
+        std::this_thread::sleep_for(ToDuration(config.seconds));
+
+        const CpuTimes cpuAfter = ReadCpuTimes();
+        for (auto &pipeline : pipelines)
+        {
+            pipeline->source.Stop();
+        }
+        for (auto &pool : pools)
+        {
+            pool->Stop();
+        }
+
+        for (const auto &pipeline : pipelines)
+        {
+            const auto &metrics = pipeline->engine.GetMetrics();
+            result->hopTimes.Merge(metrics.GetHopHistogram());
+            result->hops += metrics.GetHopHistogram().GetCount();
+            result->deadlineMisses += metrics.GetDeadlineMisses();
+            result->droppedSamples += pipeline->source.GetDroppedSamples() - pipeline->droppedAtStart;
+            result->peakFillRatio = std::max(result->peakFillRatio,
+                static_cast<double>(metrics.GetPeakRingFill()) / static_cast<double>(metrics.GetRingCapacity()));
+        }
+
+        result->coreUsage = GetUtilization(cpuBefore, cpuAfter);
+        result->residentPerStream = residentAfter > residentBefore ? (residentAfter - residentBefore) / streams : 0;
+        result->sustainable =
+            result->hops > 0 && result->droppedSamples == 0 && GetMissRatio(*result) <= config.missThreshold;
+
+        return result;
+    }
+
+    double ToMicros(uint64_t nanoseconds)
+    {
+        return static_cast<double>(nanoseconds) / 1000.0;
+    }
+
+    void PrintHeader(const ScalingConfig &config)
+    {
+        std::printf("rate=%.0f hop=%u ring=%zu threads=%s pin=%s warmup=%.1fs seconds=%.1fs miss-threshold=%.4f\n\n",
+            static_cast<double>(config.sampleRate),
+            config.bufferSize,
+            config.ringCapacity,
+            config.workers > 0 ? (std::to_string(config.workers) + " shared").c_str() : "dedicated",
+            config.pin ? "yes" : "no",
+            config.warmupSeconds,
+            config.seconds,
+            config.missThreshold);
+
+        std::printf("%8s %10s %10s %10s %9s %10s %9s %9s %9s %12s %6s\n",
+            "streams",
+            "p50 us",
+            "p99 us",
+            "max us",
+            "misses",
+            "dropped",
+            "peak",
+            "cpu avg",
+            "cpu max",
+            "KiB/stream",
+            "ok");
+    }
+
+    void PrintStep(const StepResult &result)
+    {
+        std::printf("%8u %10.1f %10.1f %10.1f %8.3f%% %10llu %8.1f%% %8.1f%% %8.1f%% %12.1f %6s\n",
+            result.streams,
+            ToMicros(result.hopTimes.GetPercentile(50.0)),
+            ToMicros(result.hopTimes.GetPercentile(99.0)),
+            ToMicros(result.hopTimes.GetMax()),
+            GetMissRatio(result) * 100.0,
+            static_cast<unsigned long long>(result.droppedSamples),
+            result.peakFillRatio * 100.0,
+            GetMeanUsage(result) * 100.0,
+            GetMaxUsage(result) * 100.0,
+            static_cast<double>(result.residentPerStream) / 1024.0,
+            result.sustainable ? "yes" : "NO");
+        std::fflush(stdout);
+    }
+
+    void PrintUsage(const char *program)
+    {
+        std::printf("Usage: %s [options]\n"
+                    "  --rate HZ          stream sample rate (default 48000)\n"
+                    "  --hop N            engine hop size in frames (default 512)\n"
+                    "  --capacity N       ring capacity per stream in samples (default 16384)\n"
+                    "  --start N          first stream count (default 1)\n"
+                    "  --max N            largest stream count tried (default 4 x hardware threads)\n"
+                    "  --step N           linear ramp step, 0 = double then bisect (default 0)\n"
+                    "  --warmup S         seconds discarded before each measurement (default 1)\n"
+                    "  --seconds S        measured seconds per step (default 3)\n"
+                    "  --workers N        shared worker threads, 0 = one thread per stream (default 0)\n"
+                    "  --pin              pin worker threads to cores (Linux)\n"
+                    "  --miss-threshold R tolerated deadline miss ratio (default 0)\n"
+                    "  --json FILE        write results as JSON\n",
+            program);
+    }
+
+    bool ParseArguments(int argc, char **argv, ScalingConfig &config)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--pin")
+            {
+                config.pin = true;
+            }
+            else if (arg == "--rate" && hasValue)
+            {
+                config.sampleRate = std::strtof(argv[++i], nullptr);
+            }
+            else if (arg == "--hop" && hasValue)
+            {
+                config.bufferSize = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--capacity" && hasValue)
+            {
+                config.ringCapacity = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--start" && hasValue)
+            {
+                config.startStreams = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--max" && hasValue)
+            {
+                config.maxStreams = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--step" && hasValue)
+            {
+                config.step = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--warmup" && hasValue)
+            {
+                config.warmupSeconds = std::strtod(argv[++i], nullptr);
+            }
+            else if (arg == "--seconds" && hasValue)
+            {
+                config.seconds = std::strtod(argv[++i], nullptr);
+            }
+            else if (arg == "--workers" && hasValue)
+            {
+                config.workers = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--miss-threshold" && hasValue)
+            {
+                config.missThreshold = std::strtod(argv[++i], nullptr);
+            }
+            else if (arg == "--json" && hasValue)
+            {
+                config.jsonPath = argv[++i];
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return config.sampleRate > 0.0f && config.bufferSize > 0 && config.ringCapacity >= config.bufferSize
+               && config.startStreams > 0 && config.maxStreams >= config.startStreams && config.seconds > 0.0
+               && config.warmupSeconds >= 0.0;
+    }
+
+    bool WriteJson(const ScalingConfig &config,
+        const std::vector<std::unique_ptr<StepResult>> &results,
+        uint32_t maxSustainable)
+    {
+        FILE *file = std::fopen(config.jsonPath.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s for writing\n", config.jsonPath.c_str());
+            return false;
+        }
+
+        std::fprintf(file,
+            "{\n  \"config\": {\"rate\": %.1f, \"hop\": %u, \"capacity\": %zu, \"workers\": %u, \"pin\": %s, "
+            "\"warmup\": %.3f, \"seconds\": %.3f, \"miss_threshold\": %.6f},\n"
+            "  \"max_sustainable_streams\": %u,\n  \"steps\": [\n",
+            static_cast<double>(config.sampleRate),
+            config.bufferSize,
+            config.ringCapacity,
+            config.workers,
+            config.pin ? "true" : "false",
+            config.warmupSeconds,
+            config.seconds,
+            config.missThreshold,
+            maxSustainable);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto &result = *results[i];
+            std::fprintf(file,
+                "    {\"streams\": %u, \"hop_ns\": {\"p50\": %llu, \"p99\": %llu, \"max\": %llu}, \"hops\": %llu, "
+                "\"deadline_misses\": %llu, \"dropped_samples\": %llu, \"peak_fill_ratio\": %.4f, "
+                "\"resident_bytes_per_stream\": %llu, \"sustainable\": %s, \"core_utilization\": [",
+                result.streams,
+                static_cast<unsigned long long>(result.hopTimes.GetPercentile(50.0)),
+                static_cast<unsigned long long>(result.hopTimes.GetPercentile(99.0)),
+                static_cast<unsigned long long>(result.hopTimes.GetMax()),
+                static_cast<unsigned long long>(result.hops),
+                static_cast<unsigned long long>(result.deadlineMisses),
+                static_cast<unsigned long long>(result.droppedSamples),
+                result.peakFillRatio,
+                static_cast<unsigned long long>(result.residentPerStream),
+                result.sustainable ? "true" : "false");
+
+            for (size_t core = 0; core < result.coreUsage.size(); ++core)
+            {
+                std::fprintf(file, "%s%.4f", core > 0 ? ", " : "", result.coreUsage[core]);
+            }
+
+            std::fprintf(file, "]}%s\n", i + 1 < results.size() ? "," : "");
+        }
+
+        std::fprintf(file, "  ]\n}\n");
+        std::fclose(file);
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ScalingConfig config;
+    if (!ParseArguments(argc, argv, config))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    PrintHeader(config);
+
+    std::vector<std::unique_ptr<StepResult>> results;
+    uint32_t maxSustainable = 0;
+    uint32_t firstFailure = 0;
+
+    auto runStep = [&](uint32_t streams) {
+        results.push_back(RunStep(config, streams));
+        PrintStep(*results.back());
+        return results.back()->sustainable;
+    };
+
+    // Ramp up until the first failure.
+    uint32_t streams = config.startStreams;
+    while (streams <= config.maxStreams)
+    {
+        if (!runStep(streams))
+        {
+            firstFailure = streams;
+            break;
+        }
+
+        maxSustainable = streams;
+        if (streams == config.maxStreams)
+        {
+            break;
+        }
+        streams = config.step > 0 ? std::min(streams + config.step, config.maxStreams)
+                                  : std::min(streams * 2, config.maxStreams);
+    }
+
+    // Bisect between the last sustainable and the first failing count when doubling.
+    if (config.step == 0 && firstFailure > 0)
+    {
+        uint32_t low = maxSustainable;
+        uint32_t high = firstFailure;
+        while (high - low > 1)
+        {
+            const uint32_t middle = low + (high - low) / 2;
+            if (runStep(middle))
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        maxSustainable = low;
+    }
+
+    std::printf("\nMaximum sustainable streams: %u%s\n",
+        maxSustainable,
+        firstFailure == 0 ? " (no failure up to --max)" : "");
+
+    if (!config.jsonPath.empty() && !WriteJson(config, results, maxSustainable))
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,853 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief Accuracy-versus-cost sweep of the analyzer tuning parameters.
+ *
+ * Runs all analyzers over a labeled corpus for every point of a parameter grid (FFT size, YIN
+ * threshold, harmonic count, pitch accumulator size, decay history size, hop size) and reports
+ * accuracy against CPU cost per hop:
+ *   - cents error and lock rate of the intonation analyzer's open-string pitch on pitch cases,
+ *   - ROC AUC of the mean buzz score separating buzzing from clean cases,
+ *   - Pearson correlation of the string health score with the labeled health.
+ * Grid points that no other point beats on cost and on every accuracy metric are marked as Pareto
+ * optimal. Grid points are evaluated in parallel; use --threads 1 for the least noisy cost figures.
+ *
+ * The default corpus is synthetic (stiff-string model with known pitch, buzz and decay). A recorded
+ * corpus is a CSV manifest with one "kind,path,label" line per WAV file, where kind is pitch (label
+ * = true fundamental in Hz), buzz (label = 1 for buzzing, 0 for clean) or health (label = expected
+ * health in [0, 1]). Paths are relative to the manifest.
+ *
+ * Example: sweep FFT size and YIN threshold on four cores
+ *   GuitarDiagnosticsParameterSweep --fft 1024,2048,4096 --yin 0.1,0.15,0.2 --threads 4 --json sweep.json
+ */
+
+#include "Analysis/AnalysisClock.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Audio/WavFile.h"
+#include "Util/SignalGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace GuitarDiagnostics;
+
+namespace
+{
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::array<float, 6> g_kOpenStrings = { 82.41f, 110.0f, 146.83f, 196.0f, 246.94f, 329.63f };
+
+    /**
+     * @brief What a corpus case is labeled for.
+     */
+    enum class CaseKind
+    {
+        Pitch, ///< Label is the true fundamental in Hz.
+        Buzz,  ///< Label is 1 for buzzing, 0 for clean.
+        Health ///< Label is the expected health in [0, 1].
+    };
+
+    /**
+     * @brief One labeled recording or synthetic note.
+     */
+    struct CorpusCase
+    {
+        CaseKind kind;              ///< Label kind.
+        std::string name;           ///< Display name.
+        float sampleRate;           ///< Sample rate in Hz.
+        std::vector<float> samples; ///< Mono samples.
+        float label;                ///< Ground truth, see CaseKind.
+
+        CorpusCase(CaseKind kind, std::string name, float sampleRate, std::vector<float> samples, float label);
+    };
+
+    CorpusCase::CorpusCase(CaseKind kind, std::string name, float sampleRate, std::vector<float> samples, float label)
+        : kind(kind), name(std::move(name)), sampleRate(sampleRate), samples(std::move(samples)), label(label)
+    {
+    }
+
+    /**
+     * @brief One point of the parameter grid.
+     */
+    struct GridPoint
+    {
+        size_t fftSize;              ///< FFT length of fret buzz and string health.
+        float yinThreshold;          ///< YIN threshold of all analyzers.
+        size_t numHarmonics;         ///< Harmonics of fret buzz and string health.
+        size_t pitchAccumulatorSize; ///< Intonation stability window.
+        size_t decayHistorySize;     ///< String health decay fit window.
+        uint32_t hopSize;            ///< Frames per ProcessBuffer() call.
+    };
+
+    /**
+     * @brief Sweep parameters, settable from the command line.
+     */
+    struct SweepConfig
+    {
+        std::vector<size_t> fftSizes;          ///< FFT size axis.
+        std::vector<float> yinThresholds;      ///< YIN threshold axis.
+        std::vector<size_t> harmonicCounts;    ///< Harmonic count axis.
+        std::vector<size_t> accumulatorSizes;  ///< Pitch accumulator size axis.
+        std::vector<size_t> decayHistorySizes; ///< Decay history size axis.
+        std::vector<size_t> hopSizes;          ///< Hop size axis.
+        float sampleRate;                      ///< Sample rate of the synthetic corpus.
+        double noteSeconds;                    ///< Length of each synthetic note.
+        std::string corpusPath;                ///< Optional recorded corpus manifest.
+        uint32_t threads;                      ///< Worker threads evaluating grid points.
+        std::string jsonPath;                  ///< Optional JSON output file.
+
+        SweepConfig();
+    };
+
+    SweepConfig::SweepConfig()
+        : fftSizes{ 1024, 2048, 4096 }, yinThresholds{ 0.10f, 0.15f, 0.20f }, harmonicCounts{ 5, 10 },
+          accumulatorSizes{ 50, 100 }, decayHistorySizes{ 25, 50 }, hopSizes{ 512 }, sampleRate(48000.0f),
+          noteSeconds(1.5), corpusPath(), threads(std::max(1u, std::thread::hardware_concurrency())), jsonPath()
+    {
+    }
+
+    /**
+     * @brief Accuracy and cost of one grid point.
+     */
+    struct PointResult
+    {
+        GridPoint point;                      ///< Evaluated parameters.
+        double meanAbsCents;                  ///< Mean absolute open-string pitch error of locked cases.
+        double lockRate;                      ///< Fraction of pitch cases that reached a stable pitch.
+        double buzzAuc;                       ///< ROC AUC of mean buzz score, NaN without buzz cases.
+        double healthCorrelation;             ///< Pearson r of health score and label, NaN without health cases.
+        std::array<double, 3> analyzerMicros; ///< Mean time per hop of fret buzz, intonation, string health.
+        double budgetPercent;                 ///< Total time per hop as a share of the hop duration.
+        bool pareto;                          ///< Not dominated by any other point.
+
+        explicit PointResult(const GridPoint &point);
+    };
+
+    PointResult::PointResult(const GridPoint &point)
+        : point(point), meanAbsCents(std::numeric_limits<double>::quiet_NaN()), lockRate(0.0),
+          buzzAuc(std::numeric_limits<double>::quiet_NaN()),
+          healthCorrelation(std::numeric_limits<double>::quiet_NaN()), analyzerMicros{}, budgetPercent(0.0),
+          pareto(false)
+    {
+    }
+
+    double GetTotalMicros(const PointResult &result)
+    {
+        return result.analyzerMicros[0] + result.analyzerMicros[1] + result.analyzerMicros[2];
+    }
+
+    std::vector<float> RenderNote(const Util::StringModelConfig &model,
+        float sampleRate,
+        double seconds,
+        const Util::BuzzConfig &buzz = Util::BuzzConfig())
+    {
+        const auto numSamples = static_cast<size_t>(seconds * static_cast<double>(sampleRate));
+        return Util::GeneratePluckedString(model, sampleRate, numSamples, buzz, 0.002f);
+    }
+
+    /**
+     * @brief Builds the synthetic corpus: detuned open strings, clean and buzzing notes, and
+     *        strings whose decay, brightness and stiffness follow a wear label.
+     */
+    std::vector<CorpusCase> BuildSyntheticCorpus(const SweepConfig &config)
+    {
+        std::vector<CorpusCase> corpus;
+
+        for (float fundamental : g_kOpenStrings)
+        {
+            for (float detuneCents : { -20.0f, 0.0f, 15.0f })
+            {
+                Util::StringModelConfig model;
+                model.fundamental = fundamental * std::exp2(detuneCents / 1200.0f);
+                model.decayRate = 0.5f;
+                corpus.emplace_back(CaseKind::Pitch,
+                    "pitch " + std::to_string(static_cast<int>(model.fundamental)) + " Hz",
+                    config.sampleRate,
+                    RenderNote(model, config.sampleRate, config.noteSeconds),
+                    model.fundamental);
+            }
+        }
+
+        for (float fundamental : g_kOpenStrings)
+        {
+            Util::StringModelConfig model;
+            model.fundamental = fundamental;
+
+            Util::BuzzConfig buzz;
+            buzz.duration = static_cast<float>(config.noteSeconds);
+            corpus.emplace_back(CaseKind::Buzz, "clean", config.sampleRate,
+                RenderNote(model, config.sampleRate, config.noteSeconds, buzz), 0.0f);
+
+            buzz.amplitude = 0.15f;
+            corpus.emplace_back(CaseKind::Buzz, "buzz", config.sampleRate,
+                RenderNote(model, config.sampleRate, config.noteSeconds, buzz), 1.0f);
+        }
+
+        for (float fundamental : { 110.0f, 196.0f })
+        {
+            for (int step = 0; step <= 5; ++step)
+            {
+                // Worn strings ring shorter, lose their top end faster and get stiffer.
+                const float wear = static_cast<float>(step) / 5.0f;
+                Util::StringModelConfig model;
+                model.fundamental = fundamental;
+                model.decayRate = 0.8f + 4.0f * wear;
+                model.decayPerPartial = 0.2f + 1.5f * wear;
+                model.inharmonicity = 1e-4f * (1.0f + 4.0f * wear);
+                corpus.emplace_back(CaseKind::Health, "health", config.sampleRate,
+                    RenderNote(model, config.sampleRate, config.noteSeconds), 1.0f - wear);
+            }
+        }
+
+        return corpus;
+    }
+
+    bool LoadCorpus(const std::filesystem::path &manifestPath, std::vector<CorpusCase> &corpus)
+    {
+        std::ifstream manifest(manifestPath);
+        if (!manifest)
+        {
+            std::fprintf(stderr, "Failed to open corpus manifest %s\n", manifestPath.string().c_str());
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(manifest, line))
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream fields(line);
+            std::string kindText;
+            std::string path;
+            std::string labelText;
+            if (!std::getline(fields, kindText, ',') || !std::getline(fields, path, ',')
+                || !std::getline(fields, labelText))
+            {
+                std::fprintf(stderr, "Malformed corpus line: %s\n", line.c_str());
+                return false;
+            }
+
+            CaseKind kind = CaseKind::Pitch;
+            if (kindText == "buzz")
+            {
+                kind = CaseKind::Buzz;
+            }
+            else if (kindText == "health")
+            {
+                kind = CaseKind::Health;
+            }
+            else if (kindText != "pitch")
+            {
+                std::fprintf(stderr, "Unknown corpus kind: %s\n", kindText.c_str());
+                return false;
+            }
+
+            auto wav = Audio::ReadWavFile(manifestPath.parent_path() / path);
+            if (!wav)
+            {
+                std::fprintf(stderr, "Failed to read %s\n", path.c_str());
+                return false;
+            }
+
+            const float label = std::strtof(labelText.c_str(), nullptr);
+            corpus.emplace_back(kind, path, wav->sampleRate, std::move(wav->samples), label);
+        }
+
+        return !corpus.empty();
+    }
+
+    double CalculateAuc(const std::vector<double> &positives, const std::vector<double> &negatives)
+    {
+        if (positives.empty() || negatives.empty())
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double wins = 0.0;
+        for (double positive : positives)
+        {
+            for (double negative : negatives)
+            {
+                wins += positive > negative ? 1.0 : (positive == negative ? 0.5 : 0.0);
+            }
+        }
+        return wins / static_cast<double>(positives.size() * negatives.size());
+    }
+
+    double CalculateCorrelation(const std::vector<double> &x, const std::vector<double> &y)
+    {
+        const size_t count = std::min(x.size(), y.size());
+        if (count < 2)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        double meanX = 0.0;
+        double meanY = 0.0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            meanX += x[i];
+            meanY += y[i];
+        }
+        meanX /= static_cast<double>(count);
+        meanY /= static_cast<double>(count);
+
+        double covariance = 0.0;
+        double varianceX = 0.0;
+        double varianceY = 0.0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            covariance += (x[i] - meanX) * (y[i] - meanY);
+            varianceX += (x[i] - meanX) * (x[i] - meanX);
+            varianceY += (y[i] - meanY) * (y[i] - meanY);
+        }
+
+        if (varianceX <= 0.0 || varianceY <= 0.0)
+        {
+            return 0.0;
+        }
+        return covariance / std::sqrt(varianceX * varianceY);
+    }
+
+    /**
+     * @brief Runs every corpus case through fresh analyzers configured for one grid point.
+     */
+    std::unique_ptr<PointResult> EvaluatePoint(const GridPoint &point, const std::vector<CorpusCase> &corpus)
+    {
+        auto result = std::make_unique<PointResult>(point);
+
+        Analysis::FretBuzzParameters fretBuzzParameters;
+        fretBuzzParameters.fftSize = point.fftSize;
+        fretBuzzParameters.yinThreshold = point.yinThreshold;
+        fretBuzzParameters.numHarmonics = point.numHarmonics;
+
+        Analysis::IntonationParameters intonationParameters;
+        intonationParameters.yinThreshold = point.yinThreshold;
+        intonationParameters.pitchAccumulatorSize = point.pitchAccumulatorSize;
+
+        Analysis::StringHealthParameters stringHealthParameters;
+        stringHealthParameters.fftSize = point.fftSize;
+        stringHealthParameters.yinThreshold = point.yinThreshold;
+        stringHealthParameters.numHarmonics = point.numHarmonics;
+        stringHealthParameters.decayHistorySize = point.decayHistorySize;
+
+        std::array<uint64_t, 3> analyzerNanos{};
+        uint64_t hops = 0;
+        double hopSeconds = 0.0;
+
+        double centsSum = 0.0;
+        size_t pitchCases = 0;
+        size_t lockedCases = 0;
+        std::vector<double> buzzPositives;
+        std::vector<double> buzzNegatives;
+        std::vector<double> healthScores;
+        std::vector<double> healthLabels;
+
+        for (const auto &corpusCase : corpus)
+        {
+            Analysis::FretBuzzDetector fretBuzz(fretBuzzParameters);
+            Analysis::IntonationAnalyzer intonation(intonationParameters);
+            Analysis::StringHealthAnalyzer stringHealth(stringHealthParameters);
+            std::array<Analysis::Analyzer *, 3> analyzers = { &fretBuzz, &intonation, &stringHealth };
+
+            // Time advances with the audio, so stableTime means the same however fast the sweep runs.
+            Analysis::SampleClock clock(corpusCase.sampleRate);
+            const Analysis::AnalysisConfig analysisConfig(corpusCase.sampleRate, point.hopSize, &clock);
+            for (auto *analyzer : analyzers)
+            {
+                analyzer->Configure(analysisConfig);
+            }
+
+            float lockedFrequency = 0.0f;
+            double buzzSum = 0.0;
+            double healthSum = 0.0;
+            size_t caseHops = 0;
+            size_t healthHops = 0;
+            const size_t hopCount = corpusCase.samples.size() / point.hopSize;
+
+            for (size_t hop = 0; hop < hopCount; ++hop)
+            {
+                const std::span<const float> block(corpusCase.samples.data() + hop * point.hopSize, point.hopSize);
+                clock.OnHop(block.size());
+                for (size_t i = 0; i < analyzers.size(); ++i)
+                {
+                    const auto start = Clock::now();
+                    analyzers[i]->ProcessBuffer(block);
+                    analyzerNanos[i] += static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+                }
+
+                auto buzzResult = std::static_pointer_cast<Analysis::FretBuzzResult>(fretBuzz.GetLatestResult());
+                auto intonationResult =
+                    std::static_pointer_cast<Analysis::IntonationResult>(intonation.GetLatestResult());
+                auto healthResult =
+                    std::static_pointer_cast<Analysis::StringHealthResult>(stringHealth.GetLatestResult());
+
+                buzzSum += buzzResult->buzzScore;
+                if (lockedFrequency == 0.0f && intonationResult->state != Analysis::IntonationState::Idle)
+                {
+                    lockedFrequency = intonationResult->openStringFrequency;
+                }
+                // Health settles once the decay history fills; score the second half of the note.
+                if (hop >= hopCount / 2)
+                {
+                    healthSum += healthResult->healthScore;
+                    healthHops++;
+                }
+                caseHops++;
+            }
+
+            hops += caseHops;
+            hopSeconds += static_cast<double>(caseHops * point.hopSize) / static_cast<double>(corpusCase.sampleRate);
+
+            switch (corpusCase.kind)
+            {
+            case CaseKind::Pitch:
+                pitchCases++;
+                if (lockedFrequency > 0.0f && corpusCase.label > 0.0f)
+                {
+                    centsSum += std::abs(1200.0 * std::log2(lockedFrequency / corpusCase.label));
+                    lockedCases++;
+                }
+                break;
+
+            case CaseKind::Buzz:
+                if (caseHops > 0)
+                {
+                    auto &scores = corpusCase.label >= 0.5f ? buzzPositives : buzzNegatives;
+                    scores.push_back(buzzSum / static_cast<double>(caseHops));
+                }
+                break;
+
+            case CaseKind::Health:
+                if (healthHops > 0)
+                {
+                    healthScores.push_back(healthSum / static_cast<double>(healthHops));
+                    healthLabels.push_back(corpusCase.label);
+                }
+                break;
+            }
+        }
+
+        if (lockedCases > 0)
+        {
+            result->meanAbsCents = centsSum / static_cast<double>(lockedCases);
+        }
+        result->lockRate = pitchCases > 0 ? static_cast<double>(lockedCases) / static_cast<double>(pitchCases) : 0.0;
+        result->buzzAuc = CalculateAuc(buzzPositives, buzzNegatives);
+        result->healthCorrelation = CalculateCorrelation(healthScores, healthLabels);
+
+        if (hops > 0)
+        {
+            for (size_t i = 0; i < analyzerNanos.size(); ++i)
+            {
+                result->analyzerMicros[i] = static_cast<double>(analyzerNanos[i]) / 1000.0 / static_cast<double>(hops);
+            }
+            const double totalSeconds = GetTotalMicros(*result) * static_cast<double>(hops) / 1e6;
+            result->budgetPercent = hopSeconds > 0.0 ? 100.0 * totalSeconds / hopSeconds : 0.0;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Compares one accuracy metric; metrics that are NaN on either side count as equal.
+     * @return -1 if a is worse, 1 if a is better, 0 if equal or not comparable.
+     */
+    int CompareMetric(double a, double b, bool higherIsBetter)
+    {
+        if (std::isnan(a) || std::isnan(b) || a == b)
+        {
+            return 0;
+        }
+        return (a > b) == higherIsBetter ? 1 : -1;
+    }
+
+    bool Dominates(const PointResult &a, const PointResult &b)
+    {
+        const std::array<int, 5> comparisons = {
+            CompareMetric(GetTotalMicros(a), GetTotalMicros(b), false),
+            CompareMetric(a.meanAbsCents, b.meanAbsCents, false),
+            CompareMetric(a.lockRate, b.lockRate, true),
+            CompareMetric(a.buzzAuc, b.buzzAuc, true),
+            CompareMetric(a.healthCorrelation, b.healthCorrelation, true),
+        };
+
+        bool strictlyBetter = false;
+        for (int comparison : comparisons)
+        {
+            if (comparison < 0)
+            {
+                return false;
+            }
+            strictlyBetter |= comparison > 0;
+        }
+        return strictlyBetter;
+    }
+
+    void MarkParetoFront(std::vector<std::unique_ptr<PointResult>> &results)
+    {
+        for (auto &candidate : results)
+        {
+            candidate->pareto = std::none_of(results.begin(), results.end(), [&](const auto &other) {
+                return other != candidate && Dominates(*other, *candidate);
+            });
+        }
+    }
+
+    std::vector<GridPoint> BuildGrid(const SweepConfig &config)
+    {
+        std::vector<GridPoint> grid;
+        for (size_t hopSize : config.hopSizes)
+        {
+            for (size_t fftSize : config.fftSizes)
+            {
+                for (float yinThreshold : config.yinThresholds)
+                {
+                    for (size_t numHarmonics : config.harmonicCounts)
+                    {
+                        for (size_t accumulatorSize : config.accumulatorSizes)
+                        {
+                            for (size_t decayHistorySize : config.decayHistorySizes)
+                            {
+                                grid.push_back(GridPoint{ fftSize,
+                                    yinThreshold,
+                                    numHarmonics,
+                                    accumulatorSize,
+                                    decayHistorySize,
+                                    static_cast<uint32_t>(hopSize) });
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return grid;
+    }
+
+    void PrintHeader()
+    {
+        std::printf("%5s %5s %5s %5s %5s %5s | %8s %6s %6s %7s | %8s %8s %8s %8s %7s %3s\n",
+            "hop",
+            "fft",
+            "yin",
+            "harm",
+            "accum",
+            "hist",
+            "|cents|",
+            "lock",
+            "AUC",
+            "health",
+            "buzz us",
+            "inton us",
+            "health us",
+            "total us",
+            "budget",
+            "P");
+    }
+
+    void PrintResult(const PointResult &result)
+    {
+        const auto &point = result.point;
+        std::printf("%5u %5zu %5.2f %5zu %5zu %5zu | %8.2f %5.0f%% %6.3f %7.3f | %8.1f %8.1f %8.1f %8.1f %6.1f%% %3s\n",
+            point.hopSize,
+            point.fftSize,
+            static_cast<double>(point.yinThreshold),
+            point.numHarmonics,
+            point.pitchAccumulatorSize,
+            point.decayHistorySize,
+            result.meanAbsCents,
+            result.lockRate * 100.0,
+            result.buzzAuc,
+            result.healthCorrelation,
+            result.analyzerMicros[0],
+            result.analyzerMicros[1],
+            result.analyzerMicros[2],
+            GetTotalMicros(result),
+            result.budgetPercent,
+            result.pareto ? "*" : "");
+    }
+
+    void PrintUsage(const char *program)
+    {
+        std::printf("Usage: %s [options]\n"
+                    "  --fft LIST         FFT sizes (default 1024,2048,4096)\n"
+                    "  --yin LIST         YIN thresholds (default 0.1,0.15,0.2)\n"
+                    "  --harmonics LIST   harmonic counts (default 5,10)\n"
+                    "  --accumulator LIST intonation pitch accumulator sizes (default 50,100)\n"
+                    "  --history LIST     string health decay history sizes (default 25,50)\n"
+                    "  --hop LIST         hop sizes in frames (default 512)\n"
+                    "  --rate HZ          synthetic corpus sample rate (default 48000)\n"
+                    "  --note-seconds S   synthetic note length (default 1.5)\n"
+                    "  --corpus FILE      recorded corpus manifest (kind,path,label per line)\n"
+                    "  --threads N        parallel grid workers (default hardware threads)\n"
+                    "  --json FILE        write results as JSON\n",
+            program);
+    }
+
+    bool ParseSizes(std::string_view text, std::vector<size_t> &values)
+    {
+        values.clear();
+        while (!text.empty())
+        {
+            const size_t comma = text.find(',');
+            const std::string item(text.substr(0, comma));
+            const auto value = std::strtoull(item.c_str(), nullptr, 10);
+            if (value == 0)
+            {
+                return false;
+            }
+            values.push_back(static_cast<size_t>(value));
+            text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+        }
+        return !values.empty();
+    }
+
+    bool ParseFloats(std::string_view text, std::vector<float> &values)
+    {
+        values.clear();
+        while (!text.empty())
+        {
+            const size_t comma = text.find(',');
+            const std::string item(text.substr(0, comma));
+            const float value = std::strtof(item.c_str(), nullptr);
+            if (value <= 0.0f)
+            {
+                return false;
+            }
+            values.push_back(value);
+            text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+        }
+        return !values.empty();
+    }
+
+    bool ParseArguments(int argc, char **argv, SweepConfig &config)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            if (i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *value = argv[++i];
+            bool valid = true;
+            if (arg == "--fft")
+            {
+                valid = ParseSizes(value, config.fftSizes);
+            }
+            else if (arg == "--yin")
+            {
+                valid = ParseFloats(value, config.yinThresholds);
+            }
+            else if (arg == "--harmonics")
+            {
+                valid = ParseSizes(value, config.harmonicCounts);
+            }
+            else if (arg == "--accumulator")
+            {
+                valid = ParseSizes(value, config.accumulatorSizes);
+            }
+            else if (arg == "--history")
+            {
+                valid = ParseSizes(value, config.decayHistorySizes);
+            }
+            else if (arg == "--hop")
+            {
+                valid = ParseSizes(value, config.hopSizes);
+            }
+            else if (arg == "--rate")
+            {
+                config.sampleRate = std::strtof(value, nullptr);
+            }
+            else if (arg == "--note-seconds")
+            {
+                config.noteSeconds = std::strtod(value, nullptr);
+            }
+            else if (arg == "--corpus")
+            {
+                config.corpusPath = value;
+            }
+            else if (arg == "--threads")
+            {
+                config.threads = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+            }
+            else if (arg == "--json")
+            {
+                config.jsonPath = value;
+            }
+            else
+            {
+                valid = false;
+            }
+
+            if (!valid)
+            {
+                return false;
+            }
+        }
+
+        return config.sampleRate > 0.0f && config.noteSeconds > 0.0 && config.threads > 0;
+    }
+
+    void WriteJsonNumber(FILE *file, double value)
+    {
+        if (std::isnan(value))
+        {
+            std::fprintf(file, "null");
+        }
+        else
+        {
+            std::fprintf(file, "%.6g", value);
+        }
+    }
+
+    bool WriteJson(const std::string &path, const std::vector<std::unique_ptr<PointResult>> &results, size_t corpusSize)
+    {
+        FILE *file = std::fopen(path.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s for writing\n", path.c_str());
+            return false;
+        }
+
+        std::fprintf(file, "{\n  \"corpus_cases\": %zu,\n  \"points\": [\n", corpusSize);
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto &result = *results[i];
+            const auto &point = result.point;
+            std::fprintf(file,
+                "    {\"hop\": %u, \"fft\": %zu, \"yin_threshold\": %.4f, \"harmonics\": %zu, \"accumulator\": %zu, "
+                "\"history\": %zu, \"mean_abs_cents\": ",
+                point.hopSize,
+                point.fftSize,
+                static_cast<double>(point.yinThreshold),
+                point.numHarmonics,
+                point.pitchAccumulatorSize,
+                point.decayHistorySize);
+            WriteJsonNumber(file, result.meanAbsCents);
+            std::fprintf(file, ", \"lock_rate\": %.4f, \"buzz_auc\": ", result.lockRate);
+            WriteJsonNumber(file, result.buzzAuc);
+            std::fprintf(file, ", \"health_correlation\": ");
+            WriteJsonNumber(file, result.healthCorrelation);
+            std::fprintf(file,
+                ", \"us_per_hop\": {\"fret_buzz\": %.3f, \"intonation\": %.3f, \"string_health\": %.3f, "
+                "\"total\": %.3f}, \"budget_percent\": %.3f, \"pareto\": %s}%s\n",
+                result.analyzerMicros[0],
+                result.analyzerMicros[1],
+                result.analyzerMicros[2],
+                GetTotalMicros(result),
+                result.budgetPercent,
+                result.pareto ? "true" : "false",
+                i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+
+        std::fclose(file);
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    SweepConfig config;
+    if (!ParseArguments(argc, argv, config))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<CorpusCase> corpus;
+    if (!config.corpusPath.empty())
+    {
+        if (!LoadCorpus(config.corpusPath, corpus))
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        corpus = BuildSyntheticCorpus(config);
+    }
+
+    const std::vector<GridPoint> grid = BuildGrid(config);
+    std::printf("corpus=%zu cases grid=%zu points threads=%u\n\n", corpus.size(), grid.size(), config.threads);
+
+    // Workers pull grid points from a shared index; results land in grid order.
+    std::vector<std::unique_ptr<PointResult>> results(grid.size());
+    std::atomic<size_t> nextPoint(0);
+    std::atomic<size_t> completed(0);
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < std::min<size_t>(config.threads, grid.size()); ++t)
+    {
+        workers.emplace_back([&]() {
+            for (size_t index = nextPoint.fetch_add(1); index < grid.size(); index = nextPoint.fetch_add(1))
+            {
+                results[index] = EvaluatePoint(grid[index], corpus);
+                std::fprintf(stderr, "\r%zu/%zu", completed.fetch_add(1) + 1, grid.size());
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    std::fprintf(stderr, "\n");
+
+    MarkParetoFront(results);
+
+    PrintHeader();
+    for (const auto &result : results)
+    {
+        PrintResult(*result);
+    }
+
+    std::vector<const PointResult *> front;
+    for (const auto &result : results)
+    {
+        if (result->pareto)
+        {
+            front.push_back(result.get());
+        }
+    }
+    std::sort(front.begin(), front.end(), [](const PointResult *a, const PointResult *b) {
+        return GetTotalMicros(*a) < GetTotalMicros(*b);
+    });
+
+    std::printf("\nPareto-optimal settings by cost (%zu of %zu):\n", front.size(), results.size());
+    PrintHeader();
+    for (const auto *result : front)
+    {
+        PrintResult(*result);
+    }
+
+    if (!config.jsonPath.empty() && !WriteJson(config.jsonPath, results, corpus.size()))
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include "BenchmarkCommon.h"
+
+#include "Util/SignalGenerator.h"
+
+namespace GuitarDiagnostics::Benchmarks
+{
+
+    namespace
+    {
+        constexpr float g_kFundamental = 110.0f; ///< Fundamental of all tonal test signals (A2).
+    } // namespace
+
+    std::string GetSignalName(SignalType type)
+    {
+        switch (type)
+        {
+        case SignalType::Silence:
+            return "silence";
+        case SignalType::Sine:
+            return "sine";
+        case SignalType::Harmonic:
+            return "harmonic";
+        case SignalType::Pluck:
+            return "pluck";
+        case SignalType::Buzz:
+            return "buzz";
+        case SignalType::Noise:
+            return "noise";
+        }
+        return "unknown";
+    }
+
+    std::vector<float> GenerateSignal(SignalType type, float sampleRate)
+    {
+        const size_t numSamples = static_cast<size_t>(sampleRate);
+
+        Util::StringModelConfig stringConfig;
+        stringConfig.fundamental = g_kFundamental;
+
+        switch (type)
+        {
+        case SignalType::Sine:
+            return Util::GenerateSine(g_kFundamental, sampleRate, numSamples, 0.5f);
+        case SignalType::Harmonic:
+            return Util::GenerateHarmonicTone(g_kFundamental, sampleRate, numSamples);
+        case SignalType::Pluck:
+            return Util::GeneratePluckedString(stringConfig, sampleRate, numSamples);
+        case SignalType::Buzz:
+        {
+            Util::BuzzConfig buzz;
+            buzz.amplitude = 0.2f;
+            buzz.duration = 1.0f;
+            return Util::GeneratePluckedString(stringConfig, sampleRate, numSamples, buzz);
+        }
+        case SignalType::Noise:
+            return Util::GenerateWhiteNoise(numSamples, 0.3f);
+        case SignalType::Silence:
+            break;
+        }
+        return std::vector<float>(numSamples, 0.0f);
+    }
+
+    HopCursor::HopCursor(const std::vector<float> &signal, size_t hopSize)
+        : signal(signal), hopSize(hopSize), offset(0)
+    {
+    }
+
+    std::span<const float> HopCursor::Next()
+    {
+        if (offset + hopSize > signal.size())
+        {
+            offset = 0;
+        }
+
+        std::span<const float> hop(signal.data() + offset, hopSize);
+        offset += hopSize;
+        return hop;
+    }
+
+    void ReportHopCounters(benchmark::State &state, size_t hopSize, float sampleRate)
+    {
+        const double hopSeconds = static_cast<double>(hopSize) / static_cast<double>(sampleRate);
+        const double iterations = static_cast<double>(state.iterations());
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(hopSize));
+        state.counters["headroom"] = benchmark::Counter(hopSeconds * iterations, benchmark::Counter::kIsRate);
+        state.counters["budget_ns"] = benchmark::Counter(hopSeconds * 1e9);
+    }
+
+    const std::vector<int64_t> &GetBlockSizes()
+    {
+        static const std::vector<int64_t> blockSizes = { 128, 256, 512, 1024, 2048 };
+        return blockSizes;
+    }
+
+    const std::vector<int64_t> &GetSampleRates()
+    {
+        static const std::vector<int64_t> sampleRates = { 44100, 48000, 96000 };
+        return sampleRates;
+    }
+
+    const std::vector<int64_t> &GetSignalTypes()
+    {
+        static const std::vector<int64_t> signalTypes = {
+            static_cast<int64_t>(SignalType::Silence),
+            static_cast<int64_t>(SignalType::Sine),
+            static_cast<int64_t>(SignalType::Harmonic),
+            static_cast<int64_t>(SignalType::Pluck),
+            static_cast<int64_t>(SignalType::Buzz),
+            static_cast<int64_t>(SignalType::Noise),
+        };
+        return signalTypes;
+    }
+
+} // namespace GuitarDiagnostics::Benchmarks
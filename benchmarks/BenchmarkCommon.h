@@ -0,0 +1,97 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace GuitarDiagnostics::Benchmarks
+{
+
+    /**
+     * @brief Test signals fed to analyzers during benchmarking.
+     */
+    enum class SignalType : int64_t
+    {
+        Silence = 0, ///< All zeros (early-out paths).
+        Sine,        ///< Pure 110 Hz sine.
+        Harmonic,    ///< Five-harmonic 110 Hz tone.
+        Pluck,       ///< Decaying stiff-string pluck.
+        Buzz,        ///< Pluck with fret buzz bursts.
+        Noise        ///< Uniform white noise.
+    };
+
+    /**
+     * @brief Gets a short display name for a signal type.
+     * @param type Signal type.
+     * @return Display name used as the benchmark label.
+     */
+    std::string GetSignalName(SignalType type);
+
+    /**
+     * @brief Renders one second of the given signal.
+     * @param type Signal type.
+     * @param sampleRate Sample rate in Hz.
+     * @return Generated samples.
+     */
+    std::vector<float> GenerateSignal(SignalType type, float sampleRate);
+
+    /**
+     * @brief Cycles through a precomputed signal in fixed-size hops.
+     *
+     * Lets a benchmark loop feed realistic, changing content without generating audio inside the
+     * timed region.
+     */
+    class HopCursor
+    {
+    public:
+        /**
+         * @brief Constructs the HopCursor.
+         * @param signal Source signal; must outlive the cursor and hold at least one hop.
+         * @param hopSize Hop size in samples.
+         */
+        HopCursor(const std::vector<float> &signal, size_t hopSize);
+
+        /**
+         * @brief Returns the next hop and advances, wrapping at the end of the signal.
+         * @return View of hopSize samples.
+         */
+        std::span<const float> Next();
+
+    private:
+        const std::vector<float> &signal; ///< Source signal.
+        size_t hopSize;                   ///< Hop size in samples.
+        size_t offset;                    ///< Start of the next hop.
+    };
+
+    /**
+     * @brief Adds per-hop reporting to a benchmark whose iterations each process one hop.
+     *
+     * Reports samples/s, the realtime factor ("headroom": seconds of audio processed per second
+     * of CPU time, which must stay above 1 for live use) and the hop budget in nanoseconds. The
+     * Time column already reads as ns/hop.
+     * @param state Benchmark state.
+     * @param hopSize Samples per hop.
+     * @param sampleRate Sample rate in Hz.
+     */
+    void ReportHopCounters(benchmark::State &state, size_t hopSize, float sampleRate);
+
+    /**
+     * @brief Block sizes exercised by the per-hop benchmarks.
+     */
+    const std::vector<int64_t> &GetBlockSizes();
+
+    /**
+     * @brief Sample rates exercised by the per-hop benchmarks.
+     */
+    const std::vector<int64_t> &GetSampleRates();
+
+    /**
+     * @brief All signal types as benchmark arguments.
+     */
+    const std::vector<int64_t> &GetSignalTypes();
+
+} // namespace GuitarDiagnostics::Benchmarks
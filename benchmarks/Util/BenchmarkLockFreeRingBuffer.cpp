@@ -0,0 +1,56 @@
+#include "Util/LockFreeRingBuffer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    constexpr size_t g_kRingBufferCapacity = 16384; ///< Matches the application ring buffer.
+
+    /**
+     * @brief Measures a single-threaded write followed by a read of the same block.
+     *
+     * Argument: block size in samples.
+     */
+    void BM_RingBufferWriteRead(benchmark::State &state)
+    {
+        const auto blockSize = static_cast<size_t>(state.range(0));
+
+        LockFreeRingBuffer<float> ringBuffer(g_kRingBufferCapacity);
+        std::vector<float> input(blockSize, 0.5f);
+        std::vector<float> output(blockSize, 0.0f);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ringBuffer.Write(input));
+            benchmark::DoNotOptimize(ringBuffer.Read(output));
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(2 * blockSize * sizeof(float)));
+    }
+
+    /**
+     * @brief Measures the availability queries polled by producer and consumer.
+     */
+    void BM_RingBufferAvailability(benchmark::State &state)
+    {
+        LockFreeRingBuffer<float> ringBuffer(g_kRingBufferCapacity);
+        std::vector<float> input(512, 0.5f);
+        ringBuffer.Write(input);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ringBuffer.GetAvailableRead());
+            benchmark::DoNotOptimize(ringBuffer.GetAvailableWrite());
+        }
+    }
+
+} // namespace
+
+BENCHMARK(BM_RingBufferWriteRead)->RangeMultiplier(2)->Range(64, 4096);
+BENCHMARK(BM_RingBufferAvailability);
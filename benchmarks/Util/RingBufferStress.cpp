@@ -0,0 +1,617 @@
+/**
+ * @file RingBufferStress.cpp
+ * @brief Producer/consumer stress and latency harness for LockFreeRingBuffer.
+ *
+ * A producer thread emulates an audio callback (paced at block cadence, or free-running to find
+ * the throughput ceiling) and a consumer thread emulates the analysis worker (poll, read, do some
+ * work). Reports per-item latency percentiles, producer wake-up jitter, overflow rate and peak
+ * fill for each ring capacity, plus hardware cache-miss counts where perf counters are available.
+ *
+ * Example: pick a capacity for 128-frame callbacks against a worker that sleeps 1 ms when idle
+ *   GuitarDiagnosticsRingBufferStress --block 128 --capacity 2048,4096,8192,16384 --poll-us 1000
+ */
+
+#include "Util/LatencyHistogram.h"
+#include "Util/LockFreeRingBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Harness parameters, settable from the command line.
+     */
+    struct StressConfig
+    {
+        uint32_t blockSize;             ///< Producer block size in samples.
+        uint32_t consumerBlockSize;     ///< Consumer read size in samples.
+        float sampleRate;               ///< Emulated device sample rate in Hz.
+        std::vector<size_t> capacities; ///< Ring capacities to sweep.
+        double seconds;                 ///< Duration of each run.
+        uint32_t pairs;                 ///< Independent producer/consumer pairs run concurrently.
+        bool paced;                     ///< Emulate device cadence (false: run as fast as possible).
+        uint32_t pollMicros;            ///< Consumer sleep when not enough data is available.
+        uint32_t workMicros;            ///< Simulated analysis cost per consumer read.
+        std::string jsonPath;           ///< Optional JSON output file.
+
+        StressConfig();
+    };
+
+    StressConfig::StressConfig()
+        : blockSize(512), consumerBlockSize(512), sampleRate(48000.0f), capacities{ 16384 }, seconds(2.0), pairs(1),
+          paced(true), pollMicros(1000), workMicros(0), jsonPath()
+    {
+    }
+
+    /**
+     * @brief Per-thread hardware cache-miss counter (Linux perf_event); inert elsewhere.
+     */
+    class CacheMissCounter
+    {
+    public:
+        CacheMissCounter();
+
+        ~CacheMissCounter();
+
+        CacheMissCounter(const CacheMissCounter &) = delete;
+
+        CacheMissCounter &operator=(const CacheMissCounter &) = delete;
+
+        CacheMissCounter(CacheMissCounter &&) = delete;
+
+        CacheMissCounter &operator=(CacheMissCounter &&) = delete;
+
+        /**
+         * @brief Reads the counter.
+         * @return Cache misses of the calling thread since construction, -1 if unavailable.
+         */
+        int64_t Read() const;
+
+    private:
+        int fd; ///< perf_event file descriptor, -1 if unavailable.
+    };
+
+    CacheMissCounter::CacheMissCounter() : fd(-1)
+    {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    CacheMissCounter::~CacheMissCounter()
+    {
+#if defined(__linux__)
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+#endif
+    }
+
+    int64_t CacheMissCounter::Read() const
+    {
+#if defined(__linux__)
+        uint64_t value = 0;
+        if (fd >= 0 && read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value)))
+        {
+            return static_cast<int64_t>(value);
+        }
+#endif
+        return -1;
+    }
+
+    /**
+     * @brief Measurements of one producer/consumer pair.
+     */
+    struct PairResult
+    {
+        LatencyHistogram latency;    ///< Publish-to-read latency per item.
+        LatencyHistogram jitter;     ///< Producer wake-up lateness (paced mode only).
+        uint64_t blocksProduced;     ///< Blocks attempted by the producer.
+        uint64_t blocksDropped;      ///< Blocks rejected because the ring was full.
+        uint64_t producerStalls;     ///< Free-running producer spins on a full ring.
+        uint64_t itemsConsumed;      ///< Samples read by the consumer.
+        size_t peakFill;             ///< Highest ring occupancy seen by the consumer.
+        double elapsedSeconds;       ///< Wall time from start to consumer exit.
+        int64_t producerCacheMisses; ///< Producer thread cache misses, -1 if unavailable.
+        int64_t consumerCacheMisses; ///< Consumer thread cache misses, -1 if unavailable.
+
+        PairResult();
+    };
+
+    PairResult::PairResult()
+        : latency(), jitter(), blocksProduced(0), blocksDropped(0), producerStalls(0), itemsConsumed(0), peakFill(0),
+          elapsedSeconds(0.0), producerCacheMisses(-1), consumerCacheMisses(-1)
+    {
+    }
+
+    uint64_t ToNanoseconds(Clock::time_point time)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Runs one producer/consumer pair for the configured duration.
+     */
+    void RunPair(const StressConfig &config, size_t capacity, PairResult &result)
+    {
+        LockFreeRingBuffer<float> ringBuffer(capacity);
+
+        // Publish times of blocks still in flight. A slot is reused only after the ring has
+        // wrapped twice, so the consumer can read it safely before consuming the block.
+        const size_t slotCount = 2 * (capacity / config.blockSize + 2);
+        std::vector<uint64_t> publishTimes(slotCount, 0);
+
+        std::atomic<bool> producerDone(false);
+        const auto start = Clock::now();
+        const auto deadline = start + std::chrono::duration_cast<Clock::duration>(
+                                          std::chrono::duration<double>(config.seconds));
+        const auto period = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(config.blockSize) / config.sampleRate));
+
+        std::thread producer([&]() {
+            CacheMissCounter cacheMisses;
+            std::vector<float> block(config.blockSize, 0.0f);
+            uint64_t published = 0;
+            auto nextRelease = start;
+
+            while (Clock::now() < deadline)
+            {
+                if (config.paced)
+                {
+                    std::this_thread::sleep_until(nextRelease);
+                    const auto wake = Clock::now();
+                    result.jitter.Record(static_cast<uint64_t>(std::max<int64_t>(
+                        0, std::chrono::duration_cast<std::chrono::nanoseconds>(wake - nextRelease).count())));
+                    nextRelease += period;
+                }
+
+                ++result.blocksProduced;
+
+                bool accepted = false;
+                while (true)
+                {
+                    publishTimes[published % slotCount] = ToNanoseconds(Clock::now());
+                    if (ringBuffer.Write(block))
+                    {
+                        accepted = true;
+                        break;
+                    }
+                    if (config.paced || Clock::now() >= deadline)
+                    {
+                        break;
+                    }
+                    ++result.producerStalls;
+                    std::this_thread::yield();
+                }
+
+                if (accepted)
+                {
+                    ++published;
+                }
+                else if (config.paced)
+                {
+                    ++result.blocksDropped;
+                }
+            }
+
+            result.producerCacheMisses = cacheMisses.Read();
+            producerDone.store(true, std::memory_order_release);
+        });
+
+        std::thread consumer([&]() {
+            CacheMissCounter cacheMisses;
+            std::vector<float> chunk(config.consumerBlockSize, 0.0f);
+            std::vector<uint64_t> chunkPublishTimes(config.consumerBlockSize / config.blockSize + 2, 0);
+            uint64_t consumed = 0;
+
+            while (true)
+            {
+                const bool finished = producerDone.load(std::memory_order_acquire);
+                const size_t available = ringBuffer.GetAvailableRead();
+                result.peakFill = std::max(result.peakFill, available);
+
+                if (available < config.consumerBlockSize && !(finished && available > 0))
+                {
+                    if (finished)
+                    {
+                        break;
+                    }
+                    if (config.pollMicros > 0)
+                    {
+                        std::this_thread::sleep_for(std::chrono::microseconds(config.pollMicros));
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                    continue;
+                }
+
+                const size_t toRead = std::min<size_t>(available, config.consumerBlockSize);
+                const uint64_t firstBlock = consumed / config.blockSize;
+                const uint64_t lastBlock = (consumed + toRead - 1) / config.blockSize;
+                for (uint64_t b = firstBlock; b <= lastBlock; ++b)
+                {
+                    chunkPublishTimes[b - firstBlock] = publishTimes[b % slotCount];
+                }
+
+                const size_t samplesRead = ringBuffer.Read(std::span<float>(chunk.data(), toRead));
+                const uint64_t now = ToNanoseconds(Clock::now());
+
+                uint64_t item = consumed;
+                while (item < consumed + samplesRead)
+                {
+                    const uint64_t b = item / config.blockSize;
+                    const uint64_t blockEnd = std::min<uint64_t>((b + 1) * config.blockSize, consumed + samplesRead);
+                    const uint64_t published = chunkPublishTimes[b - firstBlock];
+                    result.latency.Record(now > published ? now - published : 0, blockEnd - item);
+                    item = blockEnd;
+                }
+                consumed += samplesRead;
+
+                if (config.workMicros > 0)
+                {
+                    const auto workEnd = Clock::now() + std::chrono::microseconds(config.workMicros);
+                    while (Clock::now() < workEnd)
+                    {
+                    }
+                }
+            }
+
+            result.itemsConsumed = consumed;
+            result.consumerCacheMisses = cacheMisses.Read();
+        });
+
+        producer.join();
+        consumer.join();
+        result.elapsedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief Aggregate of all pairs for one capacity.
+     */
+    struct CapacityResult
+    {
+        size_t capacity;             ///< Ring capacity in samples.
+        LatencyHistogram latency;    ///< Merged item latency.
+        LatencyHistogram jitter;     ///< Merged producer jitter.
+        uint64_t blocksProduced;     ///< Total producer blocks.
+        uint64_t blocksDropped;      ///< Total dropped blocks.
+        uint64_t producerStalls;     ///< Total producer full-ring spins.
+        uint64_t itemsConsumed;      ///< Total samples consumed.
+        size_t peakFill;             ///< Highest fill across pairs.
+        double throughput;           ///< Consumed samples per second, summed over pairs.
+        int64_t producerCacheMisses; ///< Summed producer cache misses, -1 if unavailable.
+        int64_t consumerCacheMisses; ///< Summed consumer cache misses, -1 if unavailable.
+
+        explicit CapacityResult(size_t capacity);
+    };
+
+    CapacityResult::CapacityResult(size_t capacity)
+        : capacity(capacity), latency(), jitter(), blocksProduced(0), blocksDropped(0), producerStalls(0),
+          itemsConsumed(0), peakFill(0), throughput(0.0), producerCacheMisses(0), consumerCacheMisses(0)
+    {
+    }
+
+    void Accumulate(CapacityResult &total, const PairResult &pair)
+    {
+        total.latency.Merge(pair.latency);
+        total.jitter.Merge(pair.jitter);
+        total.blocksProduced += pair.blocksProduced;
+        total.blocksDropped += pair.blocksDropped;
+        total.producerStalls += pair.producerStalls;
+        total.itemsConsumed += pair.itemsConsumed;
+        total.peakFill = std::max(total.peakFill, pair.peakFill);
+        total.throughput += pair.elapsedSeconds > 0.0 ? static_cast<double>(pair.itemsConsumed) / pair.elapsedSeconds : 0.0;
+
+        total.producerCacheMisses = (total.producerCacheMisses < 0 || pair.producerCacheMisses < 0)
+                                        ? -1
+                                        : total.producerCacheMisses + pair.producerCacheMisses;
+        total.consumerCacheMisses = (total.consumerCacheMisses < 0 || pair.consumerCacheMisses < 0)
+                                        ? -1
+                                        : total.consumerCacheMisses + pair.consumerCacheMisses;
+    }
+
+    double GetOverflowRate(const CapacityResult &result)
+    {
+        return result.blocksProduced == 0
+                   ? 0.0
+                   : static_cast<double>(result.blocksDropped) / static_cast<double>(result.blocksProduced);
+    }
+
+    double ToMicros(uint64_t nanoseconds)
+    {
+        return static_cast<double>(nanoseconds) / 1000.0;
+    }
+
+    void PrintUsage(const char *program)
+    {
+        std::printf("Usage: %s [options]\n"
+                    "  --block N          producer block size in samples (default 512)\n"
+                    "  --consumer-block N consumer read size in samples (default: same as --block)\n"
+                    "  --rate HZ          emulated sample rate (default 48000)\n"
+                    "  --capacity A,B,... ring capacities to sweep (default 16384)\n"
+                    "  --seconds S        duration per capacity (default 2)\n"
+                    "  --pairs N          concurrent producer/consumer pairs (default 1)\n"
+                    "  --free             run the producer as fast as possible (throughput ceiling)\n"
+                    "  --poll-us N        consumer idle sleep in microseconds, 0 = yield (default 1000)\n"
+                    "  --work-us N        simulated analysis time per read in microseconds (default 0)\n"
+                    "  --json FILE        write results as JSON\n",
+            program);
+    }
+
+    bool ParseCapacities(std::string_view text, std::vector<size_t> &capacities)
+    {
+        capacities.clear();
+        while (!text.empty())
+        {
+            const size_t comma = text.find(',');
+            const std::string item(text.substr(0, comma));
+            const auto value = std::strtoull(item.c_str(), nullptr, 10);
+            if (value == 0)
+            {
+                return false;
+            }
+            capacities.push_back(static_cast<size_t>(value));
+            text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+        }
+        return !capacities.empty();
+    }
+
+    bool ParseArguments(int argc, char **argv, StressConfig &config)
+    {
+        bool consumerBlockSet = false;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--free")
+            {
+                config.paced = false;
+            }
+            else if (arg == "--block" && hasValue)
+            {
+                config.blockSize = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--consumer-block" && hasValue)
+            {
+                config.consumerBlockSize = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+                consumerBlockSet = true;
+            }
+            else if (arg == "--rate" && hasValue)
+            {
+                config.sampleRate = std::strtof(argv[++i], nullptr);
+            }
+            else if (arg == "--capacity" && hasValue)
+            {
+                if (!ParseCapacities(argv[++i], config.capacities))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--seconds" && hasValue)
+            {
+                config.seconds = std::strtod(argv[++i], nullptr);
+            }
+            else if (arg == "--pairs" && hasValue)
+            {
+                config.pairs = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--poll-us" && hasValue)
+            {
+                config.pollMicros = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--work-us" && hasValue)
+            {
+                config.workMicros = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--json" && hasValue)
+            {
+                config.jsonPath = argv[++i];
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if (!consumerBlockSet)
+        {
+            config.consumerBlockSize = config.blockSize;
+        }
+
+        return config.blockSize > 0 && config.consumerBlockSize > 0 && config.sampleRate > 0.0f
+               && config.seconds > 0.0 && config.pairs > 0;
+    }
+
+    void PrintResults(const StressConfig &config, const std::vector<std::unique_ptr<CapacityResult>> &results)
+    {
+        std::printf("block=%u consumer-block=%u rate=%.0f pairs=%u mode=%s poll=%uus work=%uus seconds=%.1f\n\n",
+            config.blockSize,
+            config.consumerBlockSize,
+            static_cast<double>(config.sampleRate),
+            config.pairs,
+            config.paced ? "paced" : "free",
+            config.pollMicros,
+            config.workMicros,
+            config.seconds);
+
+        std::printf("%10s %10s %10s %10s %10s %10s %9s %9s %12s %12s %12s\n",
+            "capacity",
+            "p50 us",
+            "p99 us",
+            "p99.9 us",
+            "max us",
+            "jit99 us",
+            "overflow",
+            "peak",
+            "Msamples/s",
+            "prod miss",
+            "cons miss");
+
+        for (const auto &result : results)
+        {
+            std::printf("%10zu %10.1f %10.1f %10.1f %10.1f %10.1f %8.3f%% %9zu %12.2f %12lld %12lld\n",
+                result->capacity,
+                ToMicros(result->latency.GetPercentile(50.0)),
+                ToMicros(result->latency.GetPercentile(99.0)),
+                ToMicros(result->latency.GetPercentile(99.9)),
+                ToMicros(result->latency.GetMax()),
+                ToMicros(result->jitter.GetPercentile(99.0)),
+                GetOverflowRate(*result) * 100.0,
+                result->peakFill,
+                result->throughput / 1e6,
+                static_cast<long long>(result->producerCacheMisses),
+                static_cast<long long>(result->consumerCacheMisses));
+        }
+    }
+
+    bool WriteJson(const StressConfig &config, const std::vector<std::unique_ptr<CapacityResult>> &results)
+    {
+        FILE *file = std::fopen(config.jsonPath.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s for writing\n", config.jsonPath.c_str());
+            return false;
+        }
+
+        std::fprintf(file,
+            "{\n  \"config\": {\"block\": %u, \"consumer_block\": %u, \"rate\": %.1f, \"pairs\": %u, "
+            "\"paced\": %s, \"poll_us\": %u, \"work_us\": %u, \"seconds\": %.3f},\n  \"results\": [\n",
+            config.blockSize,
+            config.consumerBlockSize,
+            static_cast<double>(config.sampleRate),
+            config.pairs,
+            config.paced ? "true" : "false",
+            config.pollMicros,
+            config.workMicros,
+            config.seconds);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto &result = *results[i];
+            std::fprintf(file,
+                "    {\"capacity\": %zu, \"latency_ns\": {\"p50\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu, "
+                "\"mean\": %.1f}, \"jitter_ns\": {\"p50\": %llu, \"p99\": %llu, \"max\": %llu}, "
+                "\"blocks_produced\": %llu, \"blocks_dropped\": %llu, \"overflow_rate\": %.6f, "
+                "\"producer_stalls\": %llu, \"items_consumed\": %llu, \"peak_fill\": %zu, "
+                "\"throughput_sps\": %.1f, \"producer_cache_misses\": %lld, \"consumer_cache_misses\": %lld}%s\n",
+                result.capacity,
+                static_cast<unsigned long long>(result.latency.GetPercentile(50.0)),
+                static_cast<unsigned long long>(result.latency.GetPercentile(99.0)),
+                static_cast<unsigned long long>(result.latency.GetPercentile(99.9)),
+                static_cast<unsigned long long>(result.latency.GetMax()),
+                result.latency.GetMean(),
+                static_cast<unsigned long long>(result.jitter.GetPercentile(50.0)),
+                static_cast<unsigned long long>(result.jitter.GetPercentile(99.0)),
+                static_cast<unsigned long long>(result.jitter.GetMax()),
+                static_cast<unsigned long long>(result.blocksProduced),
+                static_cast<unsigned long long>(result.blocksDropped),
+                GetOverflowRate(result),
+                static_cast<unsigned long long>(result.producerStalls),
+                static_cast<unsigned long long>(result.itemsConsumed),
+                result.peakFill,
+                result.throughput,
+                static_cast<long long>(result.producerCacheMisses),
+                static_cast<long long>(result.consumerCacheMisses),
+                i + 1 < results.size() ? "," : "");
+        }
+
+        std::fprintf(file, "  ]\n}\n");
+        std::fclose(file);
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    StressConfig config;
+    if (!ParseArguments(argc, argv, config))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<CapacityResult>> results;
+
+    for (size_t capacity : config.capacities)
+    {
+        if (capacity < config.blockSize)
+        {
+            std::fprintf(stderr, "Skipping capacity %zu: smaller than one block\n", capacity);
+            continue;
+        }
+
+        std::vector<std::unique_ptr<PairResult>> pairResults;
+        std::vector<std::thread> pairThreads;
+        for (uint32_t pair = 0; pair < config.pairs; ++pair)
+        {
+            pairResults.push_back(std::make_unique<PairResult>());
+        }
+        for (uint32_t pair = 0; pair < config.pairs; ++pair)
+        {
+            pairThreads.emplace_back(RunPair, std::cref(config), capacity, std::ref(*pairResults[pair]));
+        }
+        for (auto &thread : pairThreads)
+        {
+            thread.join();
+        }
+
+        auto total = std::make_unique<CapacityResult>(capacity);
+        for (const auto &pairResult : pairResults)
+        {
+            Accumulate(*total, *pairResult);
+        }
+        results.push_back(std::move(total));
+    }
+
+    PrintResults(config, results);
+
+    if (!config.jsonPath.empty() && !WriteJson(config, results))
+    {
+        return 1;
+    }
+
+    return 0;
+}
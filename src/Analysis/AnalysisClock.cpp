@@ -0,0 +1,79 @@
+#include "Analysis/AnalysisClock.h"
+
+#include <cmath>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    void AnalysisClock::OnHop([[maybe_unused]] size_t frames) noexcept
+    {
+    }
+
+    AnalysisClock::Duration AnalysisClock::FramesToDuration(uint64_t frames, float sampleRate) noexcept
+    {
+        if (sampleRate <= 0.0f)
+        {
+            return Duration(0);
+        }
+        const double nanoseconds = static_cast<double>(frames) * 1e9 / static_cast<double>(sampleRate);
+        return Duration(static_cast<Duration::rep>(std::llround(nanoseconds)));
+    }
+
+    SteadyClock &SteadyClock::GetInstance()
+    {
+        static SteadyClock instance;
+        return instance;
+    }
+
+    AnalysisClock::Duration SteadyClock::Now() const noexcept
+    {
+        return std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now().time_since_epoch());
+    }
+
+    SampleClock::SampleClock(float sampleRate)
+        : AnalysisClock(), nanosecondsPerFrame(sampleRate > 0.0f ? 1e9 / static_cast<double>(sampleRate) : 0.0),
+          frames(0)
+    {
+    }
+
+    AnalysisClock::Duration SampleClock::Now() const noexcept
+    {
+        const double elapsed = static_cast<double>(frames.load(std::memory_order_relaxed)) * nanosecondsPerFrame;
+        return Duration(static_cast<Duration::rep>(std::llround(elapsed)));
+    }
+
+    void SampleClock::OnHop(size_t hopFrames) noexcept
+    {
+        frames.fetch_add(hopFrames, std::memory_order_relaxed);
+    }
+
+    uint64_t SampleClock::GetFrames() const noexcept
+    {
+        return frames.load(std::memory_order_relaxed);
+    }
+
+    void SampleClock::Reset() noexcept
+    {
+        frames.store(0, std::memory_order_relaxed);
+    }
+
+    ManualClock::ManualClock() : AnalysisClock(), nanoseconds(0)
+    {
+    }
+
+    AnalysisClock::Duration ManualClock::Now() const noexcept
+    {
+        return Duration(nanoseconds.load(std::memory_order_relaxed));
+    }
+
+    void ManualClock::Advance(Duration duration) noexcept
+    {
+        nanoseconds.fetch_add(duration.count(), std::memory_order_relaxed);
+    }
+
+    void ManualClock::Set(Duration time) noexcept
+    {
+        nanoseconds.store(time.count(), std::memory_order_relaxed);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
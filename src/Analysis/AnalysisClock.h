@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Time source for timing-dependent analysis logic, such as how long a pitch has been stable.
+     *
+     * Analyzers read the clock handed to them in AnalysisConfig instead of std::chrono clocks, so
+     * the same logic runs against the wall clock live, against the amount of audio processed in
+     * batch and simulation runs, or against a clock a test steps by hand. Times are durations
+     * since the clock's own epoch; only differences between readings of one clock are meaningful.
+     */
+    class AnalysisClock
+    {
+    public:
+        using Duration = std::chrono::nanoseconds; ///< Resolution of every clock.
+
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~AnalysisClock() = default;
+
+        /**
+         * @brief Gets the current time. Safe to call from any thread.
+         * @return Time since the clock's epoch.
+         */
+        virtual Duration Now() const noexcept = 0;
+
+        /**
+         * @brief Tells the clock that new audio is about to be analyzed.
+         *
+         * Called on the analysis thread by AnalysisEngine and StaticPipeline before the analyzers
+         * see the frames: once per hop, or once per fast-path block when the engine has a fast path.
+         * The default implementation ignores it.
+         * @param frames Frames about to be analyzed.
+         */
+        virtual void OnHop(size_t frames) noexcept;
+
+        /**
+         * @brief Converts a number of frames to a duration.
+         * @param frames Frame count.
+         * @param sampleRate Sample rate in Hz.
+         * @return Duration of the frames, rounded to the nanosecond; zero for a non-positive rate.
+         */
+        static Duration FramesToDuration(uint64_t frames, float sampleRate) noexcept;
+
+    protected:
+        AnalysisClock() = default;
+
+        AnalysisClock(const AnalysisClock &) = delete;
+
+        AnalysisClock(AnalysisClock &&) = delete;
+
+        AnalysisClock &operator=(const AnalysisClock &) = delete;
+
+        AnalysisClock &operator=(AnalysisClock &&) = delete;
+    };
+
+    /**
+     * @brief Wall time from std::chrono::steady_clock; the default for live input.
+     */
+    class SteadyClock final : public AnalysisClock
+    {
+    public:
+        /**
+         * @brief Gets the process-wide instance used when AnalysisConfig names no clock.
+         * @return Steady clock.
+         */
+        static SteadyClock &GetInstance();
+
+        Duration Now() const noexcept override;
+
+    private:
+        SteadyClock() = default;
+    };
+
+    /**
+     * @brief Time derived from the number of frames analyzed: each hop advances it by its duration.
+     *
+     * Makes timing decisions depend only on the audio, so a recording analyzed faster than real
+     * time (or a stalled live stream) behaves exactly like the same audio played in real time.
+     */
+    class SampleClock final : public AnalysisClock
+    {
+    public:
+        /**
+         * @brief Constructs the SampleClock at time zero.
+         * @param sampleRate Sample rate of the analyzed frames in Hz.
+         */
+        explicit SampleClock(float sampleRate);
+
+        Duration Now() const noexcept override;
+
+        void OnHop(size_t frames) noexcept override;
+
+        /**
+         * @brief Gets the number of frames counted so far.
+         * @return Frames since construction or Reset().
+         */
+        uint64_t GetFrames() const noexcept;
+
+        /**
+         * @brief Returns to time zero.
+         */
+        void Reset() noexcept;
+
+    private:
+        double nanosecondsPerFrame;   ///< 1e9 / sample rate.
+        std::atomic<uint64_t> frames; ///< Frames counted, written by the analysis thread.
+    };
+
+    /**
+     * @brief Clock that only moves when told to, for tests.
+     */
+    class ManualClock final : public AnalysisClock
+    {
+    public:
+        /**
+         * @brief Constructs the ManualClock at time zero.
+         */
+        ManualClock();
+
+        Duration Now() const noexcept override;
+
+        /**
+         * @brief Moves the clock forward.
+         * @param duration Time to add.
+         */
+        void Advance(Duration duration) noexcept;
+
+        /**
+         * @brief Sets the current time.
+         * @param time Time since the epoch.
+         */
+        void Set(Duration time) noexcept;
+
+    private:
+        std::atomic<int64_t> nanoseconds; ///< Current time.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
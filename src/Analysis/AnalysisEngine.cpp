@@ -1,14 +1,48 @@
 #include "Analysis/AnalysisEngine.h"
 
+#include "Analysis/AnalysisClock.h"
+#include "Util/AllocationGuard.h"
+#include "Util/Tracer.h"
+
+#include <Logger.h>
+
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
 
 namespace GuitarDiagnostics::Analysis
 {
 
+    namespace
+    {
+        constexpr size_t g_kCommandQueueCapacity = 64; ///< Control commands that can wait for one hop boundary.
+    } // namespace
+
+    EngineCommand::EngineCommand()
+        : type(EngineCommandType::Reset), parameters(nullptr), analyzerIndex(0), enabled(true), completion()
+    {
+    }
+
     AnalysisEngine::AnalysisEngine(Util::LockFreeRingBuffer<float> *ringBuffer, const AnalysisConfig &config)
-        : ringBuffer(ringBuffer), config(config), analyzers(), processingBuffer(config.bufferSize), running(false),
+        : ringBuffer(ringBuffer), config(config), analyzers(), analyzerEnabled(), processingBuffer(config.bufferSize),
+          resampler(), inputBuffer(), pendingSamples(0), fastFrames(0), maxBatchHops(1), metrics(),
+          parameterStore(nullptr), appliedParameters(nullptr), resultListener(), resultSequence(0),
+          commands(g_kCommandQueueCapacity), drainingCommands(false), externallyDriven(false), running(false),
           workerThread()
     {
+        if (this->config.fastBlockSize > 0 && config.bufferSize % this->config.fastBlockSize != 0)
+        {
+            LOG_ERROR("Fast block size {} does not divide the hop size {}, fast path disabled",
+                this->config.fastBlockSize,
+                config.bufferSize);
+            this->config.fastBlockSize = 0;
+        }
+
+        const double hopSeconds = config.sampleRate > 0.0f
+                                      ? static_cast<double>(config.bufferSize) / static_cast<double>(config.sampleRate)
+                                      : 0.0;
+        metrics.Configure(static_cast<uint64_t>(hopSeconds * 1e9), ringBuffer ? ringBuffer->GetCapacity() : 0);
     }
 
     AnalysisEngine::~AnalysisEngine()
@@ -18,6 +52,12 @@ namespace GuitarDiagnostics::Analysis
 
     bool AnalysisEngine::Start()
     {
+        if (externallyDriven.load())
+        {
+            LOG_ERROR("Cannot start the worker thread of an engine driven by a worker pool");
+            return false;
+        }
+
         bool expected = false;
         if (!running.compare_exchange_strong(expected, true))
         {
@@ -43,48 +83,364 @@ namespace GuitarDiagnostics::Analysis
         return running.load();
     }
 
+    void AnalysisEngine::SetExternallyDriven(bool driven) noexcept
+    {
+        externallyDriven.store(driven);
+
+        // Commands queued while the pool was stopping would otherwise wait for a hop that never comes.
+        if (!driven && !running.load())
+        {
+            DrainCommands();
+        }
+    }
+
     void AnalysisEngine::RegisterAnalyzer(std::shared_ptr<Analyzer> analyzer)
     {
         if (analyzer)
         {
             analyzer->Configure(config);
+            metrics.AddAnalyzer(analyzer->GetName());
             analyzers.push_back(analyzer);
+            analyzerEnabled.push_back(1);
         }
     }
 
-    void AnalysisEngine::Reset()
+    void AnalysisEngine::SetParameterStore(const ParameterStore *store)
+    {
+        parameterStore = store;
+        appliedParameters = nullptr;
+    }
+
+    void AnalysisEngine::SetResultListener(ResultListener listener)
+    {
+        resultListener = std::move(listener);
+    }
+
+    bool AnalysisEngine::SetInputSampleRate(float inputSampleRate)
     {
-        for (auto &analyzer : analyzers)
+        if (std::abs(inputSampleRate - config.sampleRate) < 0.5f)
         {
-            analyzer->Reset();
+            return true;
         }
+
+        // One hop's (or fast block's) worth of input per read; the processing buffer also holds the overshoot.
+        const uint32_t readFrames = config.fastBlockSize > 0 ? config.fastBlockSize : config.bufferSize;
+        const auto inputHop = static_cast<size_t>(
+            std::ceil(static_cast<double>(readFrames) * inputSampleRate / config.sampleRate));
+        if (!resampler.Configure(inputSampleRate, config.sampleRate, inputHop))
+        {
+            return false;
+        }
+
+        inputBuffer.assign(inputHop, 0.0f);
+        ResizeProcessingBuffer();
+        return true;
     }
 
-    void AnalysisEngine::WorkerThreadFunction()
+    bool AnalysisEngine::SetMaxBatchHops(size_t hops)
     {
-        std::span<float> bufferSpan(processingBuffer.data(), processingBuffer.size());
+        if (hops == 0 || (hops > 1 && config.fastBlockSize > 0))
+        {
+            LOG_ERROR("Cannot batch {} hops{}", hops, config.fastBlockSize > 0 ? " with the fast path enabled" : "");
+            return false;
+        }
 
-        while (running.load())
+        maxBatchHops = hops;
+        ResizeProcessingBuffer();
+        return true;
+    }
+
+    void AnalysisEngine::ResizeProcessingBuffer()
+    {
+        const size_t overshoot = resampler.IsConfigured() ? resampler.GetMaxOutputSize(inputBuffer.size()) : 0;
+        processingBuffer.assign(maxBatchHops * config.bufferSize + overshoot, 0.0f);
+        pendingSamples = 0;
+        fastFrames = 0;
+    }
+
+    std::future<bool> AnalysisEngine::Reset()
+    {
+        return Submit(EngineCommand());
+    }
+
+    std::future<bool> AnalysisEngine::ApplyParameters(const AnalyzerParameters *parameters)
+    {
+        EngineCommand command;
+        command.type = EngineCommandType::ApplyParameters;
+        command.parameters = parameters;
+        return Submit(std::move(command));
+    }
+
+    std::future<bool> AnalysisEngine::SetAnalyzerEnabled(size_t analyzerIndex, bool enabled)
+    {
+        EngineCommand command;
+        command.type = EngineCommandType::SetAnalyzerEnabled;
+        command.analyzerIndex = analyzerIndex;
+        command.enabled = enabled;
+        return Submit(std::move(command));
+    }
+
+    std::future<bool> AnalysisEngine::Submit(EngineCommand command)
+    {
+        std::future<bool> completion = command.completion.get_future();
+        if (!commands.TryPush(std::move(command)))
+        {
+            LOG_ERROR("Analysis command queue is full, dropping command {}", static_cast<int>(command.type));
+            command.completion.set_value(false);
+            return completion;
+        }
+
+        // Nothing drains the queue between hops while no thread drives the engine; run the command here instead.
+        if (!running.load() && !externallyDriven.load())
+        {
+            DrainCommands();
+        }
+        return completion;
+    }
+
+    void AnalysisEngine::DrainCommands() noexcept
+    {
+        // One consumer at a time. A thread that loses the race leaves its command to the winner,
+        // which looks at the queue again after letting go so nothing pushed meanwhile is stranded.
+        // An empty queue, the common case on every hop and idle poll, returns before the pop target
+        // is built: its promise allocates a shared state.
+        if (commands.IsEmpty())
+        {
+            return;
+        }
+
+        do
         {
-            size_t available = ringBuffer->GetAvailableRead();
+            bool expected = false;
+            if (!drainingCommands.compare_exchange_strong(expected, true))
+            {
+                return;
+            }
+
+            EngineCommand command;
+            while (commands.TryPop(command))
+            {
+                ExecuteCommand(command);
+            }
 
-            if (available >= config.bufferSize)
+            drainingCommands.store(false);
+        } while (!commands.IsEmpty());
+    }
+
+    void AnalysisEngine::ExecuteCommand(EngineCommand &command) noexcept
+    {
+        GD_TRACE_SCOPE("engine", "Command");
+
+        bool applied = true;
+        switch (command.type)
+        {
+        case EngineCommandType::Reset:
+            for (auto &analyzer : analyzers)
             {
-                size_t samplesRead = ringBuffer->Read(bufferSpan);
+                analyzer->Reset();
+            }
+            break;
+
+        case EngineCommandType::ApplyParameters:
+            applied = command.parameters != nullptr;
+            for (size_t i = 0; applied && i < analyzers.size(); ++i)
+            {
+                analyzers[i]->ApplyParameters(*command.parameters);
+            }
+            break;
+
+        case EngineCommandType::SetAnalyzerEnabled:
+            applied = command.analyzerIndex < analyzerEnabled.size();
+            if (applied)
+            {
+                analyzerEnabled[command.analyzerIndex] = command.enabled ? 1 : 0;
+            }
+            break;
+        }
+
+        command.completion.set_value(applied);
+    }
 
-                if (samplesRead > 0)
+    bool AnalysisEngine::ProcessNextBlock()
+    {
+        DrainCommands();
+
+        const size_t available = ringBuffer->GetAvailableRead();
+        size_t hops = 1;
+        if (config.fastBlockSize == 0)
+        {
+            if (!FillProcessingBuffer(config.bufferSize))
+            {
+                return false;
+            }
+            // Take whole hops that are already buffered along, up to the batch limit.
+            while (hops < maxBatchHops && FillProcessingBuffer((hops + 1) * config.bufferSize))
+            {
+                ++hops;
+            }
+            config.clock->OnHop(hops * config.bufferSize);
+        }
+        else
+        {
+            // Every fast block goes out as soon as it is complete; the hop runs once they add up to one.
+            bool progressed = false;
+            while (fastFrames < config.bufferSize)
+            {
+                if (!FillProcessingBuffer(fastFrames + config.fastBlockSize))
                 {
-                    std::span<const float> audioData(processingBuffer.data(), samplesRead);
+                    return progressed;
+                }
+                ProcessFastBlock(std::span<const float>(processingBuffer.data() + fastFrames, config.fastBlockSize));
+                fastFrames += config.fastBlockSize;
+                progressed = true;
+            }
+            fastFrames = 0;
+        }
+
+        GD_TRACE_SCOPE("engine", "Hop");
+        GD_NO_ALLOCATION_SCOPE();
+
+        if (parameterStore)
+        {
+            const AnalyzerParameters *latest = parameterStore->GetCurrent();
+            if (latest != appliedParameters)
+            {
+                for (auto &analyzer : analyzers)
+                {
+                    analyzer->ApplyParameters(*latest);
+                }
+                appliedParameters = latest;
+            }
+        }
 
-                    for (auto &analyzer : analyzers)
-                    {
-                        analyzer->ProcessBuffer(audioData);
-                    }
+        const size_t frames = hops * config.bufferSize;
+        std::span<const float> audioData(processingBuffer.data(), frames);
+
+        using Clock = std::chrono::steady_clock;
+        const auto hopStart = Clock::now();
+        auto analyzerStart = hopStart;
+
+        for (size_t i = 0; i < analyzers.size(); ++i)
+        {
+            if (!analyzerEnabled[i])
+            {
+                continue;
+            }
+
+            {
+                GD_TRACE_SCOPE("engine", metrics.GetAnalyzerName(i).c_str());
+                if (hops == 1)
+                {
+                    analyzers[i]->ProcessBuffer(audioData);
+                }
+                else
+                {
+                    analyzers[i]->ProcessBlocks(audioData, config.bufferSize);
                 }
             }
-            else
+
+            const auto analyzerEnd = Clock::now();
+            const auto analyzerNanoseconds =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(analyzerEnd - analyzerStart);
+            metrics.RecordAnalyzer(i, static_cast<uint64_t>(analyzerNanoseconds.count()) / hops);
+            analyzerStart = analyzerEnd;
+        }
+
+        const auto hopNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(analyzerStart - hopStart);
+        metrics.RecordHop(static_cast<uint64_t>(hopNanoseconds.count()) / hops, available);
+
+        // Carry samples resampled beyond these hops over to the next call.
+        std::copy(processingBuffer.begin() + static_cast<std::ptrdiff_t>(frames),
+            processingBuffer.begin() + static_cast<std::ptrdiff_t>(pendingSamples),
+            processingBuffer.begin());
+        pendingSamples -= frames;
+
+        const uint64_t sequence = resultSequence.fetch_add(hops) + hops;
+        if (resultListener)
+        {
+            resultListener(sequence);
+        }
+
+        return true;
+    }
+
+    std::chrono::microseconds AnalysisEngine::GetIdlePollInterval() const noexcept
+    {
+        constexpr std::chrono::microseconds hopPoll(1000);
+        if (config.fastBlockSize == 0 || config.sampleRate <= 0.0f)
+        {
+            return hopPoll;
+        }
+
+        // Poll at twice the fast block rate so a block waits at most half its own length.
+        const auto halfBlock = static_cast<int64_t>(0.5e6 * config.fastBlockSize / config.sampleRate);
+        return std::min(hopPoll, std::chrono::microseconds(std::max<int64_t>(halfBlock, 50)));
+    }
+
+    void AnalysisEngine::ProcessFastBlock(std::span<const float> block) noexcept
+    {
+        GD_TRACE_SCOPE("engine", "Fast Block");
+        GD_NO_ALLOCATION_SCOPE();
+
+        config.clock->OnHop(block.size());
+        for (size_t i = 0; i < analyzers.size(); ++i)
+        {
+            if (analyzerEnabled[i])
+            {
+                analyzers[i]->ProcessFastBlock(block);
+            }
+        }
+    }
+
+    bool AnalysisEngine::FillProcessingBuffer(size_t frames) noexcept
+    {
+        if (!resampler.IsConfigured())
+        {
+            const size_t needed = frames - pendingSamples;
+            if (ringBuffer->GetAvailableRead() < needed)
+            {
+                return false;
+            }
+            pendingSamples += ringBuffer->Read(std::span<float>(processingBuffer.data() + pendingSamples, needed));
+            return true;
+        }
+
+        GD_TRACE_SCOPE("engine", "Resample");
+
+        while (pendingSamples < frames)
+        {
+            const size_t samplesRead = ringBuffer->Read(std::span<float>(inputBuffer.data(), inputBuffer.size()));
+            if (samplesRead == 0)
+            {
+                return false;
+            }
+
+            pendingSamples += resampler.Process(std::span<const float>(inputBuffer.data(), samplesRead),
+                std::span<float>(processingBuffer.data() + pendingSamples, processingBuffer.size() - pendingSamples));
+        }
+
+        return true;
+    }
+
+    EngineMetrics &AnalysisEngine::GetMetrics()
+    {
+        return metrics;
+    }
+
+    uint64_t AnalysisEngine::GetResultSequence() const noexcept
+    {
+        return resultSequence.load();
+    }
+
+    void AnalysisEngine::WorkerThreadFunction()
+    {
+        GD_TRACE_THREAD_NAME("Analysis Worker");
+
+        while (running.load())
+        {
+            if (!ProcessNextBlock())
             {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::this_thread::sleep_for(GetIdlePollInterval());
             }
         }
     }
@@ -1,9 +1,17 @@
 #pragma once
 
 #include "Util/LockFreeRingBuffer.h"
+#include "Util/MpscQueue.h"
 #include "Analysis/Analyzer.h"
+#include "Analysis/EngineMetrics.h"
+#include "Analysis/ParameterStore.h"
+#include "Analysis/Resampler.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -11,6 +19,33 @@
 namespace GuitarDiagnostics::Analysis
 {
 
+    /**
+     * @brief Kind of control command sent to the analysis thread.
+     */
+    enum class EngineCommandType
+    {
+        Reset,             ///< Reset every analyzer.
+        ApplyParameters,   ///< Hand a parameter set to every analyzer.
+        SetAnalyzerEnabled ///< Include or skip one analyzer in the following hops.
+    };
+
+    /**
+     * @brief Control command queued for the analysis thread, with the promise that acknowledges it.
+     */
+    struct EngineCommand
+    {
+        EngineCommandType type;               ///< What to do.
+        const AnalyzerParameters *parameters; ///< ApplyParameters: parameters to apply.
+        size_t analyzerIndex;                 ///< SetAnalyzerEnabled: registration index of the analyzer.
+        bool enabled;                         ///< SetAnalyzerEnabled: new state.
+        std::promise<bool> completion;        ///< Set once executed: true if applied, false if rejected.
+
+        /**
+         * @brief Constructs an empty Reset command.
+         */
+        EngineCommand();
+    };
+
     /**
      * @brief Core engine managing multiple analyzers and the analysis thread.
      *
@@ -20,6 +55,11 @@ namespace GuitarDiagnostics::Analysis
     class AnalysisEngine
     {
     public:
+        /**
+         * @brief Callback invoked on the analysis thread after every hop with the new result sequence number.
+         */
+        using ResultListener = std::function<void(uint64_t resultSequence)>;
+
         /**
          * @brief Constructs the AnalysisEngine.
          * @param ringBuffer Pointer to the ring buffer containing audio data.
@@ -57,6 +97,16 @@ namespace GuitarDiagnostics::Analysis
          */
         bool IsRunning() const;
 
+        /**
+         * @brief Tells the engine whether a thread it does not own (an AnalysisWorkerPool) calls ProcessNextBlock().
+         *
+         * While set, control commands are only queued for the driving thread to execute between
+         * hops, and Start() is refused. Clearing it executes commands still queued on the calling
+         * thread, which must make sure the driving thread has stopped.
+         * @param driven True while an external thread drives the engine.
+         */
+        void SetExternallyDriven(bool driven) noexcept;
+
         /**
          * @brief Registers an analyzer with the engine.
          * @param analyzer Shared pointer to the analyzer to register.
@@ -64,9 +114,110 @@ namespace GuitarDiagnostics::Analysis
         void RegisterAnalyzer(std::shared_ptr<Analyzer> analyzer);
 
         /**
-         * @brief Resets all registered analyzers.
+         * @brief Sets the source of run-time parameter updates. Must not be called while running.
+         *
+         * Before each hop the engine checks the store's current snapshot and, if it changed, hands
+         * it to every analyzer's ApplyParameters().
+         * @param store Parameter store that outlives the engine, or nullptr to stop following updates.
+         */
+        void SetParameterStore(const ParameterStore *store);
+
+        /**
+         * @brief Sets the callback notified when a hop's results are published. Must not be called while running.
+         *
+         * The listener runs on the analysis thread inside the hop's no-allocation scope, so it must
+         * be short and must not allocate; typically it only wakes the UI thread.
+         * @param listener Callback, or an empty function to stop notifications.
+         */
+        void SetResultListener(ResultListener listener);
+
+        /**
+         * @brief Sets the rate the ring buffer is filled at. Must not be called while running.
+         *
+         * When it differs from the configured analysis rate, every block read from the ring buffer
+         * is resampled on the analysis thread before it is cut into hops, so analyzers always see
+         * the rate they were configured for and the audio callback does no extra work.
+         * @param inputSampleRate Sample rate of the audio source in Hz.
+         * @return True if the rates match or a resampler was set up, false if the ratio is unsupported.
+         */
+        bool SetInputSampleRate(float inputSampleRate);
+
+        /**
+         * @brief Lets one ProcessNextBlock() call process several buffered hops. Must not be called while running.
+         *
+         * When the ring buffer holds more than one hop (a file source running unpaced, or a live
+         * engine catching up after a stall) up to this many hops are handed to every analyzer's
+         * ProcessBlocks() in one call instead of one ProcessBuffer() call per hop. Metrics then
+         * record each batch once, with its timings divided by its hop count.
+         * @param hops Maximum hops per call; 1 (the default) processes one hop at a time.
+         * @return True if set, false if hops is 0 or greater than 1 while the fast path is enabled.
+         */
+        bool SetMaxBatchHops(size_t hops);
+
+        /**
+         * @brief Resets all registered analyzers at the next hop boundary.
+         *
+         * Like every control command this never blocks the analysis thread: it is queued without
+         * locks and executed between hops. While neither the worker thread nor an external driver
+         * (SetExternallyDriven()) runs the engine it executes on the calling thread before returning.
+         * @return Completes with true once the analyzers were reset, false if the command queue was full.
+         */
+        std::future<bool> Reset();
+
+        /**
+         * @brief Hands a parameter set to every analyzer's ApplyParameters() at the next hop boundary.
+         *
+         * The parameters stay in effect until the next command or parameter store update.
+         * @param parameters Parameters that stay valid until the returned future is ready.
+         * @return Completes with true once applied, false if the queue was full or parameters is null.
+         */
+        std::future<bool> ApplyParameters(const AnalyzerParameters *parameters);
+
+        /**
+         * @brief Includes or skips an analyzer, starting with the next hop.
+         *
+         * A skipped analyzer keeps its state and its last result; re-enabling it continues from there.
+         * @param analyzerIndex Registration order index of the analyzer.
+         * @param enabled True to process hops, false to skip them.
+         * @return Completes with true once applied, false if the queue was full or the index is unknown.
+         */
+        std::future<bool> SetAnalyzerEnabled(size_t analyzerIndex, bool enabled);
+
+        /**
+         * @brief Processes the next audio from the ring buffer on the calling thread.
+         *
+         * Used by the worker thread and by benchmarks that drive the engine synchronously; must not
+         * be called while the worker thread is running. Queued control commands are executed first,
+         * even if no audio is available.
+         *
+         * Without a fast path this runs one hop once a full hop is buffered, or a batch of up to
+         * SetMaxBatchHops() hops if that many are already buffered. With a fast path
+         * (AnalysisConfig::fastBlockSize) every complete fast block is handed to the analyzers'
+         * ProcessFastBlock() right away, and the hop runs in the call that completes it.
+         * @return True if a hop, a batch or at least one fast block was processed, false otherwise.
+         */
+        bool ProcessNextBlock();
+
+        /**
+         * @brief Gets how long a worker should wait before polling again after ProcessNextBlock() found nothing.
+         * @return 1 ms, or half a fast block when the fast path is enabled.
+         */
+        std::chrono::microseconds GetIdlePollInterval() const noexcept;
+
+        /**
+         * @brief Gets the timing instrumentation of the engine.
+         * @return Metrics recorded by the worker thread; safe to read concurrently.
          */
-        void Reset();
+        EngineMetrics &GetMetrics();
+
+        /**
+         * @brief Gets the result sequence number, incremented once every analyzer has published a hop.
+         *
+         * Readers compare it with the value they last rendered to tell whether any analyzer result
+         * changed, without querying the analyzers.
+         * @return Number of hops processed since construction; safe to read from any thread.
+         */
+        uint64_t GetResultSequence() const noexcept;
 
         /**
          * @brief Retrieves a registered analyzer by type.
@@ -87,6 +238,42 @@ namespace GuitarDiagnostics::Analysis
         }
 
     private:
+        /**
+         * @brief Queues a command, executing it right away while the worker thread is not running.
+         * @param command Command to queue.
+         * @return Future of the command's completion.
+         */
+        std::future<bool> Submit(EngineCommand command);
+
+        /**
+         * @brief Executes every queued command, unless another thread is already doing so.
+         */
+        void DrainCommands() noexcept;
+
+        /**
+         * @brief Executes one command and completes its promise.
+         * @param command Command to execute.
+         */
+        void ExecuteCommand(EngineCommand &command) noexcept;
+
+        /**
+         * @brief Reads (and if needed resamples) ring buffer input until the processing buffer holds enough frames.
+         * @param frames Frames of the current hop needed in the processing buffer.
+         * @return True if they are there, false if the ring buffer ran dry first.
+         */
+        bool FillProcessingBuffer(size_t frames) noexcept;
+
+        /**
+         * @brief Sizes the processing buffer for the largest batch plus one resampler overshoot.
+         */
+        void ResizeProcessingBuffer();
+
+        /**
+         * @brief Advances the clock and hands one fast-path block to every enabled analyzer.
+         * @param block Frames of the block.
+         */
+        void ProcessFastBlock(std::span<const float> block) noexcept;
+
         /**
          * @brief Main loop for the worker thread.
          *
@@ -97,7 +284,21 @@ namespace GuitarDiagnostics::Analysis
         Util::LockFreeRingBuffer<float> *ringBuffer;      ///< Pointer to the ring buffer.
         AnalysisConfig config;                            ///< Current analysis configuration.
         std::vector<std::shared_ptr<Analyzer>> analyzers; ///< List of registered analyzers.
+        std::vector<uint8_t> analyzerEnabled;             ///< Per analyzer, nonzero if it processes hops.
         std::vector<float> processingBuffer;              ///< Internal buffer for processing audio chunks.
+        Resampler resampler;                              ///< Input to analysis rate, when they differ.
+        std::vector<float> inputBuffer;                   ///< Ring buffer reads at the input rate.
+        size_t pendingSamples;                            ///< Frames of the current hop in processingBuffer.
+        size_t fastFrames;                                ///< Frames of the current hop given to the fast path.
+        size_t maxBatchHops;                              ///< Most hops processed by one ProcessNextBlock() call.
+        EngineMetrics metrics;                            ///< Per-analyzer and per-hop timing.
+        const ParameterStore *parameterStore;             ///< Source of parameter updates, may be null.
+        const AnalyzerParameters *appliedParameters;      ///< Snapshot last handed to the analyzers.
+        ResultListener resultListener;                    ///< Notified after every hop, may be empty.
+        std::atomic<uint64_t> resultSequence;             ///< Hops whose results have been published.
+        Util::MpscQueue<EngineCommand> commands;          ///< Control commands from any thread.
+        std::atomic<bool> drainingCommands;               ///< Held by the thread executing commands.
+        std::atomic<bool> externallyDriven;               ///< True while a worker pool calls ProcessNextBlock().
         std::atomic<bool> running;                        ///< Atomic flag indicating if the engine is running.
         std::thread workerThread;                         ///< The worker thread instance.
     };
@@ -1,10 +1,13 @@
 #include "Analysis/Analyzer.h"
 
+#include "Analysis/AnalysisClock.h"
+
 namespace GuitarDiagnostics::Analysis
 {
 
-    AnalysisConfig::AnalysisConfig(float sampleRate, uint32_t bufferSize)
-        : sampleRate(sampleRate), bufferSize(bufferSize)
+    AnalysisConfig::AnalysisConfig(float sampleRate, uint32_t bufferSize, AnalysisClock *clock)
+        : sampleRate(sampleRate), bufferSize(bufferSize), fastBlockSize(0),
+          clock(clock ? clock : &SteadyClock::GetInstance())
     {
     }
 
@@ -12,4 +15,25 @@ namespace GuitarDiagnostics::Analysis
     {
     }
 
+    void Analyzer::ProcessFastBlock([[maybe_unused]] std::span<const float> block)
+    {
+    }
+
+    void Analyzer::ProcessBlocks(std::span<const float> samples, size_t hop)
+    {
+        for (size_t offset = 0; hop > 0 && offset + hop <= samples.size(); offset += hop)
+        {
+            ProcessBuffer(samples.subspan(offset, hop));
+        }
+    }
+
+    std::string Analyzer::GetName() const
+    {
+        return "Analyzer";
+    }
+
+    void Analyzer::ApplyParameters([[maybe_unused]] const AnalyzerParameters &parameters)
+    {
+    }
+
 } // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,146 @@
+#include "Analysis/AnalysisWorkerPool.h"
+
+#include "Analysis/AnalysisEngine.h"
+#include "Util/Tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    AnalysisWorkerPool::AnalysisWorkerPool(size_t threadCount)
+        : engines(), claims(), requestedThreads(threadCount), idlePoll(1000), threadStartListener(), running(false),
+          workerThreads()
+    {
+        if (requestedThreads == 0)
+        {
+            requestedThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+    }
+
+    AnalysisWorkerPool::~AnalysisWorkerPool()
+    {
+        Stop();
+    }
+
+    void AnalysisWorkerPool::AddEngine(AnalysisEngine *engine)
+    {
+        if (engine && !running.load())
+        {
+            engines.push_back(engine);
+        }
+    }
+
+    void AnalysisWorkerPool::SetThreadStartListener(ThreadStartListener listener)
+    {
+        if (!running.load())
+        {
+            threadStartListener = std::move(listener);
+        }
+    }
+
+    bool AnalysisWorkerPool::Start()
+    {
+        if (engines.empty())
+        {
+            return false;
+        }
+
+        bool expected = false;
+        if (!running.compare_exchange_strong(expected, true))
+        {
+            return false;
+        }
+
+        // From here on commands to the engines wait for a pool thread instead of racing its hops.
+        for (AnalysisEngine *engine : engines)
+        {
+            engine->SetExternallyDriven(true);
+        }
+
+        claims = std::vector<std::atomic<bool>>(engines.size());
+        idlePoll = engines.front()->GetIdlePollInterval();
+        for (const AnalysisEngine *engine : engines)
+        {
+            idlePoll = std::min(idlePoll, engine->GetIdlePollInterval());
+        }
+
+        const size_t threadCount = GetThreadCount();
+        workerThreads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            workerThreads.emplace_back(&AnalysisWorkerPool::WorkerThreadFunction, this, i);
+        }
+
+        return true;
+    }
+
+    void AnalysisWorkerPool::Stop()
+    {
+        running.store(false);
+
+        for (auto &thread : workerThreads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+        workerThreads.clear();
+
+        for (AnalysisEngine *engine : engines)
+        {
+            engine->SetExternallyDriven(false);
+        }
+    }
+
+    bool AnalysisWorkerPool::IsRunning() const
+    {
+        return running.load();
+    }
+
+    size_t AnalysisWorkerPool::GetThreadCount() const
+    {
+        return std::clamp<size_t>(engines.size(), 1, requestedThreads);
+    }
+
+    size_t AnalysisWorkerPool::GetEngineCount() const
+    {
+        return engines.size();
+    }
+
+    void AnalysisWorkerPool::WorkerThreadFunction(size_t workerIndex)
+    {
+        GD_TRACE_THREAD_NAME("Analysis Pool Worker");
+
+        if (threadStartListener)
+        {
+            threadStartListener(workerIndex);
+        }
+
+        const size_t engineCount = engines.size();
+        while (running.load())
+        {
+            bool processed = false;
+            for (size_t offset = 0; offset < engineCount; ++offset)
+            {
+                const size_t index = (workerIndex + offset) % engineCount;
+                if (claims[index].exchange(true, std::memory_order_acquire))
+                {
+                    continue;
+                }
+
+                processed |= engines[index]->ProcessNextBlock();
+                claims[index].store(false, std::memory_order_release);
+            }
+
+            if (!processed)
+            {
+                std::this_thread::sleep_for(idlePoll);
+            }
+        }
+    }
+
+} // namespace GuitarDiagnostics::Analysis
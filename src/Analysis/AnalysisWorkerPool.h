@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+    class AnalysisEngine;
+
+    /**
+     * @brief Shared pool of worker threads that drives several analysis engines.
+     *
+     * Replaces the one-thread-per-engine model when a process analyzes many inputs: the pool's
+     * threads scan all engines and call ProcessNextBlock() on whichever has a block ready. Each
+     * engine is claimed by at most one thread at a time, so its analyzers, buffers and metrics
+     * stay single-threaded and results of different engines never mix. Every thread starts its
+     * scan at a different engine, so with as many threads as engines each one mostly stays on
+     * its own engine.
+     */
+    class AnalysisWorkerPool
+    {
+    public:
+        /**
+         * @brief Called on each worker thread before its first scan.
+         * @param workerIndex Index of the thread in [0, GetThreadCount()).
+         */
+        using ThreadStartListener = std::function<void(size_t workerIndex)>;
+
+        /**
+         * @brief Constructs the AnalysisWorkerPool.
+         * @param threadCount Number of worker threads, 0 for one per hardware thread. Never more
+         *                    threads than engines are started.
+         */
+        explicit AnalysisWorkerPool(size_t threadCount);
+
+        /**
+         * @brief Destructor. Stops the worker threads if running.
+         */
+        ~AnalysisWorkerPool();
+
+        AnalysisWorkerPool(const AnalysisWorkerPool &) = delete;
+
+        AnalysisWorkerPool &operator=(const AnalysisWorkerPool &) = delete;
+
+        AnalysisWorkerPool(AnalysisWorkerPool &&) = delete;
+
+        AnalysisWorkerPool &operator=(AnalysisWorkerPool &&) = delete;
+
+        /**
+         * @brief Adds an engine to the pool. Must not be called while running.
+         * @param engine Engine that outlives the pool; its own worker thread must not be started.
+         */
+        void AddEngine(AnalysisEngine *engine);
+
+        /**
+         * @brief Sets the listener run on every worker thread as it starts, e.g. to pin it to a core.
+         *
+         * Must not be called while running.
+         * @param listener Listener, or an empty function to remove it.
+         */
+        void SetThreadStartListener(ThreadStartListener listener);
+
+        /**
+         * @brief Starts the worker threads and marks every engine as externally driven.
+         *
+         * Until Stop() the engines' control commands are executed by the pool thread that holds
+         * the engine, between hops.
+         * @return True if started, false if already running or no engine was added.
+         */
+        bool Start();
+
+        /**
+         * @brief Stops and joins the worker threads, then hands the engines back to their callers.
+         */
+        void Stop();
+
+        /**
+         * @brief Checks if the pool is running.
+         * @return True if running, false otherwise.
+         */
+        bool IsRunning() const;
+
+        /**
+         * @brief Gets the number of worker threads started by Start().
+         * @return Thread count, at least 1 and at most the engine count.
+         */
+        size_t GetThreadCount() const;
+
+        /**
+         * @brief Gets the number of engines driven by the pool.
+         * @return Engine count.
+         */
+        size_t GetEngineCount() const;
+
+    private:
+        /**
+         * @brief Main loop of one worker thread.
+         * @param workerIndex Index of the thread, used as the first engine of every scan.
+         */
+        void WorkerThreadFunction(size_t workerIndex);
+
+        std::vector<AnalysisEngine *> engines;   ///< Engines driven by the pool.
+        std::vector<std::atomic<bool>> claims;   ///< [engine] true while a worker processes the engine.
+        size_t requestedThreads;                 ///< Thread count requested at construction.
+        std::chrono::microseconds idlePoll;      ///< Sleep after a scan found no work: the shortest engine's poll.
+        ThreadStartListener threadStartListener; ///< Run by each worker thread as it starts, may be empty.
+        std::atomic<bool> running;               ///< True while the workers should run.
+        std::vector<std::thread> workerThreads;  ///< Worker thread instances.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
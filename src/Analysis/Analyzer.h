@@ -8,20 +8,26 @@
 namespace GuitarDiagnostics::Analysis
 {
 
+    class AnalysisClock;
+    struct AnalyzerParameters;
+
     /**
      * @brief Configuration parameters for audio analysis.
      */
     struct AnalysisConfig
     {
-        float sampleRate;    ///< Audio sample rate in Hz.
-        uint32_t bufferSize; ///< Size of the audio buffer in frames.
+        float sampleRate;       ///< Audio sample rate in Hz.
+        uint32_t bufferSize;    ///< Hop size in frames.
+        uint32_t fastBlockSize; ///< Frames per fast-path block; 0 disables the fast path, else divides bufferSize.
+        AnalysisClock *clock;   ///< Time source for analyzers; never null, must outlive the analyzers.
 
         /**
          * @brief Constructs an AnalysisConfig.
          * @param sampleRate The sample rate in Hz.
          * @param bufferSize The buffer size in frames.
+         * @param clock Time source for analyzers, or nullptr for SteadyClock::GetInstance().
          */
-        AnalysisConfig(float sampleRate, uint32_t bufferSize);
+        AnalysisConfig(float sampleRate, uint32_t bufferSize, AnalysisClock *clock = nullptr);
     };
 
     /**
@@ -66,6 +72,29 @@ namespace GuitarDiagnostics::Analysis
          */
         virtual void ProcessBuffer(std::span<const float> audioData) = 0;
 
+        /**
+         * @brief Processes one block of the latency-critical fast path. Analysis thread only.
+         *
+         * Called every AnalysisConfig::fastBlockSize frames as soon as they arrive, before the hop
+         * containing them reaches ProcessBuffer(). Meant for cheap per-block work such as envelope
+         * and onset tracking; must not allocate. The default implementation ignores the block.
+         * @param block Audio samples of the block.
+         */
+        virtual void ProcessFastBlock(std::span<const float> block);
+
+        /**
+         * @brief Processes several consecutive hops in one call, for offline and catch-up throughput.
+         *
+         * Equivalent to calling ProcessBuffer() on each complete hop in order; a trailing partial
+         * hop is ignored. The caller advances the clock over the whole batch first, so during the
+         * call it reads the end of the last hop. Overrides amortize per-hop work across the batch,
+         * e.g. by publishing their result once, and must then date each hop themselves. The
+         * default implementation loops over ProcessBuffer().
+         * @param samples Audio samples of the hops, back to back.
+         * @param hop Frames per hop; the configured bufferSize when called by AnalysisEngine.
+         */
+        virtual void ProcessBlocks(std::span<const float> samples, size_t hop);
+
         /**
          * @brief Retrieves the latest analysis result.
          * @return Shared pointer to the latest AnalysisResult.
@@ -77,6 +106,21 @@ namespace GuitarDiagnostics::Analysis
          */
         virtual void Reset() = 0;
 
+        /**
+         * @brief Retrieves the display name of the analyzer, used in diagnostics and metrics.
+         * @return Name string.
+         */
+        virtual std::string GetName() const;
+
+        /**
+         * @brief Applies the run-time tunable fields of a parameter update. Analysis thread only.
+         *
+         * Called by the engine between hops; implementations copy values and must not allocate.
+         * The default implementation ignores the update.
+         * @param parameters Parameter blocks of all analyzers.
+         */
+        virtual void ApplyParameters(const AnalyzerParameters &parameters);
+
     protected:
         Analyzer() = default;
 
@@ -0,0 +1,189 @@
+#include "Analysis/AnalyzerParameters.h"
+
+#include <Logger.h>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace
+    {
+        /**
+         * @brief Reads one numeric field of a parameter block; a missing key leaves the value unchanged.
+         * @return False if the key is present with the wrong type.
+         */
+        template<typename T> bool ReadField(const nlohmann::json &block, const char *key, T &value)
+        {
+            const auto field = block.find(key);
+            if (field == block.end())
+            {
+                return true;
+            }
+
+            if (!field->is_number() || (std::is_unsigned_v<T> && !field->is_number_unsigned()))
+            {
+                LOG_ERROR("Analyzer parameter '{}' has an invalid value: {}", key, field->dump());
+                return false;
+            }
+
+            value = field->get<T>();
+            return true;
+        }
+
+        /**
+         * @brief Finds a parameter block; a missing block is reported as null.
+         * @return False if the key is present but not an object.
+         */
+        bool FindBlock(const nlohmann::json &root, const char *key, const nlohmann::json *&block)
+        {
+            const auto found = root.find(key);
+            block = found == root.end() ? nullptr : &*found;
+            if (block && !block->is_object())
+            {
+                LOG_ERROR("Analyzer parameter block '{}' must be an object", key);
+                return false;
+            }
+            return true;
+        }
+
+        bool ReadFretBuzz(const nlohmann::json &block, FretBuzzParameters &parameters)
+        {
+            return ReadField(block, "fftSize", parameters.fftSize)
+                   && ReadField(block, "yinThreshold", parameters.yinThreshold)
+                   && ReadField(block, "numHarmonics", parameters.numHarmonics)
+                   && ReadField(block, "onsetThreshold", parameters.onsetThreshold)
+                   && ReadField(block, "fluxThreshold", parameters.fluxThreshold)
+                   && ReadField(block, "highFreqMin", parameters.highFreqMin)
+                   && ReadField(block, "highFreqMax", parameters.highFreqMax)
+                   && ReadField(block, "transientWeight", parameters.transientWeight)
+                   && ReadField(block, "highFreqWeight", parameters.highFreqWeight)
+                   && ReadField(block, "inharmonicityWeight", parameters.inharmonicityWeight);
+        }
+
+        bool ReadIntonation(const nlohmann::json &block, IntonationParameters &parameters)
+        {
+            int64_t stableTimeMs = parameters.stableTime.count();
+            if (!ReadField(block, "stableTimeMs", stableTimeMs))
+            {
+                return false;
+            }
+            parameters.stableTime = std::chrono::milliseconds(stableTimeMs);
+
+            return ReadField(block, "yinThreshold", parameters.yinThreshold)
+                   && ReadField(block, "pitchAccumulatorSize", parameters.pitchAccumulatorSize)
+                   && ReadField(block, "confidenceThreshold", parameters.confidenceThreshold)
+                   && ReadField(block, "inTuneTolerance", parameters.inTuneTolerance)
+                   && ReadField(block, "stabilityThreshold", parameters.stabilityThreshold);
+        }
+
+        bool ReadStringHealth(const nlohmann::json &block, StringHealthParameters &parameters)
+        {
+            return ReadField(block, "fftSize", parameters.fftSize)
+                   && ReadField(block, "yinThreshold", parameters.yinThreshold)
+                   && ReadField(block, "numHarmonics", parameters.numHarmonics)
+                   && ReadField(block, "decayHistorySize", parameters.decayHistorySize)
+                   && ReadField(block, "minDecayRate", parameters.minDecayRate)
+                   && ReadField(block, "maxDecayRate", parameters.maxDecayRate)
+                   && ReadField(block, "decayWeight", parameters.decayWeight)
+                   && ReadField(block, "spectralWeight", parameters.spectralWeight)
+                   && ReadField(block, "inharmonicityWeight", parameters.inharmonicityWeight);
+        }
+    } // namespace
+
+    FretBuzzParameters::FretBuzzParameters()
+        : fftSize(2048), yinThreshold(0.15f), numHarmonics(10), onsetThreshold(1.5f), fluxThreshold(0.5f),
+          highFreqMin(4000.0f), highFreqMax(8000.0f), transientWeight(0.3f), highFreqWeight(0.4f),
+          inharmonicityWeight(0.3f)
+    {
+    }
+
+    IntonationParameters::IntonationParameters()
+        : yinThreshold(0.15f), pitchAccumulatorSize(100), confidenceThreshold(0.7f), stableTime(500),
+          inTuneTolerance(5.0f), stabilityThreshold(2.0f)
+    {
+    }
+
+    StringHealthParameters::StringHealthParameters()
+        : fftSize(2048), yinThreshold(0.15f), numHarmonics(10), decayHistorySize(50), minDecayRate(-50.0f),
+          maxDecayRate(-5.0f), decayWeight(0.3f), spectralWeight(0.3f), inharmonicityWeight(0.4f)
+    {
+    }
+
+    AnalyzerParameters::AnalyzerParameters() : fretBuzz(), intonation(), stringHealth()
+    {
+    }
+
+    std::optional<AnalyzerParameters> ParseAnalyzerParameters(std::string_view json, const AnalyzerParameters &base)
+    {
+        const nlohmann::json root = nlohmann::json::parse(json, nullptr, false);
+        if (root.is_discarded() || !root.is_object())
+        {
+            LOG_ERROR("Analyzer parameters are not a valid JSON object");
+            return std::nullopt;
+        }
+
+        AnalyzerParameters parameters = base;
+        const nlohmann::json *block = nullptr;
+
+        if (!FindBlock(root, "fretBuzz", block) || (block && !ReadFretBuzz(*block, parameters.fretBuzz)))
+        {
+            return std::nullopt;
+        }
+        if (!FindBlock(root, "intonation", block) || (block && !ReadIntonation(*block, parameters.intonation)))
+        {
+            return std::nullopt;
+        }
+        if (!FindBlock(root, "stringHealth", block) || (block && !ReadStringHealth(*block, parameters.stringHealth)))
+        {
+            return std::nullopt;
+        }
+
+        return parameters;
+    }
+
+    std::string SerializeAnalyzerParameters(const AnalyzerParameters &parameters)
+    {
+        const auto &fretBuzz = parameters.fretBuzz;
+        const auto &intonation = parameters.intonation;
+        const auto &stringHealth = parameters.stringHealth;
+
+        nlohmann::json root;
+        root["fretBuzz"] = {
+            { "fftSize", fretBuzz.fftSize },
+            { "yinThreshold", fretBuzz.yinThreshold },
+            { "numHarmonics", fretBuzz.numHarmonics },
+            { "onsetThreshold", fretBuzz.onsetThreshold },
+            { "highFreqMin", fretBuzz.highFreqMin },
+            { "highFreqMax", fretBuzz.highFreqMax },
+            { "transientWeight", fretBuzz.transientWeight },
+            { "highFreqWeight", fretBuzz.highFreqWeight },
+            { "inharmonicityWeight", fretBuzz.inharmonicityWeight },
+        };
+        root["intonation"] = {
+            { "yinThreshold", intonation.yinThreshold },
+            { "pitchAccumulatorSize", intonation.pitchAccumulatorSize },
+            { "confidenceThreshold", intonation.confidenceThreshold },
+            { "stableTimeMs", intonation.stableTime.count() },
+            { "inTuneTolerance", intonation.inTuneTolerance },
+            { "stabilityThreshold", intonation.stabilityThreshold },
+        };
+        root["stringHealth"] = {
+            { "fftSize", stringHealth.fftSize },
+            { "yinThreshold", stringHealth.yinThreshold },
+            { "numHarmonics", stringHealth.numHarmonics },
+            { "decayHistorySize", stringHealth.decayHistorySize },
+            { "minDecayRate", stringHealth.minDecayRate },
+            { "maxDecayRate", stringHealth.maxDecayRate },
+            { "decayWeight", stringHealth.decayWeight },
+            { "spectralWeight", stringHealth.spectralWeight },
+            { "inharmonicityWeight", stringHealth.inharmonicityWeight },
+        };
+
+        return root.dump(4);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
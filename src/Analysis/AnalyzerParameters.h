@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Tuning parameters of the FretBuzzDetector.
+     *
+     * Sizes and the YIN threshold are used when the detector is constructed; the remaining
+     * fields can be changed at run time through Analyzer::ApplyParameters().
+     */
+    struct FretBuzzParameters
+    {
+        size_t fftSize;            ///< FFT length in samples, rounded up to a power of two in [256, 16384].
+        float yinThreshold;        ///< YIN absolute threshold; lower is stricter.
+        size_t numHarmonics;       ///< Harmonics checked for inharmonicity, clamped to [1, 32].
+        float onsetThreshold;      ///< RMS ratio between hops above which an onset is detected.
+        float fluxThreshold;       ///< Spectral flux, relative to the previous hop's magnitude, that marks an onset.
+        float highFreqMin;         ///< Lower edge of the buzz noise band in Hz.
+        float highFreqMax;         ///< Upper edge of the buzz noise band in Hz.
+        float transientWeight;     ///< Weight of the transient score in the buzz score.
+        float highFreqWeight;      ///< Weight of the high-frequency energy score in the buzz score.
+        float inharmonicityWeight; ///< Weight of the inharmonicity score in the buzz score.
+
+        /**
+         * @brief Constructs FretBuzzParameters with the default tuning.
+         */
+        FretBuzzParameters();
+    };
+
+    /**
+     * @brief Tuning parameters of the IntonationAnalyzer.
+     *
+     * The accumulator size and the YIN threshold are used when the analyzer is constructed; the
+     * remaining fields can be changed at run time through Analyzer::ApplyParameters().
+     */
+    struct IntonationParameters
+    {
+        float yinThreshold;                   ///< YIN absolute threshold; lower is stricter.
+        size_t pitchAccumulatorSize;          ///< Pitch samples kept for the stability check, clamped to [10, 400].
+        float confidenceThreshold;            ///< Minimum YIN confidence for a pitch sample to count.
+        std::chrono::milliseconds stableTime; ///< Time a pitch must stay stable before the state advances.
+        float inTuneTolerance;                ///< Largest deviation in cents still reported as in tune.
+        float stabilityThreshold;             ///< Largest pitch standard deviation in Hz counted as stable.
+
+        /**
+         * @brief Constructs IntonationParameters with the default tuning.
+         */
+        IntonationParameters();
+    };
+
+    /**
+     * @brief Tuning parameters of the StringHealthAnalyzer.
+     *
+     * Sizes and the YIN threshold are used when the analyzer is constructed; the remaining
+     * fields can be changed at run time through Analyzer::ApplyParameters().
+     */
+    struct StringHealthParameters
+    {
+        size_t fftSize;            ///< FFT length in samples, rounded up to a power of two in [256, 16384].
+        float yinThreshold;        ///< YIN absolute threshold; lower is stricter.
+        size_t numHarmonics;       ///< Harmonics tracked for energy and inharmonicity, clamped to [1, 32].
+        size_t decayHistorySize;   ///< Frames used for the decay fit, clamped to [10, 200].
+        float minDecayRate;        ///< Decay rate in dB/s that scores 0 (fastest decay).
+        float maxDecayRate;        ///< Decay rate in dB/s that scores 1 (slowest decay).
+        float decayWeight;         ///< Weight of the decay score in the health score.
+        float spectralWeight;      ///< Weight of the spectral centroid score in the health score.
+        float inharmonicityWeight; ///< Weight of the inharmonicity score in the health score.
+
+        /**
+         * @brief Constructs StringHealthParameters with the default tuning.
+         */
+        StringHealthParameters();
+    };
+
+    /**
+     * @brief Parameter blocks of all analyzers.
+     */
+    struct AnalyzerParameters
+    {
+        FretBuzzParameters fretBuzz;         ///< Fret buzz detector block.
+        IntonationParameters intonation;     ///< Intonation analyzer block.
+        StringHealthParameters stringHealth; ///< String health analyzer block.
+
+        /**
+         * @brief Constructs AnalyzerParameters with the default tuning of every analyzer.
+         */
+        AnalyzerParameters();
+    };
+
+    /**
+     * @brief Parses analyzer parameters from JSON.
+     *
+     * The document holds optional "fretBuzz", "intonation" and "stringHealth" objects whose keys
+     * match the field names ("stableTimeMs" for IntonationParameters::stableTime). Missing blocks
+     * and keys keep the values of @p base.
+     *
+     * @param json JSON text.
+     * @param base Values used for anything the document does not set.
+     * @return Parsed parameters, or std::nullopt if the text is not valid JSON or a value has the wrong type.
+     */
+    std::optional<AnalyzerParameters> ParseAnalyzerParameters(std::string_view json,
+        const AnalyzerParameters &base = AnalyzerParameters());
+
+    /**
+     * @brief Serializes analyzer parameters to JSON in the format read by ParseAnalyzerParameters().
+     * @param parameters Parameters to write.
+     * @return Indented JSON text.
+     */
+    std::string SerializeAnalyzerParameters(const AnalyzerParameters &parameters);
+
+} // namespace GuitarDiagnostics::Analysis
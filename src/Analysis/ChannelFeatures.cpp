@@ -0,0 +1,200 @@
+#include "Analysis/ChannelFeatures.h"
+
+#include <Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    ChannelFeatures::ChannelFeatures()
+        : rms(0.0f), peak(0.0f), zeroCrossingRate(0.0f), spectralFlux(0.0f), bandEnergies()
+    {
+    }
+
+    ChannelFeatureCache::ChannelFeatureCache()
+        : kernels(nullptr), channelCount(0), hopSize(0), binCount(0), sampleRate(0.0f), bands(), arena(), frames(),
+          currentSpectrum(), previousSpectrum(), difference(), features()
+    {
+    }
+
+    bool ChannelFeatureCache::Configure(size_t newChannelCount,
+        size_t newHopSize,
+        size_t newBinCount,
+        float newSampleRate,
+        std::span<const BinRange> newBands)
+    {
+        if (newChannelCount == 0 || newChannelCount > g_kChannelLanes)
+        {
+            LOG_ERROR("Cannot analyze {} channels in lockstep, supported are 1 to {}",
+                newChannelCount,
+                g_kChannelLanes);
+            return false;
+        }
+        if (newHopSize < 2 || newBinCount == 0 || newSampleRate <= 0.0f)
+        {
+            LOG_ERROR("Invalid channel feature hop size {}, bin count {} or sample rate {}",
+                newHopSize,
+                newBinCount,
+                newSampleRate);
+            return false;
+        }
+        if (newBands.size() > g_kMaxChannelBands)
+        {
+            LOG_ERROR("Cannot compute {} channel bands, at most {} supported",
+                newBands.size(),
+                g_kMaxChannelBands);
+            return false;
+        }
+        for (const BinRange &band : newBands)
+        {
+            if (band.first >= band.last || band.last > newBinCount)
+            {
+                LOG_ERROR("Channel band [{}, {}) is empty or exceeds {} bins",
+                    band.first,
+                    band.last,
+                    newBinCount);
+                return false;
+            }
+        }
+
+        kernels = &KernelRegistry::GetKernels();
+        channelCount = newChannelCount;
+        hopSize = newHopSize;
+        binCount = newBinCount;
+        sampleRate = newSampleRate;
+
+        bands.Clear();
+        for (const BinRange &band : newBands)
+        {
+            bands.PushBack(band);
+        }
+
+        const size_t lagCapacity = hopSize / 2;
+        arena.Reset(Util::Arena::GetFootprint<float>(hopSize * g_kChannelLanes)
+                    + 2 * Util::Arena::GetFootprint<float>(binCount * g_kChannelLanes)
+                    + Util::Arena::GetFootprint<float>(lagCapacity * g_kChannelLanes));
+        frames = arena.Allocate<float>(hopSize * g_kChannelLanes);
+        currentSpectrum = arena.Allocate<float>(binCount * g_kChannelLanes);
+        previousSpectrum = arena.Allocate<float>(binCount * g_kChannelLanes);
+        difference = arena.Allocate<float>(lagCapacity * g_kChannelLanes);
+
+        Reset();
+        return true;
+    }
+
+    bool ChannelFeatureCache::SetChannelSamples(size_t channel, std::span<const float> samples) noexcept
+    {
+        if (channel >= channelCount || samples.size() != hopSize)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < hopSize; ++i)
+        {
+            frames[i * g_kChannelLanes + channel] = samples[i];
+        }
+        return true;
+    }
+
+    bool ChannelFeatureCache::SetChannelSpectrum(size_t channel, std::span<const float> magnitudes) noexcept
+    {
+        if (channel >= channelCount || magnitudes.size() != binCount)
+        {
+            return false;
+        }
+
+        for (size_t bin = 0; bin < binCount; ++bin)
+        {
+            currentSpectrum[bin * g_kChannelLanes + channel] = magnitudes[bin];
+        }
+        return true;
+    }
+
+    void ChannelFeatureCache::Compute() noexcept
+    {
+        if (!kernels)
+        {
+            return;
+        }
+
+        std::array<float, g_kChannelLanes> sums{};
+        std::array<float, g_kChannelLanes> peaks{};
+        std::array<float, g_kChannelLanes> flux{};
+        std::array<uint32_t, g_kChannelLanes> crossings{};
+        kernels->channelSumOfSquares(frames, sums);
+        kernels->channelPeakAbsolute(frames, peaks);
+        kernels->channelZeroCrossings(frames, crossings);
+        kernels->channelPositiveDifferenceSum(currentSpectrum, previousSpectrum, flux);
+
+        const float duration = static_cast<float>(hopSize) / sampleRate;
+        for (size_t channel = 0; channel < channelCount; ++channel)
+        {
+            ChannelFeatures &channelFeatures = features[channel];
+            channelFeatures.rms = std::sqrt(sums[channel] / static_cast<float>(hopSize));
+            channelFeatures.peak = peaks[channel];
+            channelFeatures.zeroCrossingRate = static_cast<float>(crossings[channel]) / duration;
+            channelFeatures.spectralFlux = flux[channel];
+            channelFeatures.bandEnergies.Clear();
+        }
+
+        for (const BinRange &band : bands)
+        {
+            const auto bandSpectrum = std::span<const float>(currentSpectrum)
+                                          .subspan(band.first * g_kChannelLanes,
+                                              (band.last - band.first) * g_kChannelLanes);
+            kernels->channelSumOfSquares(bandSpectrum, sums);
+            for (size_t channel = 0; channel < channelCount; ++channel)
+            {
+                features[channel].bandEnergies.PushBack(sums[channel]);
+            }
+        }
+
+        std::swap(currentSpectrum, previousSpectrum);
+    }
+
+    bool ChannelFeatureCache::ComputeDifference(size_t window, size_t lagCount) noexcept
+    {
+        if (!kernels || window == 0 || lagCount == 0 || lagCount > hopSize / 2 || window + lagCount - 1 > hopSize)
+        {
+            return false;
+        }
+
+        for (size_t lag = 0; lag < lagCount; ++lag)
+        {
+            kernels->channelDifference(frames,
+                window,
+                lag,
+                std::span<float, g_kChannelLanes>(difference.data() + lag * g_kChannelLanes, g_kChannelLanes));
+        }
+        return true;
+    }
+
+    const ChannelFeatures &ChannelFeatureCache::GetFeatures(size_t channel) const noexcept
+    {
+        return features[channel];
+    }
+
+    float ChannelFeatureCache::GetDifference(size_t channel, size_t lag) const noexcept
+    {
+        return difference[lag * g_kChannelLanes + channel];
+    }
+
+    void ChannelFeatureCache::Reset() noexcept
+    {
+        std::fill(frames.begin(), frames.end(), 0.0f);
+        std::fill(currentSpectrum.begin(), currentSpectrum.end(), 0.0f);
+        std::fill(previousSpectrum.begin(), previousSpectrum.end(), 0.0f);
+        std::fill(difference.begin(), difference.end(), 0.0f);
+        features.fill(ChannelFeatures());
+    }
+
+    size_t ChannelFeatureCache::GetChannelCount() const noexcept
+    {
+        return channelCount;
+    }
+
+} // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Analysis/Kernels/KernelRegistry.h"
+#include "Util/Arena.h"
+#include "Util/StaticVector.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    constexpr size_t g_kMaxChannelBands = 8; ///< Most band energies a ChannelFeatureCache computes per channel.
+
+    /**
+     * @brief Bins [first, last) of a magnitude spectrum summed into one band energy.
+     */
+    struct BinRange
+    {
+        size_t first; ///< First bin of the band.
+        size_t last;  ///< One past the last bin of the band.
+    };
+
+    /**
+     * @brief Per-hop features of one channel of a multi-channel input.
+     */
+    struct ChannelFeatures
+    {
+        float rms;                                                  ///< Root mean square of the hop.
+        float peak;                                                 ///< Largest absolute sample of the hop.
+        float zeroCrossingRate;                                     ///< Sign changes per second.
+        float spectralFlux;                                         ///< Positive magnitude change since the last hop.
+        Util::StaticVector<float, g_kMaxChannelBands> bandEnergies; ///< Sum of squared magnitudes per band.
+
+        /**
+         * @brief Constructs features of a silent hop.
+         */
+        ChannelFeatures();
+    };
+
+    /**
+     * @brief Per-hop features of up to g_kChannelLanes channels (e.g. a hexaphonic pickup), computed in lockstep.
+     *
+     * Callers hand in each channel's hop and magnitude spectrum; the cache stores them channel
+     * interleaved, one channel per vector lane, so Compute() runs each channel kernel once for all
+     * channels instead of once per channel. Six strings then cost about one mono pass through the
+     * same loops. The features are cached until the next Compute(), so several consumers of a
+     * hop read them without recomputing.
+     *
+     * All buffers come from one arena sized in Configure(); the per-hop calls neither allocate
+     * nor lock. Not thread-safe; use it from the analysis thread.
+     */
+    class ChannelFeatureCache
+    {
+    public:
+        /**
+         * @brief Constructs an unconfigured ChannelFeatureCache.
+         */
+        ChannelFeatureCache();
+
+        /**
+         * @brief Destructor.
+         */
+        ~ChannelFeatureCache() = default;
+
+        ChannelFeatureCache(const ChannelFeatureCache &) = delete;
+
+        ChannelFeatureCache &operator=(const ChannelFeatureCache &) = delete;
+
+        ChannelFeatureCache(ChannelFeatureCache &&) = delete;
+
+        ChannelFeatureCache &operator=(ChannelFeatureCache &&) = delete;
+
+        /**
+         * @brief Sizes the buffers and picks the kernel table. Allocates; call before streaming.
+         * @param channelCount Channels analyzed, 1 to g_kChannelLanes.
+         * @param hopSize Frames per channel and hop.
+         * @param binCount Magnitude bins per channel spectrum.
+         * @param sampleRate Sample rate in Hz.
+         * @param bands Up to g_kMaxChannelBands bin ranges, each within binCount.
+         * @return True if configured, false if a parameter is out of range.
+         */
+        bool Configure(size_t channelCount,
+            size_t hopSize,
+            size_t binCount,
+            float sampleRate,
+            std::span<const BinRange> bands);
+
+        /**
+         * @brief Stores one channel's samples of the next hop.
+         * @param channel Channel index.
+         * @param samples Exactly hopSize samples.
+         * @return True if stored, false if the channel or the sample count is wrong.
+         */
+        bool SetChannelSamples(size_t channel, std::span<const float> samples) noexcept;
+
+        /**
+         * @brief Stores one channel's magnitude spectrum of the next hop.
+         * @param channel Channel index.
+         * @param magnitudes Exactly binCount magnitudes.
+         * @return True if stored, false if the channel or the bin count is wrong.
+         */
+        bool SetChannelSpectrum(size_t channel, std::span<const float> magnitudes) noexcept;
+
+        /**
+         * @brief Computes the features of every channel from the stored hop and spectra.
+         *
+         * Spectral flux compares each spectrum with the one stored for the previous Compute().
+         */
+        void Compute() noexcept;
+
+        /**
+         * @brief Computes the YIN difference function of every channel from the stored hop.
+         * @param window Frames summed per lag; window + lagCount - 1 must not exceed hopSize.
+         * @param lagCount Lags 0 to lagCount - 1 to compute, at most hopSize / 2.
+         * @return True if computed, false if the lags do not fit the hop.
+         */
+        bool ComputeDifference(size_t window, size_t lagCount) noexcept;
+
+        /**
+         * @brief Gets the features of one channel from the last Compute().
+         * @param channel Channel index, below GetChannelCount().
+         * @return Features of the channel.
+         */
+        const ChannelFeatures &GetFeatures(size_t channel) const noexcept;
+
+        /**
+         * @brief Gets one value of a channel's difference function from the last ComputeDifference().
+         * @param channel Channel index, below GetChannelCount().
+         * @param lag Lag below the lagCount of the last ComputeDifference().
+         * @return Sum of squared differences at the lag.
+         */
+        float GetDifference(size_t channel, size_t lag) const noexcept;
+
+        /**
+         * @brief Clears the stored spectra and features, as if the stream started again.
+         */
+        void Reset() noexcept;
+
+        /**
+         * @brief Gets the number of channels analyzed.
+         * @return Channel count, 0 until configured.
+         */
+        size_t GetChannelCount() const noexcept;
+
+    private:
+        const KernelTable *kernels;                             ///< Active DSP kernel table.
+        size_t channelCount;                                    ///< Channels analyzed.
+        size_t hopSize;                                         ///< Frames per channel and hop.
+        size_t binCount;                                        ///< Bins per channel spectrum.
+        float sampleRate;                                       ///< Sample rate in Hz.
+        Util::StaticVector<BinRange, g_kMaxChannelBands> bands; ///< Band energy bin ranges.
+        Util::Arena arena;                                      ///< Holds every buffer below.
+        std::span<float> frames;                                ///< Hop, channel interleaved.
+        std::span<float> currentSpectrum;                       ///< Spectra of this hop, channel interleaved.
+        std::span<float> previousSpectrum;                      ///< Spectra of the last Compute().
+        std::span<float> difference;                            ///< Difference function, lag major.
+        std::array<ChannelFeatures, g_kChannelLanes> features;  ///< Features of the last Compute().
+    };
+
+} // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,127 @@
+#include "Analysis/EngineMetrics.h"
+
+#include <utility>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    EngineMetrics::AnalyzerTiming::AnalyzerTiming(std::string name) : name(std::move(name)), histogram()
+    {
+    }
+
+    EngineMetrics::EngineMetrics()
+        : analyzers(), hopHistogram(), hopBudget(0), ringCapacity(0), deadlineMisses(0), ringFill(0), peakRingFill(0),
+          resetRequested(false)
+    {
+    }
+
+    EngineMetrics::~EngineMetrics()
+    {
+    }
+
+    void EngineMetrics::Configure(uint64_t budgetNanoseconds, size_t newRingCapacity)
+    {
+        hopBudget = budgetNanoseconds;
+        ringCapacity = newRingCapacity;
+    }
+
+    size_t EngineMetrics::AddAnalyzer(std::string name)
+    {
+        analyzers.push_back(std::make_unique<AnalyzerTiming>(std::move(name)));
+        return analyzers.size() - 1;
+    }
+
+    void EngineMetrics::RecordAnalyzer(size_t index, uint64_t nanoseconds) noexcept
+    {
+        if (index < analyzers.size())
+        {
+            analyzers[index]->histogram.Record(nanoseconds);
+        }
+    }
+
+    void EngineMetrics::RecordHop(uint64_t nanoseconds, size_t fill) noexcept
+    {
+        if (resetRequested.exchange(false, std::memory_order_acq_rel))
+        {
+            Reset();
+            return;
+        }
+
+        hopHistogram.Record(nanoseconds);
+
+        if (hopBudget > 0 && nanoseconds > hopBudget)
+        {
+            deadlineMisses.store(deadlineMisses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        ringFill.store(fill, std::memory_order_relaxed);
+        if (fill > peakRingFill.load(std::memory_order_relaxed))
+        {
+            peakRingFill.store(fill, std::memory_order_relaxed);
+        }
+    }
+
+    void EngineMetrics::RequestReset() noexcept
+    {
+        resetRequested.store(true, std::memory_order_release);
+    }
+
+    size_t EngineMetrics::GetAnalyzerCount() const
+    {
+        return analyzers.size();
+    }
+
+    const std::string &EngineMetrics::GetAnalyzerName(size_t index) const
+    {
+        return analyzers[index]->name;
+    }
+
+    const Util::LatencyHistogram &EngineMetrics::GetAnalyzerHistogram(size_t index) const
+    {
+        return analyzers[index]->histogram;
+    }
+
+    const Util::LatencyHistogram &EngineMetrics::GetHopHistogram() const
+    {
+        return hopHistogram;
+    }
+
+    uint64_t EngineMetrics::GetHopBudget() const
+    {
+        return hopBudget;
+    }
+
+    uint64_t EngineMetrics::GetDeadlineMisses() const
+    {
+        return deadlineMisses.load(std::memory_order_relaxed);
+    }
+
+    size_t EngineMetrics::GetRingFill() const
+    {
+        return ringFill.load(std::memory_order_relaxed);
+    }
+
+    size_t EngineMetrics::GetPeakRingFill() const
+    {
+        return peakRingFill.load(std::memory_order_relaxed);
+    }
+
+    size_t EngineMetrics::GetRingCapacity() const
+    {
+        return ringCapacity;
+    }
+
+    void EngineMetrics::Reset() noexcept
+    {
+        for (auto &analyzer : analyzers)
+        {
+            analyzer->histogram.Reset();
+        }
+
+        hopHistogram.Reset();
+        deadlineMisses.store(0, std::memory_order_relaxed);
+        ringFill.store(0, std::memory_order_relaxed);
+        peakRingFill.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
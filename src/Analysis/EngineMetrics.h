@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Util/LatencyHistogram.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Timing instrumentation of an AnalysisEngine.
+     *
+     * Records per-analyzer ProcessBuffer() durations, per-hop totals, deadline misses and ring
+     * buffer fill. All recording happens on the engine's worker thread, which is the single
+     * writer of every histogram, so recording is wait-free; any thread (typically the UI) may read
+     * concurrently. Analyzer slots are added while the engine is stopped.
+     */
+    class EngineMetrics
+    {
+    public:
+        /**
+         * @brief Constructs an EngineMetrics with no analyzer slots.
+         */
+        EngineMetrics();
+
+        /**
+         * @brief Destructor.
+         */
+        ~EngineMetrics();
+
+        EngineMetrics(const EngineMetrics &) = delete;
+
+        EngineMetrics &operator=(const EngineMetrics &) = delete;
+
+        EngineMetrics(EngineMetrics &&) = delete;
+
+        EngineMetrics &operator=(EngineMetrics &&) = delete;
+
+        /**
+         * @brief Sets the real-time budget of one hop and the ring capacity used for fill ratios.
+         * @param budgetNanoseconds Duration of one hop of audio in nanoseconds.
+         * @param ringCapacity Usable ring buffer capacity in samples.
+         */
+        void Configure(uint64_t budgetNanoseconds, size_t ringCapacity);
+
+        /**
+         * @brief Adds a timing slot for an analyzer. Must not be called while the engine runs.
+         * @param name Analyzer display name.
+         * @return Slot index passed to RecordAnalyzer().
+         */
+        size_t AddAnalyzer(std::string name);
+
+        /**
+         * @brief Records the duration of one analyzer's ProcessBuffer() call. Worker thread only.
+         * @param index Analyzer slot index.
+         * @param nanoseconds Call duration.
+         */
+        void RecordAnalyzer(size_t index, uint64_t nanoseconds) noexcept;
+
+        /**
+         * @brief Records a completed hop. Worker thread only.
+         * @param nanoseconds Total time spent in all analyzers.
+         * @param ringFill Ring buffer occupancy in samples before the hop was read.
+         */
+        void RecordHop(uint64_t nanoseconds, size_t ringFill) noexcept;
+
+        /**
+         * @brief Asks the worker thread to clear all statistics before its next hop.
+         */
+        void RequestReset() noexcept;
+
+        /**
+         * @brief Gets the number of analyzer slots.
+         * @return Slot count.
+         */
+        size_t GetAnalyzerCount() const;
+
+        /**
+         * @brief Gets the name of an analyzer slot.
+         * @param index Slot index.
+         * @return Analyzer display name.
+         */
+        const std::string &GetAnalyzerName(size_t index) const;
+
+        /**
+         * @brief Gets the ProcessBuffer() duration histogram of an analyzer slot.
+         * @param index Slot index.
+         * @return Histogram in nanoseconds.
+         */
+        const Util::LatencyHistogram &GetAnalyzerHistogram(size_t index) const;
+
+        /**
+         * @brief Gets the per-hop total duration histogram.
+         * @return Histogram in nanoseconds.
+         */
+        const Util::LatencyHistogram &GetHopHistogram() const;
+
+        /**
+         * @brief Gets the real-time budget of one hop.
+         * @return Budget in nanoseconds.
+         */
+        uint64_t GetHopBudget() const;
+
+        /**
+         * @brief Gets the number of hops whose total exceeded the budget.
+         * @return Deadline miss count.
+         */
+        uint64_t GetDeadlineMisses() const;
+
+        /**
+         * @brief Gets the most recently sampled ring buffer occupancy.
+         * @return Fill in samples.
+         */
+        size_t GetRingFill() const;
+
+        /**
+         * @brief Gets the highest sampled ring buffer occupancy.
+         * @return Peak fill in samples.
+         */
+        size_t GetPeakRingFill() const;
+
+        /**
+         * @brief Gets the ring buffer capacity.
+         * @return Capacity in samples.
+         */
+        size_t GetRingCapacity() const;
+
+    private:
+        /**
+         * @brief Timing slot of a single analyzer.
+         */
+        struct AnalyzerTiming
+        {
+            std::string name;                 ///< Analyzer display name.
+            Util::LatencyHistogram histogram; ///< ProcessBuffer() durations.
+
+            explicit AnalyzerTiming(std::string name);
+        };
+
+        /**
+         * @brief Clears all statistics. Worker thread only.
+         */
+        void Reset() noexcept;
+
+        std::vector<std::unique_ptr<AnalyzerTiming>> analyzers; ///< Per-analyzer slots.
+        Util::LatencyHistogram hopHistogram;                    ///< Per-hop totals.
+        uint64_t hopBudget;                                     ///< Real-time budget of one hop in nanoseconds.
+        size_t ringCapacity;                                    ///< Ring capacity in samples.
+        std::atomic<uint64_t> deadlineMisses;                   ///< Hops over budget.
+        std::atomic<size_t> ringFill;                           ///< Last sampled ring occupancy.
+        std::atomic<size_t> peakRingFill;                       ///< Highest sampled ring occupancy.
+        std::atomic<bool> resetRequested;                       ///< Set by RequestReset(), consumed by the worker.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
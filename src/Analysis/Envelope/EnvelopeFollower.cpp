@@ -0,0 +1,146 @@
+#include "Analysis/Envelope/EnvelopeFollower.h"
+
+#include "Util/Tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace
+    {
+        constexpr float g_kFastAttackSeconds = 0.0005f; ///< Fast envelope rise time constant.
+        constexpr float g_kFastReleaseSeconds = 0.06f;  ///< Fast envelope fall time constant.
+        constexpr float g_kSlowAttackSeconds = 0.03f;   ///< Slow envelope rise time constant.
+        constexpr float g_kSlowReleaseSeconds = 0.3f;   ///< Slow envelope fall time constant.
+        constexpr float g_kRefractorySeconds = 0.06f;   ///< Minimum spacing between two onsets.
+        constexpr float g_kOnsetRatio = 2.0f;           ///< Fast over slow envelope at an onset (about 6 dB).
+        constexpr float g_kGate = 0.00316f;             ///< Fast envelope below this (-50 dBFS) never triggers.
+        constexpr float g_kSilenceDb = -120.0f;         ///< Level reported for digital silence.
+
+        /**
+         * @brief Computes the per-sample coefficient of a one-pole smoother.
+         * @param seconds Time constant.
+         * @param sampleRate Sample rate in Hz.
+         * @return Coefficient in [0, 1); 0 follows the input immediately.
+         */
+        float OnePoleCoefficient(float seconds, float sampleRate)
+        {
+            if (seconds <= 0.0f || sampleRate <= 0.0f)
+            {
+                return 0.0f;
+            }
+            return std::exp(-1.0f / (seconds * sampleRate));
+        }
+    } // namespace
+
+    EnvelopeResult::EnvelopeResult()
+        : AnalysisResult(), levelDb(g_kSilenceDb), onsetCount(0), lastOnsetFrame(0), framesAnalyzed(0)
+    {
+    }
+
+    EnvelopeFollower::EnvelopeFollower()
+        : config(0.0f, 0), fastAttack(0.0f), fastRelease(0.0f), slowAttack(0.0f), slowRelease(0.0f),
+          refractoryFrames(0), fastEnvelope(0.0f), slowEnvelope(0.0f), frame(0), nextOnsetAllowed(0),
+          publishedLevelDb(g_kSilenceDb), publishedOnsetCount(0), publishedOnsetFrame(0), publishedFrames(0)
+    {
+    }
+
+    EnvelopeFollower::~EnvelopeFollower()
+    {
+    }
+
+    void EnvelopeFollower::Configure(const AnalysisConfig &newConfig)
+    {
+        config = newConfig;
+
+        fastAttack = OnePoleCoefficient(g_kFastAttackSeconds, config.sampleRate);
+        fastRelease = OnePoleCoefficient(g_kFastReleaseSeconds, config.sampleRate);
+        slowAttack = OnePoleCoefficient(g_kSlowAttackSeconds, config.sampleRate);
+        slowRelease = OnePoleCoefficient(g_kSlowReleaseSeconds, config.sampleRate);
+        refractoryFrames = static_cast<uint64_t>(std::max(0.0f, g_kRefractorySeconds * config.sampleRate));
+
+        Reset();
+    }
+
+    void EnvelopeFollower::ProcessBuffer(std::span<const float> audioData)
+    {
+        // With a fast path the same frames already went through ProcessFastBlock().
+        if (config.fastBlockSize == 0)
+        {
+            Track(audioData);
+        }
+    }
+
+    void EnvelopeFollower::ProcessFastBlock(std::span<const float> block)
+    {
+        Track(block);
+    }
+
+    void EnvelopeFollower::Track(std::span<const float> samples) noexcept
+    {
+        GD_TRACE_SCOPE("analyzer", "Envelope");
+
+        float fast = fastEnvelope;
+        float slow = slowEnvelope;
+        uint64_t onsets = publishedOnsetCount.load(std::memory_order_relaxed);
+        uint64_t onsetFrame = publishedOnsetFrame.load(std::memory_order_relaxed);
+
+        for (const float sample : samples)
+        {
+            const float magnitude = std::abs(sample);
+            fast = magnitude + (magnitude > fast ? fastAttack : fastRelease) * (fast - magnitude);
+            slow = magnitude + (magnitude > slow ? slowAttack : slowRelease) * (slow - magnitude);
+
+            if (fast > g_kGate && fast > g_kOnsetRatio * slow && frame >= nextOnsetAllowed)
+            {
+                ++onsets;
+                onsetFrame = frame;
+                nextOnsetAllowed = frame + refractoryFrames;
+            }
+            ++frame;
+        }
+
+        fastEnvelope = fast;
+        slowEnvelope = slow;
+
+        const float levelDb = fast > 0.0f ? std::max(g_kSilenceDb, 20.0f * std::log10(fast)) : g_kSilenceDb;
+        publishedLevelDb.store(levelDb, std::memory_order_relaxed);
+        publishedOnsetFrame.store(onsetFrame, std::memory_order_relaxed);
+        publishedFrames.store(frame, std::memory_order_relaxed);
+        publishedOnsetCount.store(onsets, std::memory_order_release);
+    }
+
+    std::shared_ptr<AnalysisResult> EnvelopeFollower::GetLatestResult() const
+    {
+        auto result = std::make_shared<EnvelopeResult>();
+        result->timestamp = std::chrono::system_clock::now();
+        result->onsetCount = publishedOnsetCount.load(std::memory_order_acquire);
+        result->lastOnsetFrame = publishedOnsetFrame.load(std::memory_order_relaxed);
+        result->framesAnalyzed = publishedFrames.load(std::memory_order_relaxed);
+        result->levelDb = publishedLevelDb.load(std::memory_order_relaxed);
+        result->isValid = result->framesAnalyzed > 0;
+        return result;
+    }
+
+    void EnvelopeFollower::Reset()
+    {
+        fastEnvelope = 0.0f;
+        slowEnvelope = 0.0f;
+        frame = 0;
+        nextOnsetAllowed = 0;
+
+        publishedLevelDb.store(g_kSilenceDb, std::memory_order_relaxed);
+        publishedOnsetFrame.store(0, std::memory_order_relaxed);
+        publishedFrames.store(0, std::memory_order_relaxed);
+        publishedOnsetCount.store(0, std::memory_order_release);
+    }
+
+    std::string EnvelopeFollower::GetName() const
+    {
+        return "Envelope";
+    }
+
+} // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Analysis/Analyzer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Result structure for the input envelope and note onsets.
+     */
+    struct EnvelopeResult : public AnalysisResult
+    {
+        float levelDb;           ///< Peak envelope in dBFS at the end of the last block.
+        uint64_t onsetCount;     ///< Onsets detected since the last reset.
+        uint64_t lastOnsetFrame; ///< Stream frame of the most recent onset.
+        uint64_t framesAnalyzed; ///< Frames tracked since the last reset.
+
+        /**
+         * @brief Constructs an EnvelopeResult with default values.
+         */
+        EnvelopeResult();
+    };
+
+    /**
+     * @brief Tracks the input level and detects note onsets with a few milliseconds of latency.
+     *
+     * Runs on the engine's fast path, so it reacts within one fast block instead of one hop.
+     * A fast peak envelope follows the attack of a pluck while a slow one lags behind it; an
+     * onset is reported at the first sample where the fast envelope rises a fixed ratio above
+     * the slow one, above a noise gate and outside a short refractory period. The work per
+     * sample is two one-pole filters and a compare. Without a fast path it tracks whole hops.
+     *
+     * Results are published through atomics, so the analysis thread never takes a lock for it.
+     */
+    class EnvelopeFollower final : public Analyzer
+    {
+    public:
+        /**
+         * @brief Constructs the EnvelopeFollower.
+         */
+        EnvelopeFollower();
+
+        /**
+         * @brief Destructor.
+         */
+        ~EnvelopeFollower() override;
+
+        EnvelopeFollower(const EnvelopeFollower &) = delete;
+
+        EnvelopeFollower &operator=(const EnvelopeFollower &) = delete;
+
+        EnvelopeFollower(EnvelopeFollower &&) = delete;
+
+        EnvelopeFollower &operator=(EnvelopeFollower &&) = delete;
+
+        void Configure(const AnalysisConfig &config) override;
+
+        void ProcessBuffer(std::span<const float> audioData) override;
+
+        void ProcessFastBlock(std::span<const float> block) override;
+
+        /**
+         * @brief Builds a result from the latest published values. Allocates on the calling thread.
+         * @return Shared pointer to an EnvelopeResult.
+         */
+        std::shared_ptr<AnalysisResult> GetLatestResult() const override;
+
+        void Reset() override;
+
+        std::string GetName() const override;
+
+    private:
+        /**
+         * @brief Runs the envelopes over a block and publishes the level and any onset.
+         * @param samples Audio samples.
+         */
+        void Track(std::span<const float> samples) noexcept;
+
+        AnalysisConfig config; ///< Analysis configuration.
+
+        float fastAttack;          ///< Per-sample coefficient of the fast envelope while rising.
+        float fastRelease;         ///< Per-sample coefficient of the fast envelope while falling.
+        float slowAttack;          ///< Per-sample coefficient of the slow envelope while rising.
+        float slowRelease;         ///< Per-sample coefficient of the slow envelope while falling.
+        uint64_t refractoryFrames; ///< Frames after an onset in which no new onset is reported.
+
+        float fastEnvelope;        ///< Fast peak envelope.
+        float slowEnvelope;        ///< Slow peak envelope.
+        uint64_t frame;            ///< Frames tracked since the last reset.
+        uint64_t nextOnsetAllowed; ///< First frame at which another onset may be reported.
+
+        std::atomic<float> publishedLevelDb;       ///< Level at the end of the last block.
+        std::atomic<uint64_t> publishedOnsetCount; ///< Onsets so far.
+        std::atomic<uint64_t> publishedOnsetFrame; ///< Frame of the latest onset.
+        std::atomic<uint64_t> publishedFrames;     ///< Frames tracked so far.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace Detail
+    {
+        constexpr double g_kPi = 3.14159265358979323846;
+
+        /**
+         * @brief Wraps an angle into [-pi, pi].
+         */
+        constexpr double WrapAngle(double angle)
+        {
+            while (angle > g_kPi)
+            {
+                angle -= 2.0 * g_kPi;
+            }
+            while (angle < -g_kPi)
+            {
+                angle += 2.0 * g_kPi;
+            }
+            return angle;
+        }
+
+        /**
+         * @brief Sine usable in constant expressions (std::sin is not constexpr in C++20).
+         *
+         * Sums the Taylor series of the wrapped angle; 20 terms are exact to double precision
+         * over [-pi, pi].
+         */
+        constexpr double ConstexprSin(double angle)
+        {
+            angle = WrapAngle(angle);
+            double term = angle;
+            double sum = angle;
+            for (int n = 1; n < 20; ++n)
+            {
+                term *= -angle * angle / static_cast<double>((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Cosine usable in constant expressions, by Taylor series like ConstexprSin().
+         */
+        constexpr double ConstexprCos(double angle)
+        {
+            angle = WrapAngle(angle);
+            double term = 1.0;
+            double sum = 1.0;
+            for (int n = 1; n < 20; ++n)
+            {
+                term *= -angle * angle / static_cast<double>((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Lookup tables of a FixedFFT, built entirely at compile time.
+         * @tparam N Transform length.
+         */
+        template<size_t N> struct FixedFFTTables
+        {
+            static constexpr size_t g_kTwiddleCount = 3 * N / 4; ///< Largest exponent a radix-4 stage uses, plus one.
+
+            std::array<float, N> window;                    ///< Symmetric Hann window.
+            std::array<uint32_t, N> bitReverse;             ///< [i] input sample loaded into slot i.
+            std::array<float, g_kTwiddleCount> twiddleReal; ///< [k] cos(-2 pi k / N).
+            std::array<float, g_kTwiddleCount> twiddleImag; ///< [k] sin(-2 pi k / N).
+        };
+
+        template<size_t N> constexpr FixedFFTTables<N> MakeFixedFFTTables()
+        {
+            FixedFFTTables<N> tables{};
+            constexpr int bits = std::countr_zero(N);
+
+            for (size_t i = 0; i < N; ++i)
+            {
+                const double phase = 2.0 * g_kPi * static_cast<double>(i) / static_cast<double>(N - 1);
+                tables.window[i] = static_cast<float>(0.5 - 0.5 * ConstexprCos(phase));
+
+                uint32_t reversed = 0;
+                for (int bit = 0; bit < bits; ++bit)
+                {
+                    reversed |= static_cast<uint32_t>((i >> bit) & 1u) << (bits - 1 - bit);
+                }
+                tables.bitReverse[i] = reversed;
+            }
+
+            for (size_t k = 0; k < FixedFFTTables<N>::g_kTwiddleCount; ++k)
+            {
+                const double angle = -2.0 * g_kPi * static_cast<double>(k) / static_cast<double>(N);
+                tables.twiddleReal[k] = static_cast<float>(ConstexprCos(angle));
+                tables.twiddleImag[k] = static_cast<float>(ConstexprSin(angle));
+            }
+
+            return tables;
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Windowed forward FFT whose length is fixed at compile time.
+     *
+     * The Hann window, bit-reversal permutation and twiddle factors are constexpr tables baked
+     * into the binary, so constructing a FixedFFT computes nothing and allocates nothing. The
+     * transform loads the windowed input in bit-reversed order and runs radix-4 stages (plus one
+     * radix-2 stage when log2(N) is odd); every stage is its own instantiation, so all loop
+     * bounds and table strides are constants the compiler can unroll and vectorize. Real and
+     * imaginary parts are kept in separate cache-line aligned arrays.
+     *
+     * Magnitudes are scaled by 1 / N. Not thread-safe; each thread needs its own instance.
+     *
+     * @tparam N Transform length, a power of two of at least 4.
+     */
+    template<size_t N> class FixedFFT
+    {
+    public:
+        static_assert(N >= 4 && std::has_single_bit(N), "FixedFFT length must be a power of two of at least 4");
+
+        static constexpr size_t g_kSize = N;         ///< Transform length in samples.
+        static constexpr size_t g_kBinCount = N / 2; ///< Magnitudes per spectrum, DC first.
+
+        /**
+         * @brief Constructs the FixedFFT. The tables are compile-time constants; nothing is computed here.
+         */
+        FixedFFT() noexcept;
+
+        /**
+         * @brief Windows the input and computes its complex spectrum.
+         * @param input Samples; the first N are used and shorter input is zero-padded.
+         */
+        void Transform(std::span<const float> input) noexcept;
+
+        /**
+         * @brief Transforms the input and writes the magnitude of every bin below Nyquist.
+         * @param input Samples; the first N are used and shorter input is zero-padded.
+         * @param magnitudes Receives up to g_kBinCount magnitudes scaled by 1 / N.
+         * @return Number of magnitudes written.
+         */
+        size_t ComputeMagnitudes(std::span<const float> input, std::span<float> magnitudes) noexcept;
+
+        /**
+         * @brief Gets the real parts of the last transform.
+         * @return N values, bin 0 first.
+         */
+        std::span<const float> GetReal() const noexcept;
+
+        /**
+         * @brief Gets the imaginary parts of the last transform.
+         * @return N values, bin 0 first.
+         */
+        std::span<const float> GetImag() const noexcept;
+
+        /**
+         * @brief Gets the compile-time tables.
+         * @return Window, permutation and twiddle tables.
+         */
+        static constexpr const Detail::FixedFFTTables<N> &GetTables() noexcept
+        {
+            return g_kTables;
+        }
+
+    private:
+        /**
+         * @brief Runs the radix-4 stage that merges four transforms of length Quarter, then the remaining stages.
+         * @tparam Quarter Length of the transforms merged by the first stage.
+         */
+        template<size_t Quarter> void RunStages() noexcept;
+
+        static constexpr Detail::FixedFFTTables<N> g_kTables = Detail::MakeFixedFFTTables<N>();
+
+        alignas(64) std::array<float, N> real; ///< Real parts, in place.
+        alignas(64) std::array<float, N> imag; ///< Imaginary parts, in place.
+    };
+
+    template<size_t N> FixedFFT<N>::FixedFFT() noexcept : real(), imag()
+    {
+    }
+
+    template<size_t N> void FixedFFT<N>::Transform(std::span<const float> input) noexcept
+    {
+        const size_t count = std::min(input.size(), N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            const uint32_t source = g_kTables.bitReverse[i];
+            real[i] = source < count ? input[source] * g_kTables.window[source] : 0.0f;
+            imag[i] = 0.0f;
+        }
+
+        if constexpr (std::countr_zero(N) % 2 == 1)
+        {
+            // Odd power of two: one radix-2 stage first, so the radix-4 stages end exactly at N.
+            for (size_t i = 0; i < N; i += 2)
+            {
+                const float evenReal = real[i];
+                const float oddReal = real[i + 1];
+                real[i] = evenReal + oddReal;
+                real[i + 1] = evenReal - oddReal;
+            }
+            RunStages<2>();
+        }
+        else
+        {
+            RunStages<1>();
+        }
+    }
+
+    template<size_t N>
+    template<size_t Quarter>
+    void FixedFFT<N>::RunStages() noexcept
+    {
+        if constexpr (Quarter < N)
+        {
+            constexpr size_t block = Quarter * 4;
+            constexpr size_t stride = N / block;
+
+            // Bit-reversed order leaves the sub-transforms of residues 0, 2, 1, 3 (mod 4) in the
+            // four quarters of each block.
+            for (size_t base = 0; base < N; base += block)
+            {
+                for (size_t j = 0; j < Quarter; ++j)
+                {
+                    const size_t i0 = base + j;
+                    const size_t i1 = i0 + Quarter;
+                    const size_t i2 = i1 + Quarter;
+                    const size_t i3 = i2 + Quarter;
+
+                    const float w1Real = g_kTables.twiddleReal[j * stride];
+                    const float w1Imag = g_kTables.twiddleImag[j * stride];
+                    const float w2Real = g_kTables.twiddleReal[2 * j * stride];
+                    const float w2Imag = g_kTables.twiddleImag[2 * j * stride];
+                    const float w3Real = g_kTables.twiddleReal[3 * j * stride];
+                    const float w3Imag = g_kTables.twiddleImag[3 * j * stride];
+
+                    const float s0Real = real[i0];
+                    const float s0Imag = imag[i0];
+                    const float s1Real = real[i2] * w1Real - imag[i2] * w1Imag;
+                    const float s1Imag = real[i2] * w1Imag + imag[i2] * w1Real;
+                    const float s2Real = real[i1] * w2Real - imag[i1] * w2Imag;
+                    const float s2Imag = real[i1] * w2Imag + imag[i1] * w2Real;
+                    const float s3Real = real[i3] * w3Real - imag[i3] * w3Imag;
+                    const float s3Imag = real[i3] * w3Imag + imag[i3] * w3Real;
+
+                    const float t0Real = s0Real + s2Real;
+                    const float t0Imag = s0Imag + s2Imag;
+                    const float t1Real = s0Real - s2Real;
+                    const float t1Imag = s0Imag - s2Imag;
+                    const float t2Real = s1Real + s3Real;
+                    const float t2Imag = s1Imag + s3Imag;
+                    const float t3Real = s1Real - s3Real;
+                    const float t3Imag = s1Imag - s3Imag;
+
+                    real[i0] = t0Real + t2Real;
+                    imag[i0] = t0Imag + t2Imag;
+                    real[i1] = t1Real + t3Imag;
+                    imag[i1] = t1Imag - t3Real;
+                    real[i2] = t0Real - t2Real;
+                    imag[i2] = t0Imag - t2Imag;
+                    real[i3] = t1Real - t3Imag;
+                    imag[i3] = t1Imag + t3Real;
+                }
+            }
+
+            RunStages<block>();
+        }
+    }
+
+    template<size_t N>
+    size_t FixedFFT<N>::ComputeMagnitudes(std::span<const float> input, std::span<float> magnitudes) noexcept
+    {
+        Transform(input);
+
+        constexpr float scale = 1.0f / static_cast<float>(N);
+        const size_t count = std::min(magnitudes.size(), g_kBinCount);
+        for (size_t bin = 0; bin < count; ++bin)
+        {
+            magnitudes[bin] = std::sqrt(real[bin] * real[bin] + imag[bin] * imag[bin]) * scale;
+        }
+
+        return count;
+    }
+
+    template<size_t N> std::span<const float> FixedFFT<N>::GetReal() const noexcept
+    {
+        return std::span<const float>(real.data(), N);
+    }
+
+    template<size_t N> std::span<const float> FixedFFT<N>::GetImag() const noexcept
+    {
+        return std::span<const float>(imag.data(), N);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
@@ -1,8 +1,13 @@
 #include "Analysis/Fretbuzz/FretBuzzDetector.h"
 
+#include "Analysis/Spectrogram.h"
+#include "Util/Tracer.h"
+
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <numeric>
+#include <utility>
 
 namespace GuitarDiagnostics::Analysis
 {
@@ -13,13 +18,16 @@ namespace GuitarDiagnostics::Analysis
     {
     }
 
-    FretBuzzDetector::FretBuzzDetector()
-        : config(0.0f, 0), pitchDetector(nullptr), fftProcessor(nullptr), audioBuffer(),
-          prevSpectrum(g_kFFTSize / 2, 0.0f), rmsHistory(10, 0.0f), prevRMS(0.0f), onsetActive(false),
+    FretBuzzDetector::FretBuzzDetector(const FretBuzzParameters &newParameters)
+        : config(0.0f, 0), parameters(newParameters), pitchDetector(nullptr), fftProcessor(nullptr),
+          spectrogram(nullptr), kernels(nullptr), arena(), currentSpectrum(), prevSpectrum(), rmsHistory(),
+          currentMagnitudeSum(0.0f), prevMagnitudeSum(0.0f), prevRMS(0.0f), onsetActive(false),
           currentBuzzScore(0.0f), currentOnsetDetected(false), currentTransientScore(0.0f),
           currentHighFreqEnergyScore(0.0f), currentInharmonicityScore(0.0f),
-          latestResult(std::make_shared<FretBuzzResult>())
+          latestResult(std::make_shared<FretBuzzResult>()), resultPool()
     {
+        parameters.fftSize = std::bit_ceil(std::clamp<size_t>(parameters.fftSize, 256, 16384));
+        parameters.numHarmonics = std::clamp<size_t>(parameters.numHarmonics, 1, g_kMaxHarmonics);
     }
 
     FretBuzzDetector::~FretBuzzDetector()
@@ -31,12 +39,21 @@ namespace GuitarDiagnostics::Analysis
         config = newConfig;
 
         GuitarDSP::YinPitchDetectorConfig yinConfig;
-        yinConfig.threshold = 0.15f;
+        yinConfig.threshold = parameters.yinThreshold;
         yinConfig.minFrequency = 80.0f;
         yinConfig.maxFrequency = 1200.0f;
 
         pitchDetector = std::make_unique<GuitarDSP::YinPitchDetector>(yinConfig);
-        fftProcessor = std::make_unique<GuitarDSP::FFTProcessor>(g_kFFTSize, config.sampleRate);
+        fftProcessor = std::make_unique<GuitarDSP::FFTProcessor>(parameters.fftSize, config.sampleRate);
+
+        kernels = &KernelRegistry::GetKernels();
+
+        const size_t binCount = parameters.fftSize / 2;
+        arena.Reset(
+            2 * Util::Arena::GetFootprint<float>(binCount) + Util::Arena::GetFootprint<float>(g_kRmsHistorySize));
+        currentSpectrum = arena.Allocate<float>(binCount);
+        prevSpectrum = arena.Allocate<float>(binCount);
+        rmsHistory = arena.Allocate<float>(g_kRmsHistorySize);
     }
 
     void FretBuzzDetector::ProcessBuffer(std::span<const float> audioData)
@@ -46,27 +63,67 @@ namespace GuitarDiagnostics::Analysis
             return;
         }
 
-        audioBuffer.assign(audioData.begin(), audioData.end());
+        ProcessHop(audioData);
+        UpdateResult();
+    }
+
+    void FretBuzzDetector::ProcessBlocks(std::span<const float> samples, size_t hop)
+    {
+        if (!fftProcessor || !pitchDetector || hop == 0 || samples.size() < hop)
+        {
+            return;
+        }
+
+        bool anyOnset = false;
+        for (size_t offset = 0; offset + hop <= samples.size(); offset += hop)
+        {
+            ProcessHop(samples.subspan(offset, hop));
+            anyOnset |= currentOnsetDetected;
+        }
+        currentOnsetDetected = anyOnset;
+
+        UpdateResult();
+    }
 
-        fftProcessor->ComputeSpectrum(audioData);
+    void FretBuzzDetector::ProcessHop(std::span<const float> audioData)
+    {
+        {
+            GD_TRACE_SCOPE("Fret Buzz", "FFT");
+            fftProcessor->ComputeSpectrum(audioData);
+        }
 
+        // Contiguous copy of the magnitudes for the kernels; swapped into prevSpectrum after the hop.
         const auto &spectrum = fftProcessor->GetSpectrum();
-        for (size_t i = 0; i < prevSpectrum.size(); ++i)
+        currentMagnitudeSum = 0.0f;
+        for (size_t i = 0; i < currentSpectrum.size(); ++i)
         {
-            prevSpectrum[i] = spectrum.GetMagnitudeAtBin(i);
+            currentSpectrum[i] = spectrum.GetMagnitudeAtBin(i);
+            currentMagnitudeSum += currentSpectrum[i];
         }
 
-        bool onset = DetectOnset(audioData);
-        currentOnsetDetected = onset;
+        if (spectrogram)
+        {
+            GD_TRACE_SCOPE("Fret Buzz", "Spectrogram");
+            spectrogram->PushSpectrum(currentSpectrum);
+        }
 
-        currentTransientScore = AnalyzeTransient(audioData);
-        currentHighFreqEnergyScore = AnalyzeHighFrequencyNoise();
-        currentInharmonicityScore = AnalyzeInharmonicity();
+        {
+            GD_TRACE_SCOPE("Fret Buzz", "Transient");
+            bool onset = DetectOnset(audioData);
+            currentOnsetDetected = onset;
 
-        currentBuzzScore =
-            0.3f * currentTransientScore + 0.4f * currentHighFreqEnergyScore + 0.3f * currentInharmonicityScore;
+            currentTransientScore = AnalyzeTransient(audioData);
+            currentHighFreqEnergyScore = AnalyzeHighFrequencyNoise();
+        }
 
-        UpdateResult();
+        currentInharmonicityScore = AnalyzeInharmonicity(audioData);
+
+        currentBuzzScore = parameters.transientWeight * currentTransientScore
+                           + parameters.highFreqWeight * currentHighFreqEnergyScore
+                           + parameters.inharmonicityWeight * currentInharmonicityScore;
+
+        std::swap(currentSpectrum, prevSpectrum);
+        prevMagnitudeSum = currentMagnitudeSum;
     }
 
     std::shared_ptr<AnalysisResult> FretBuzzDetector::GetLatestResult() const
@@ -79,7 +136,10 @@ namespace GuitarDiagnostics::Analysis
     {
         prevRMS = 0.0f;
         onsetActive = false;
+        std::fill(currentSpectrum.begin(), currentSpectrum.end(), 0.0f);
         std::fill(prevSpectrum.begin(), prevSpectrum.end(), 0.0f);
+        currentMagnitudeSum = 0.0f;
+        prevMagnitudeSum = 0.0f;
         std::fill(rmsHistory.begin(), rmsHistory.end(), 0.0f);
 
         currentBuzzScore = 0.0f;
@@ -91,6 +151,33 @@ namespace GuitarDiagnostics::Analysis
         UpdateResult();
     }
 
+    std::string FretBuzzDetector::GetName() const
+    {
+        return "Fret Buzz";
+    }
+
+    void FretBuzzDetector::ApplyParameters(const AnalyzerParameters &newParameters)
+    {
+        const auto &update = newParameters.fretBuzz;
+        parameters.onsetThreshold = update.onsetThreshold;
+        parameters.fluxThreshold = update.fluxThreshold;
+        parameters.highFreqMin = update.highFreqMin;
+        parameters.highFreqMax = update.highFreqMax;
+        parameters.transientWeight = update.transientWeight;
+        parameters.highFreqWeight = update.highFreqWeight;
+        parameters.inharmonicityWeight = update.inharmonicityWeight;
+    }
+
+    const FretBuzzParameters &FretBuzzDetector::GetParameters() const
+    {
+        return parameters;
+    }
+
+    void FretBuzzDetector::SetSpectrogram(Spectrogram *newSpectrogram)
+    {
+        spectrogram = newSpectrogram;
+    }
+
     bool FretBuzzDetector::DetectOnset(std::span<const float> audioData)
     {
         float rms = CalculateRMSEnergy(audioData);
@@ -100,7 +187,7 @@ namespace GuitarDiagnostics::Analysis
         if (prevRMS > 0.0f)
         {
             float rmsRatio = rms / prevRMS;
-            onset = (rmsRatio > g_kOnsetThreshold) || (spectralFlux > g_kOnsetThreshold);
+            onset = (rmsRatio > parameters.onsetThreshold) || (spectralFlux > parameters.fluxThreshold);
         }
 
         prevRMS = rms;
@@ -109,32 +196,18 @@ namespace GuitarDiagnostics::Analysis
 
     float FretBuzzDetector::CalculateRMSEnergy(std::span<const float> audioData) const
     {
-        float sumSquares = 0.0f;
-        for (const auto &sample : audioData)
-        {
-            sumSquares += sample * sample;
-        }
-
-        return std::sqrt(sumSquares / static_cast<float>(audioData.size()));
+        return std::sqrt(kernels->sumOfSquares(audioData) / static_cast<float>(audioData.size()));
     }
 
     float FretBuzzDetector::CalculateSpectralFlux() const
     {
-        float flux = 0.0f;
-        const auto &spectrum = fftProcessor->GetSpectrum();
-        const size_t numBins = std::min(prevSpectrum.size(), static_cast<size_t>(g_kFFTSize / 2));
-
-        for (size_t i = 0; i < numBins; ++i)
+        // Relative to the previous hop's level, so a steady note stays near zero at any loudness.
+        if (prevMagnitudeSum <= 0.0f)
         {
-            float magnitude = spectrum.GetMagnitudeAtBin(i);
-            float diff = magnitude - prevSpectrum[i];
-            if (diff > 0.0f)
-            {
-                flux += diff;
-            }
+            return 0.0f;
         }
 
-        return flux;
+        return kernels->positiveDifferenceSum(currentSpectrum, prevSpectrum) / prevMagnitudeSum;
     }
 
     float FretBuzzDetector::AnalyzeTransient(std::span<const float> audioData)
@@ -150,11 +223,7 @@ namespace GuitarDiagnostics::Analysis
 
     float FretBuzzDetector::CalculateAttackTime(std::span<const float> audioData) const
     {
-        float maxAmplitude = 0.0f;
-        for (const auto &sample : audioData)
-        {
-            maxAmplitude = std::max(maxAmplitude, std::abs(sample));
-        }
+        const float maxAmplitude = kernels->peakAbsolute(audioData);
 
         if (maxAmplitude < 0.01f)
         {
@@ -183,14 +252,7 @@ namespace GuitarDiagnostics::Analysis
             return 0.0f;
         }
 
-        size_t crossings = 0;
-        for (size_t i = 1; i < audioData.size(); ++i)
-        {
-            if ((audioData[i - 1] >= 0.0f && audioData[i] < 0.0f) || (audioData[i - 1] < 0.0f && audioData[i] >= 0.0f))
-            {
-                crossings++;
-            }
-        }
+        const size_t crossings = kernels->countZeroCrossings(audioData);
 
         float duration = static_cast<float>(audioData.size()) / config.sampleRate;
         return static_cast<float>(crossings) / duration;
@@ -199,7 +261,7 @@ namespace GuitarDiagnostics::Analysis
     float FretBuzzDetector::AnalyzeHighFrequencyNoise()
     {
         const auto &spectrum = fftProcessor->GetSpectrum();
-        float highFreqEnergy = spectrum.ExtractBandEnergy(g_kHighFreqMin, g_kHighFreqMax);
+        float highFreqEnergy = spectrum.ExtractBandEnergy(parameters.highFreqMin, parameters.highFreqMax);
         float totalEnergy = spectrum.ExtractBandEnergy(80.0f, 12000.0f);
 
         if (totalEnergy < 1e-6f)
@@ -210,78 +272,79 @@ namespace GuitarDiagnostics::Analysis
         return std::clamp(highFreqEnergy / totalEnergy, 0.0f, 1.0f);
     }
 
-    float FretBuzzDetector::AnalyzeInharmonicity()
+    float FretBuzzDetector::AnalyzeInharmonicity(std::span<const float> audioData)
     {
-        if (!pitchDetector || audioBuffer.empty())
+        if (!pitchDetector || audioData.empty())
         {
             return 0.0f;
         }
 
-        auto pitchResult = pitchDetector->Detect(audioBuffer, config.sampleRate);
+        float fundamental = 0.0f;
+        float confidence = 0.0f;
+        {
+            GD_TRACE_SCOPE("Fret Buzz", "YIN");
+            auto pitchResult = pitchDetector->Detect(audioData, config.sampleRate);
+            if (pitchResult.has_value())
+            {
+                fundamental = pitchResult->frequency;
+                confidence = pitchResult->confidence;
+            }
+        }
 
-        if (!pitchResult.has_value() || pitchResult->confidence < 0.5f)
+        if (confidence < 0.5f)
         {
             return 0.0f;
         }
 
-        float fundamental = pitchResult->frequency;
-        auto harmonics = ExtractHarmonics(fundamental);
+        GD_TRACE_SCOPE("Fret Buzz", "Harmonics");
+        HarmonicFrame harmonics;
+        ExtractHarmonics(fundamental, harmonics);
 
         return CalculateInharmonicityMetric(harmonics, fundamental);
     }
 
-    std::vector<float> FretBuzzDetector::ExtractHarmonics(float fundamental) const
+    void FretBuzzDetector::ExtractHarmonics(float fundamental, HarmonicFrame &harmonics) const
     {
-        std::vector<float> harmonics;
-        harmonics.reserve(g_kNumHarmonics);
-
+        harmonics.Clear();
         if (config.sampleRate <= 0.0f)
         {
-            return harmonics;
+            return;
         }
 
         const auto &spectrum = fftProcessor->GetSpectrum();
-
-        for (size_t n = 1; n <= g_kNumHarmonics; ++n)
+        for (size_t n = 1; n <= parameters.numHarmonics; ++n)
         {
             float expectedFreq = fundamental * static_cast<float>(n);
-            float magnitude = spectrum.GetMagnitudeAtFrequency(expectedFreq);
-            harmonics.push_back(magnitude);
+            harmonics.PushBack(spectrum.GetMagnitudeAtFrequency(expectedFreq));
         }
-
-        return harmonics;
     }
 
-    float FretBuzzDetector::CalculateInharmonicityMetric(const std::vector<float> &harmonics, float fundamental) const
+    float FretBuzzDetector::CalculateInharmonicityMetric(const HarmonicFrame &harmonics, float fundamental) const
     {
-        if (harmonics.empty() || fundamental <= 0.0f)
+        if (harmonics.IsEmpty() || fundamental <= 0.0f)
         {
             return 0.0f;
         }
 
-        const auto &spectrum = fftProcessor->GetSpectrum();
         float totalDeviation = 0.0f;
-        float binWidth = config.sampleRate / static_cast<float>(g_kFFTSize);
+        float binWidth = config.sampleRate / static_cast<float>(parameters.fftSize);
 
-        for (size_t n = 0; n < harmonics.size(); ++n)
+        for (size_t n = 0; n < harmonics.GetSize(); ++n)
         {
             float expectedFreq = fundamental * static_cast<float>(n + 1);
             size_t expectedBin = static_cast<size_t>(expectedFreq / binWidth);
 
-            float maxMag = 0.0f;
+            // Strongest bin within two bins of the expected one; a silent window keeps the expected bin.
             size_t actualBin = expectedBin;
-
-            for (int offset = -2; offset <= 2; ++offset)
+            const size_t first = expectedBin >= 2 ? expectedBin - 2 : 0;
+            const size_t last = std::min(expectedBin + 3, currentSpectrum.size());
+            if (first < last)
             {
-                int checkBin = static_cast<int>(expectedBin) + offset;
-                if (checkBin >= 0 && checkBin < static_cast<int>(g_kFFTSize / 2))
+                const auto window = std::span<const float>(currentSpectrum).subspan(first, last - first);
+                const size_t peak = kernels->findPeak(window);
+                if (window[peak] > 0.0f)
                 {
-                    float mag = spectrum.GetMagnitudeAtBin(static_cast<size_t>(checkBin));
-                    if (mag > maxMag)
-                    {
-                        maxMag = mag;
-                        actualBin = static_cast<size_t>(checkBin);
-                    }
+                    actualBin = first + peak;
                 }
             }
 
@@ -290,12 +353,14 @@ namespace GuitarDiagnostics::Analysis
             totalDeviation += deviation;
         }
 
-        return std::clamp(totalDeviation / static_cast<float>(harmonics.size()), 0.0f, 1.0f);
+        return std::clamp(totalDeviation / static_cast<float>(harmonics.GetSize()), 0.0f, 1.0f);
     }
 
     void FretBuzzDetector::UpdateResult()
     {
-        auto result = std::make_shared<FretBuzzResult>();
+        GD_TRACE_SCOPE("Fret Buzz", "Publish");
+
+        auto result = resultPool.Acquire(latestResult);
         result->timestamp = std::chrono::system_clock::now();
         result->isValid = true;
         result->buzzScore = currentBuzzScore;
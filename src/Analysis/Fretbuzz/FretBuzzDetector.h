@@ -1,16 +1,22 @@
 #pragma once
 
 #include "Analysis/Analyzer.h"
+#include "Analysis/AnalyzerParameters.h"
+#include "Analysis/HarmonicFrame.h"
+#include "Analysis/Kernels/KernelRegistry.h"
+#include "Analysis/ResultPool.h"
+#include "Util/Arena.h"
 
 #include <FFTProcessor.h>
 #include <YinPitchDetector.h>
 
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <span>
 
 namespace GuitarDiagnostics::Analysis
 {
+    class Spectrogram;
 
     /**
      * @brief Result structure for fret buzz analysis.
@@ -35,13 +41,14 @@ namespace GuitarDiagnostics::Analysis
      * Uses spectral analysis to identify high-frequency noise and inharmonicity
      * characteristic of fret buzz.
      */
-    class FretBuzzDetector : public Analyzer
+    class FretBuzzDetector final : public Analyzer
     {
     public:
         /**
          * @brief Constructs the FretBuzzDetector.
+         * @param parameters Tuning parameters; out-of-range values are clamped.
          */
-        FretBuzzDetector();
+        explicit FretBuzzDetector(const FretBuzzParameters &parameters = FretBuzzParameters());
 
         /**
          * @brief Destructor.
@@ -60,11 +67,44 @@ namespace GuitarDiagnostics::Analysis
 
         void ProcessBuffer(std::span<const float> audioData) override;
 
+        /**
+         * @brief Scores every hop and publishes one result for the batch.
+         *
+         * The published scores are those of the last hop; onsetDetected is set if any hop had an onset.
+         * @param samples Audio samples of the hops, back to back.
+         * @param hop Frames per hop.
+         */
+        void ProcessBlocks(std::span<const float> samples, size_t hop) override;
+
         std::shared_ptr<AnalysisResult> GetLatestResult() const override;
 
         void Reset() override;
 
+        std::string GetName() const override;
+
+        void ApplyParameters(const AnalyzerParameters &parameters) override;
+
+        /**
+         * @brief Gets the tuning parameters in use.
+         * @return Parameters after clamping.
+         */
+        const FretBuzzParameters &GetParameters() const;
+
+        /**
+         * @brief Shares every hop's spectrum with a spectrogram, so displays need no FFT of their own.
+         *
+         * Must not be called while the engine is running.
+         * @param spectrogram Spectrogram that outlives the detector, or nullptr to stop sharing.
+         */
+        void SetSpectrogram(Spectrogram *spectrogram);
+
     private:
+        /**
+         * @brief Computes the spectrum and scores of one hop, without publishing.
+         * @param audioData Audio samples of the hop.
+         */
+        void ProcessHop(std::span<const float> audioData);
+
         /**
          * @brief Detects note onsets in the audio signal.
          * @param audioData Input audio buffer.
@@ -80,8 +120,8 @@ namespace GuitarDiagnostics::Analysis
         float CalculateRMSEnergy(std::span<const float> audioData) const;
 
         /**
-         * @brief Calculates change in spectral energy.
-         * @return Spectral flux value.
+         * @brief Calculates the rise in spectral magnitude since the previous hop.
+         * @return Summed magnitude increase divided by the previous hop's magnitude sum, 0 after silence.
          */
         float CalculateSpectralFlux() const;
 
@@ -114,24 +154,25 @@ namespace GuitarDiagnostics::Analysis
 
         /**
          * @brief Analyzes signal inharmonicity.
+         * @param audioData Input audio samples.
          * @return Inharmonicity score.
          */
-        float AnalyzeInharmonicity();
+        float AnalyzeInharmonicity(std::span<const float> audioData);
 
         /**
-         * @brief Extracts harmonic peaks from the spectrum.
+         * @brief Extracts harmonic magnitudes from the spectrum.
          * @param fundamental The fundamental frequency.
-         * @return Vector of harmonic peak frequencies.
+         * @param harmonics Receives the magnitudes of harmonics 1..parameters.numHarmonics.
          */
-        std::vector<float> ExtractHarmonics(float fundamental) const;
+        void ExtractHarmonics(float fundamental, HarmonicFrame &harmonics) const;
 
         /**
          * @brief Calculates inharmonicity score from harmonics.
-         * @param harmonics Vector of harmonic frequencies.
+         * @param harmonics Harmonic magnitudes.
          * @param fundamental The fundamental frequency.
          * @return Inharmonicity metric.
          */
-        float CalculateInharmonicityMetric(const std::vector<float> &harmonics, float fundamental) const;
+        float CalculateInharmonicityMetric(const HarmonicFrame &harmonics, float fundamental) const;
 
         /**
          * @brief Updates the shared result structure.
@@ -139,13 +180,19 @@ namespace GuitarDiagnostics::Analysis
         void UpdateResult();
 
         AnalysisConfig config;
+        FretBuzzParameters parameters;
 
         std::unique_ptr<GuitarDSP::YinPitchDetector> pitchDetector;
         std::unique_ptr<GuitarDSP::FFTProcessor> fftProcessor;
+        Spectrogram *spectrogram;
+        const KernelTable *kernels;
 
-        std::vector<float> audioBuffer;
-        std::vector<float> prevSpectrum;
-        std::vector<float> rmsHistory;
+        Util::Arena arena;
+        std::span<float> currentSpectrum;
+        std::span<float> prevSpectrum;
+        std::span<float> rmsHistory;
+        float currentMagnitudeSum;
+        float prevMagnitudeSum;
 
         float prevRMS;
         bool onsetActive;
@@ -158,13 +205,10 @@ namespace GuitarDiagnostics::Analysis
 
         mutable std::mutex resultMutex;
         std::shared_ptr<FretBuzzResult> latestResult;
+        ResultPool<FretBuzzResult> resultPool;
 
-        static constexpr size_t g_kFFTSize = 2048;
-        static constexpr float g_kOnsetThreshold = 1.5f;
         static constexpr float g_kBuzzThreshold = 0.3f;
-        static constexpr float g_kHighFreqMin = 4000.0f;
-        static constexpr float g_kHighFreqMax = 8000.0f;
-        static constexpr size_t g_kNumHarmonics = 10;
+        static constexpr size_t g_kRmsHistorySize = 10;
     };
 
 } // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Util/StaticVector.h"
+
+#include <cstddef>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    constexpr size_t g_kMaxHarmonics = 32; ///< Upper bound of the numHarmonics analyzer parameters.
+
+    /**
+     * @brief Per-hop values of harmonics 1..n, one slot per harmonic, fundamental first.
+     *
+     * Holds magnitudes or peak frequencies of up to g_kMaxHarmonics harmonics inline and
+     * cache-line aligned, so the spectral feature path builds one on the stack every hop
+     * without allocating.
+     */
+    using HarmonicFrame = Util::StaticVector<float, g_kMaxHarmonics>;
+
+} // namespace GuitarDiagnostics::Analysis
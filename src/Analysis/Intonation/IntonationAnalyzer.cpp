@@ -1,6 +1,10 @@
 #include "Analysis/Intonation/IntonationAnalyzer.h"
 
+#include "Analysis/AnalysisClock.h"
+#include "Util/Tracer.h"
+
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <numeric>
 
@@ -13,12 +17,15 @@ namespace GuitarDiagnostics::Analysis
     {
     }
 
-    IntonationAnalyzer::IntonationAnalyzer()
-        : config(0.0f, 0), pitchDetector(nullptr), currentState(IntonationState::Idle),
-          pitchAccumulator(g_kPitchAccumulatorSize, 0.0f), pitchCount(0),
-          stateStartTime(std::chrono::steady_clock::now()), openStringFreq(0.0f), frettedStringFreq(0.0f),
-          centDeviation(0.0f), isInTune(false), latestResult(std::make_shared<IntonationResult>())
+    IntonationAnalyzer::IntonationAnalyzer(const IntonationParameters &newParameters)
+        : config(0.0f, 0), parameters(newParameters), pitchDetector(nullptr), currentState(IntonationState::Idle),
+          arena(), pitchAccumulator(), pitchCount(0),
+          stateStartTime(config.clock->Now()), batchLag(0), openStringFreq(0.0f), frettedStringFreq(0.0f),
+          centDeviation(0.0f), isInTune(false), latestResult(std::make_shared<IntonationResult>()),
+          resultPool()
     {
+        parameters.pitchAccumulatorSize =
+            std::clamp<size_t>(parameters.pitchAccumulatorSize, 10, g_kMaxPitchAccumulatorSize);
     }
 
     IntonationAnalyzer::~IntonationAnalyzer()
@@ -30,11 +37,16 @@ namespace GuitarDiagnostics::Analysis
         config = newConfig;
 
         GuitarDSP::YinPitchDetectorConfig yinConfig;
-        yinConfig.threshold = 0.15f;
+        yinConfig.threshold = parameters.yinThreshold;
         yinConfig.minFrequency = 80.0f;
         yinConfig.maxFrequency = 1200.0f;
 
         pitchDetector = std::make_unique<GuitarDSP::YinPitchDetector>(yinConfig);
+
+        arena.Reset(Util::Arena::GetFootprint<float>(parameters.pitchAccumulatorSize));
+        pitchAccumulator = arena.Allocate<float>(parameters.pitchAccumulatorSize);
+        pitchCount = 0;
+        stateStartTime = config.clock->Now();
     }
 
     void IntonationAnalyzer::ProcessBuffer(std::span<const float> audioData)
@@ -44,21 +56,54 @@ namespace GuitarDiagnostics::Analysis
             return;
         }
 
-        auto pitchResult = pitchDetector->Detect(audioData, config.sampleRate);
+        ProcessHop(audioData);
+        UpdateResult();
+    }
+
+    void IntonationAnalyzer::ProcessBlocks(std::span<const float> samples, size_t hop)
+    {
+        if (!pitchDetector || hop == 0 || samples.size() < hop)
+        {
+            return;
+        }
 
-        if (pitchResult.has_value())
+        // The clock already reads the end of the batch; date every hop by how much audio follows it.
+        const size_t hopCount = samples.size() / hop;
+        for (size_t i = 0; i < hopCount; ++i)
         {
-            float frequency = pitchResult->frequency;
-            float confidence = pitchResult->confidence;
+            batchLag = AnalysisClock::FramesToDuration((hopCount - 1 - i) * hop, config.sampleRate);
+            ProcessHop(samples.subspan(i * hop, hop));
+        }
+        batchLag = std::chrono::nanoseconds(0);
+
+        UpdateResult();
+    }
 
-            if (confidence >= g_kConfidenceThreshold)
+    void IntonationAnalyzer::ProcessHop(std::span<const float> audioData)
+    {
+        float frequency = 0.0f;
+        float confidence = 0.0f;
+        {
+            GD_TRACE_SCOPE("Intonation", "YIN");
+            auto pitchResult = pitchDetector->Detect(audioData, config.sampleRate);
+            if (pitchResult.has_value())
             {
-                AccumulatePitch(frequency);
-                UpdateStateMachine(frequency, confidence);
+                frequency = pitchResult->frequency;
+                confidence = pitchResult->confidence;
             }
         }
 
-        UpdateResult();
+        if (confidence >= parameters.confidenceThreshold)
+        {
+            GD_TRACE_SCOPE("Intonation", "State Machine");
+            AccumulatePitch(frequency);
+            UpdateStateMachine(frequency, confidence);
+        }
+    }
+
+    std::chrono::nanoseconds IntonationAnalyzer::GetHopTime() const
+    {
+        return config.clock->Now() - batchLag;
     }
 
     std::shared_ptr<AnalysisResult> IntonationAnalyzer::GetLatestResult() const
@@ -76,11 +121,30 @@ namespace GuitarDiagnostics::Analysis
         frettedStringFreq = 0.0f;
         centDeviation = 0.0f;
         isInTune = false;
-        stateStartTime = std::chrono::steady_clock::now();
+        stateStartTime = config.clock->Now();
 
         UpdateResult();
     }
 
+    std::string IntonationAnalyzer::GetName() const
+    {
+        return "Intonation";
+    }
+
+    void IntonationAnalyzer::ApplyParameters(const AnalyzerParameters &newParameters)
+    {
+        const auto &update = newParameters.intonation;
+        parameters.confidenceThreshold = update.confidenceThreshold;
+        parameters.stableTime = update.stableTime;
+        parameters.inTuneTolerance = update.inTuneTolerance;
+        parameters.stabilityThreshold = update.stabilityThreshold;
+    }
+
+    const IntonationParameters &IntonationAnalyzer::GetParameters() const
+    {
+        return parameters;
+    }
+
     void IntonationAnalyzer::UpdateStateMachine([[maybe_unused]] float frequency, [[maybe_unused]] float confidence)
     {
         switch (currentState)
@@ -95,10 +159,10 @@ namespace GuitarDiagnostics::Analysis
         case IntonationState::OpenString:
             if (HasStablePitch())
             {
-                auto now = std::chrono::steady_clock::now();
+                auto now = GetHopTime();
                 auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - stateStartTime);
 
-                if (elapsed >= g_kStableTimeRequired)
+                if (elapsed >= parameters.stableTime)
                 {
                     TransitionToWaitFor12thFret();
                 }
@@ -121,10 +185,10 @@ namespace GuitarDiagnostics::Analysis
         case IntonationState::FrettedString:
             if (HasStablePitch())
             {
-                auto now = std::chrono::steady_clock::now();
+                auto now = GetHopTime();
                 auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - stateStartTime);
 
-                if (elapsed >= g_kStableTimeRequired)
+                if (elapsed >= parameters.stableTime)
                 {
                     TransitionToComplete();
                 }
@@ -141,14 +205,14 @@ namespace GuitarDiagnostics::Analysis
         currentState = IntonationState::OpenString;
         openStringFreq = frequency;
         pitchCount = 0;
-        stateStartTime = std::chrono::steady_clock::now();
+        stateStartTime = GetHopTime();
     }
 
     void IntonationAnalyzer::TransitionToWaitFor12thFret()
     {
         currentState = IntonationState::WaitFor12thFret;
         pitchCount = 0;
-        stateStartTime = std::chrono::steady_clock::now();
+        stateStartTime = GetHopTime();
     }
 
     void IntonationAnalyzer::TransitionToFrettedString(float frequency)
@@ -156,7 +220,7 @@ namespace GuitarDiagnostics::Analysis
         currentState = IntonationState::FrettedString;
         frettedStringFreq = frequency;
         pitchCount = 0;
-        stateStartTime = std::chrono::steady_clock::now();
+        stateStartTime = GetHopTime();
     }
 
     void IntonationAnalyzer::TransitionToComplete()
@@ -167,7 +231,7 @@ namespace GuitarDiagnostics::Analysis
 
     void IntonationAnalyzer::AccumulatePitch(float frequency)
     {
-        if (pitchCount < g_kPitchAccumulatorSize)
+        if (pitchCount < pitchAccumulator.size())
         {
             pitchAccumulator[pitchCount] = frequency;
             pitchCount++;
@@ -175,7 +239,7 @@ namespace GuitarDiagnostics::Analysis
         else
         {
             std::shift_left(pitchAccumulator.begin(), pitchAccumulator.end(), 1);
-            pitchAccumulator[g_kPitchAccumulatorSize - 1] = frequency;
+            pitchAccumulator.back() = frequency;
         }
     }
 
@@ -186,11 +250,12 @@ namespace GuitarDiagnostics::Analysis
             return 0.0f;
         }
 
-        std::vector<float> sortedPitches(pitchAccumulator.begin(), pitchAccumulator.begin() + pitchCount);
-        std::sort(sortedPitches.begin(), sortedPitches.end());
+        std::array<float, g_kMaxPitchAccumulatorSize> sortedPitches{};
+        std::copy(pitchAccumulator.begin(), pitchAccumulator.begin() + pitchCount, sortedPitches.begin());
+        std::sort(sortedPitches.begin(), sortedPitches.begin() + pitchCount);
 
-        size_t medianIndex = sortedPitches.size() / 2;
-        if (sortedPitches.size() % 2 == 0)
+        size_t medianIndex = pitchCount / 2;
+        if (pitchCount % 2 == 0)
         {
             return (sortedPitches[medianIndex - 1] + sortedPitches[medianIndex]) / 2.0f;
         }
@@ -208,7 +273,7 @@ namespace GuitarDiagnostics::Analysis
         }
 
         float stdDev = CalculateStandardDeviation();
-        return stdDev < g_kStabilityThreshold;
+        return stdDev < parameters.stabilityThreshold;
     }
 
     float IntonationAnalyzer::CalculateStandardDeviation() const
@@ -239,7 +304,7 @@ namespace GuitarDiagnostics::Analysis
         if (frettedStringFreq > 0.0f && expectedFretted > 0.0f)
         {
             centDeviation = 1200.0f * std::log2(frettedStringFreq / expectedFretted);
-            isInTune = std::abs(centDeviation) <= g_kInTuneTolerance;
+            isInTune = std::abs(centDeviation) <= parameters.inTuneTolerance;
         }
         else
         {
@@ -250,7 +315,9 @@ namespace GuitarDiagnostics::Analysis
 
     void IntonationAnalyzer::UpdateResult()
     {
-        auto result = std::make_shared<IntonationResult>();
+        GD_TRACE_SCOPE("Intonation", "Publish");
+
+        auto result = resultPool.Acquire(latestResult);
         result->timestamp = std::chrono::system_clock::now();
         result->isValid = true;
         result->state = currentState;
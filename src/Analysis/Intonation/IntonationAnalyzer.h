@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Analysis/Analyzer.h"
+#include "Analysis/AnalyzerParameters.h"
+#include "Analysis/ResultPool.h"
+#include "Util/Arena.h"
 
 #include <YinPitchDetector.h>
 
@@ -8,7 +11,7 @@
 #include <chrono>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <span>
 
 namespace GuitarDiagnostics::Analysis
 {
@@ -48,13 +51,14 @@ namespace GuitarDiagnostics::Analysis
      *
      * Guides the user through comparing open string pitch vs 12th fret pitch.
      */
-    class IntonationAnalyzer : public Analyzer
+    class IntonationAnalyzer final : public Analyzer
     {
     public:
         /**
          * @brief Constructs the IntonationAnalyzer.
+         * @param parameters Tuning parameters; out-of-range values are clamped.
          */
-        IntonationAnalyzer();
+        explicit IntonationAnalyzer(const IntonationParameters &parameters = IntonationParameters());
 
         /**
          * @brief Destructor.
@@ -73,11 +77,40 @@ namespace GuitarDiagnostics::Analysis
 
         void ProcessBuffer(std::span<const float> audioData) override;
 
+        /**
+         * @brief Runs the hops through the state machine and publishes one result for the batch.
+         * @param samples Audio samples of the hops, back to back.
+         * @param hop Frames per hop.
+         */
+        void ProcessBlocks(std::span<const float> samples, size_t hop) override;
+
         std::shared_ptr<AnalysisResult> GetLatestResult() const override;
 
         void Reset() override;
 
+        std::string GetName() const override;
+
+        void ApplyParameters(const AnalyzerParameters &parameters) override;
+
+        /**
+         * @brief Gets the tuning parameters in use.
+         * @return Parameters after clamping.
+         */
+        const IntonationParameters &GetParameters() const;
+
     private:
+        /**
+         * @brief Detects the pitch of one hop and advances the state machine, without publishing.
+         * @param audioData Audio samples of the hop.
+         */
+        void ProcessHop(std::span<const float> audioData);
+
+        /**
+         * @brief Gets the clock time at the end of the hop being processed.
+         * @return Clock reading, moved back to the hop inside a ProcessBlocks() batch.
+         */
+        std::chrono::nanoseconds GetHopTime() const;
+
         /**
          * @brief Updates the analysis state machine based on pitch input.
          * @param frequency Detected pitch frequency in Hz.
@@ -133,14 +166,17 @@ namespace GuitarDiagnostics::Analysis
         /** @brief Updates the shared result structure. */
         void UpdateResult();
 
-        AnalysisConfig config; ///< Analysis configuration.
+        AnalysisConfig config;           ///< Analysis configuration.
+        IntonationParameters parameters; ///< Tuning parameters.
 
         std::unique_ptr<GuitarDSP::YinPitchDetector> pitchDetector; ///< Pitch detector instance.
 
-        IntonationState currentState;                         ///< Current state of the intonation check.
-        std::vector<float> pitchAccumulator;                  ///< Buffer for accumulating pitch samples.
-        size_t pitchCount;                                    ///< Number of accumulated pitch samples.
-        std::chrono::steady_clock::time_point stateStartTime; ///< Time when the current state started.
+        IntonationState currentState;            ///< Current state of the intonation check.
+        Util::Arena arena;                       ///< Storage of the working buffers.
+        std::span<float> pitchAccumulator;       ///< Buffer for accumulating pitch samples.
+        size_t pitchCount;                       ///< Number of accumulated pitch samples.
+        std::chrono::nanoseconds stateStartTime; ///< Clock time when the current state started.
+        std::chrono::nanoseconds batchLag;       ///< Time from the end of the current hop to the end of its batch.
 
         float openStringFreq;    ///< Measured open string frequency.
         float frettedStringFreq; ///< Measured fretted string frequency.
@@ -149,14 +185,9 @@ namespace GuitarDiagnostics::Analysis
 
         mutable std::mutex resultMutex;                 ///< Mutex for thread-safe result access.
         std::shared_ptr<IntonationResult> latestResult; ///< The latest analysis result.
+        ResultPool<IntonationResult> resultPool;        ///< Recycled result objects.
 
-        static constexpr float g_kConfidenceThreshold = 0.7f;  ///< Pitch detection confidence threshold.
-        static constexpr size_t g_kPitchAccumulatorSize = 100; ///< Number of samples to accumulate for stability.
-        static constexpr std::chrono::milliseconds g_kStableTimeRequired{
-            500
-        }; ///< Time required for pitch to be considered stable.
-        static constexpr float g_kInTuneTolerance = 5.0f;    ///< Tolerance in cents for being "in tune".
-        static constexpr float g_kStabilityThreshold = 2.0f; ///< Standard deviation threshold for pitch stability.
+        static constexpr size_t g_kMaxPitchAccumulatorSize = 400; ///< Upper bound of the pitch accumulator size.
     };
 
 } // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "Analysis/Kernels/KernelRegistry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Included only by the KernelsXxx.cpp files, each compiled for a different instruction set.
+// Everything here has internal linkage, so the linker can never merge an AVX-512 copy of a
+// loop into code that runs on the baseline ISA. For the same reason the loops call no inline
+// library helpers (std::max, std::abs) beyond the trivial std::span accessors.
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace
+    {
+        constexpr size_t g_kLanes = 16; ///< Independent accumulators; 16 floats fill one AVX-512 register.
+
+        // The channel loops run two interleaved frames per block, so accumulator k serves channel k % 8.
+        static_assert(g_kLanes == 2 * g_kChannelLanes, "Channel loops fold two frames per block");
+
+        float SumOfSquaresLoop(std::span<const float> samples)
+        {
+            const float *data = samples.data();
+            const size_t count = samples.size();
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    lanes[lane] += data[i + lane] * data[i + lane];
+                }
+            }
+
+            float sum = 0.0f;
+            for (size_t lane = 0; lane < g_kLanes; ++lane)
+            {
+                sum += lanes[lane];
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                sum += data[i] * data[i];
+            }
+            return sum;
+        }
+
+        float PositiveDifferenceSumLoop(std::span<const float> current, std::span<const float> previous)
+        {
+            const float *now = current.data();
+            const float *before = previous.data();
+            const size_t count = current.size() < previous.size() ? current.size() : previous.size();
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    const float difference = now[i + lane] - before[i + lane];
+                    lanes[lane] += difference > 0.0f ? difference : 0.0f;
+                }
+            }
+
+            float sum = 0.0f;
+            for (size_t lane = 0; lane < g_kLanes; ++lane)
+            {
+                sum += lanes[lane];
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                const float difference = now[i] - before[i];
+                sum += difference > 0.0f ? difference : 0.0f;
+            }
+            return sum;
+        }
+
+        float PeakAbsoluteLoop(std::span<const float> samples)
+        {
+            const float *data = samples.data();
+            const size_t count = samples.size();
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    const float magnitude = data[i + lane] < 0.0f ? -data[i + lane] : data[i + lane];
+                    lanes[lane] = magnitude > lanes[lane] ? magnitude : lanes[lane];
+                }
+            }
+
+            float peak = 0.0f;
+            for (size_t lane = 0; lane < g_kLanes; ++lane)
+            {
+                peak = lanes[lane] > peak ? lanes[lane] : peak;
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                const float magnitude = data[i] < 0.0f ? -data[i] : data[i];
+                peak = magnitude > peak ? magnitude : peak;
+            }
+            return peak;
+        }
+
+        size_t CountZeroCrossingsLoop(std::span<const float> samples)
+        {
+            const float *data = samples.data();
+            size_t crossings = 0;
+            for (size_t i = 1; i < samples.size(); ++i)
+            {
+                crossings += static_cast<size_t>((data[i - 1] < 0.0f) != (data[i] < 0.0f));
+            }
+            return crossings;
+        }
+
+        size_t FindPeakLoop(std::span<const float> values)
+        {
+            // Peak windows around harmonics are a handful of bins; a scan beats any reduction.
+            const float *data = values.data();
+            size_t peak = 0;
+            for (size_t i = 1; i < values.size(); ++i)
+            {
+                if (data[i] > data[peak])
+                {
+                    peak = i;
+                }
+            }
+            return peak;
+        }
+
+        float DotProductLoop(std::span<const float> a, std::span<const float> b)
+        {
+            const float *left = a.data();
+            const float *right = b.data();
+            const size_t count = a.size() < b.size() ? a.size() : b.size();
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    lanes[lane] += left[i + lane] * right[i + lane];
+                }
+            }
+
+            float sum = 0.0f;
+            for (size_t lane = 0; lane < g_kLanes; ++lane)
+            {
+                sum += lanes[lane];
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                sum += left[i] * right[i];
+            }
+            return sum;
+        }
+
+        size_t WholeFrameCount(size_t count)
+        {
+            return count - count % g_kChannelLanes;
+        }
+
+        void ChannelSumOfSquaresLoop(std::span<const float> frames, std::span<float, g_kChannelLanes> sums)
+        {
+            const float *data = frames.data();
+            const size_t count = WholeFrameCount(frames.size());
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    lanes[lane] += data[i + lane] * data[i + lane];
+                }
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                lanes[i - blocked] += data[i] * data[i];
+            }
+
+            for (size_t channel = 0; channel < g_kChannelLanes; ++channel)
+            {
+                sums.data()[channel] = lanes[channel] + lanes[channel + g_kChannelLanes];
+            }
+        }
+
+        void ChannelPositiveDifferenceSumLoop(std::span<const float> current,
+            std::span<const float> previous,
+            std::span<float, g_kChannelLanes> sums)
+        {
+            const float *now = current.data();
+            const float *before = previous.data();
+            const size_t count = WholeFrameCount(current.size() < previous.size() ? current.size() : previous.size());
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    const float difference = now[i + lane] - before[i + lane];
+                    lanes[lane] += difference > 0.0f ? difference : 0.0f;
+                }
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                const float difference = now[i] - before[i];
+                lanes[i - blocked] += difference > 0.0f ? difference : 0.0f;
+            }
+
+            for (size_t channel = 0; channel < g_kChannelLanes; ++channel)
+            {
+                sums.data()[channel] = lanes[channel] + lanes[channel + g_kChannelLanes];
+            }
+        }
+
+        void ChannelPeakAbsoluteLoop(std::span<const float> frames, std::span<float, g_kChannelLanes> peaks)
+        {
+            const float *data = frames.data();
+            const size_t count = WholeFrameCount(frames.size());
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    const float magnitude = data[i + lane] < 0.0f ? -data[i + lane] : data[i + lane];
+                    lanes[lane] = magnitude > lanes[lane] ? magnitude : lanes[lane];
+                }
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                const float magnitude = data[i] < 0.0f ? -data[i] : data[i];
+                lanes[i - blocked] = magnitude > lanes[i - blocked] ? magnitude : lanes[i - blocked];
+            }
+
+            for (size_t channel = 0; channel < g_kChannelLanes; ++channel)
+            {
+                const float other = lanes[channel + g_kChannelLanes];
+                peaks.data()[channel] = other > lanes[channel] ? other : lanes[channel];
+            }
+        }
+
+        void ChannelZeroCrossingsLoop(std::span<const float> frames, std::span<uint32_t, g_kChannelLanes> counts)
+        {
+            // Compares every sample with the same channel one frame earlier.
+            const size_t total = WholeFrameCount(frames.size());
+            const size_t count = total > g_kChannelLanes ? total - g_kChannelLanes : 0;
+            const float *before = frames.data();
+            const float *now = frames.data() + g_kChannelLanes;
+            const size_t blocked = count - count % g_kLanes;
+
+            uint32_t lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    lanes[lane] += static_cast<uint32_t>((before[i + lane] < 0.0f) != (now[i + lane] < 0.0f));
+                }
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                lanes[i - blocked] += static_cast<uint32_t>((before[i] < 0.0f) != (now[i] < 0.0f));
+            }
+
+            for (size_t channel = 0; channel < g_kChannelLanes; ++channel)
+            {
+                counts.data()[channel] = lanes[channel] + lanes[channel + g_kChannelLanes];
+            }
+        }
+
+        void ChannelDifferenceLoop(std::span<const float> frames,
+            size_t window,
+            size_t lag,
+            std::span<float, g_kChannelLanes> sums)
+        {
+            const size_t frameCount = frames.size() / g_kChannelLanes;
+            const size_t available = frameCount > lag ? frameCount - lag : 0;
+            const size_t count = (window < available ? window : available) * g_kChannelLanes;
+            const float *data = frames.data();
+            const float *delayed = frames.data() + lag * g_kChannelLanes;
+            const size_t blocked = count - count % g_kLanes;
+
+            float lanes[g_kLanes] = {};
+            for (size_t i = 0; i < blocked; i += g_kLanes)
+            {
+                for (size_t lane = 0; lane < g_kLanes; ++lane)
+                {
+                    const float difference = data[i + lane] - delayed[i + lane];
+                    lanes[lane] += difference * difference;
+                }
+            }
+            for (size_t i = blocked; i < count; ++i)
+            {
+                const float difference = data[i] - delayed[i];
+                lanes[i - blocked] += difference * difference;
+            }
+
+            for (size_t channel = 0; channel < g_kChannelLanes; ++channel)
+            {
+                sums.data()[channel] = lanes[channel] + lanes[channel + g_kChannelLanes];
+            }
+        }
+
+        constexpr KernelTable g_kKernelLoops = {
+            SumOfSquaresLoop,
+            PositiveDifferenceSumLoop,
+            PeakAbsoluteLoop,
+            CountZeroCrossingsLoop,
+            FindPeakLoop,
+            DotProductLoop,
+            ChannelSumOfSquaresLoop,
+            ChannelPositiveDifferenceSumLoop,
+            ChannelPeakAbsoluteLoop,
+            ChannelZeroCrossingsLoop,
+            ChannelDifferenceLoop,
+        };
+    } // namespace
+
+} // namespace GuitarDiagnostics::Analysis
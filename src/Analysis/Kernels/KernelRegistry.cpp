@@ -0,0 +1,166 @@
+#include "Analysis/Kernels/KernelRegistry.h"
+
+#include <atomic>
+#include <initializer_list>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace
+    {
+        std::atomic<const KernelTable *> g_activeTable{ nullptr };              ///< Bound on first use.
+        std::atomic<KernelVariant> g_activeVariant{ KernelVariant::Baseline }; ///< Variant of g_activeTable.
+
+        /**
+         * @brief Checks the CPU (and, for the wide registers, the OS) for an instruction set.
+         */
+        bool CpuSupports(KernelVariant variant)
+        {
+            if (variant == KernelVariant::Baseline)
+            {
+                return true;
+            }
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int registers[4] = {};
+            __cpuid(registers, 1);
+            const bool osSavesAvx = (registers[2] & (1 << 27)) != 0;
+            const bool fma = (registers[2] & (1 << 12)) != 0;
+            if (!osSavesAvx)
+            {
+                return false;
+            }
+
+            // XCR0: SSE and AVX state (bits 1-2), plus opmask and ZMM state (bits 5-7) for AVX-512.
+            const unsigned long long xcr0 = _xgetbv(0);
+            __cpuidex(registers, 7, 0);
+            if (variant == KernelVariant::Avx2)
+            {
+                return fma && (registers[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+            }
+            return (registers[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+            // Also checks that the OS saves the wider registers.
+            __builtin_cpu_init();
+            if (variant == KernelVariant::Avx2)
+            {
+                return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            }
+            return __builtin_cpu_supports("avx512f");
+#else
+            return false;
+#endif
+        }
+
+        const KernelTable *GetCompiledTable(KernelVariant variant)
+        {
+            switch (variant)
+            {
+            case KernelVariant::Avx2:
+                return Kernels::GetAvx2Table();
+            case KernelVariant::Avx512:
+                return Kernels::GetAvx512Table();
+            case KernelVariant::Baseline:
+            default:
+                return Kernels::GetBaselineTable();
+            }
+        }
+
+        void Activate(KernelVariant variant, const KernelTable *table)
+        {
+            g_activeVariant.store(variant, std::memory_order_relaxed);
+            g_activeTable.store(table, std::memory_order_release);
+        }
+    } // namespace
+
+    const KernelTable &KernelRegistry::GetKernels()
+    {
+        const KernelTable *table = g_activeTable.load(std::memory_order_acquire);
+        if (!table)
+        {
+            // Racing first calls detect the same variant, so the last store wins harmlessly.
+            const KernelVariant variant = DetectBestVariant();
+            table = GetTable(variant);
+            Activate(variant, table);
+        }
+        return *table;
+    }
+
+    KernelVariant KernelRegistry::GetActiveVariant()
+    {
+        GetKernels();
+        return g_activeVariant.load(std::memory_order_relaxed);
+    }
+
+    KernelVariant KernelRegistry::DetectBestVariant()
+    {
+        for (const KernelVariant variant : { KernelVariant::Avx512, KernelVariant::Avx2 })
+        {
+            if (IsSupported(variant))
+            {
+                return variant;
+            }
+        }
+        return KernelVariant::Baseline;
+    }
+
+    bool KernelRegistry::IsSupported(KernelVariant variant)
+    {
+        // The CPU check comes first: the AVX translation units must not run before it passes.
+        return CpuSupports(variant) && GetCompiledTable(variant) != nullptr;
+    }
+
+    const KernelTable *KernelRegistry::GetTable(KernelVariant variant)
+    {
+        return IsSupported(variant) ? GetCompiledTable(variant) : nullptr;
+    }
+
+    bool KernelRegistry::ForceVariant(KernelVariant variant)
+    {
+        const KernelTable *table = GetTable(variant);
+        if (!table)
+        {
+            return false;
+        }
+
+        Activate(variant, table);
+        return true;
+    }
+
+    void KernelRegistry::ResetVariant()
+    {
+        const KernelVariant variant = DetectBestVariant();
+        Activate(variant, GetTable(variant));
+    }
+
+    std::string_view KernelRegistry::GetVariantName(KernelVariant variant)
+    {
+        switch (variant)
+        {
+        case KernelVariant::Avx2:
+            return "avx2";
+        case KernelVariant::Avx512:
+            return "avx512";
+        case KernelVariant::Baseline:
+        default:
+            return "baseline";
+        }
+    }
+
+    std::optional<KernelVariant> KernelRegistry::ParseVariant(std::string_view name)
+    {
+        for (const KernelVariant variant : { KernelVariant::Baseline, KernelVariant::Avx2, KernelVariant::Avx512 })
+        {
+            if (name == GetVariantName(variant))
+            {
+                return variant;
+            }
+        }
+        return std::nullopt;
+    }
+
+} // namespace GuitarDiagnostics::Analysis
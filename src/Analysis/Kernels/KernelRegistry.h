@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Instruction set a kernel table was compiled for, from oldest to newest.
+     */
+    enum class KernelVariant
+    {
+        Baseline, ///< The build's target ISA (SSE2 on x86-64); always available.
+        Avx2,     ///< AVX2 and FMA.
+        Avx512    ///< AVX-512F.
+    };
+
+    /**
+     * @brief Channels the channel kernels process in lockstep, one per vector lane.
+     *
+     * Their input is channel-interleaved (structure of arrays per frame): frame i of channel c
+     * is at [i * g_kChannelLanes + c]. Inputs with fewer channels leave the unused lanes zero.
+     */
+    constexpr size_t g_kChannelLanes = 8;
+
+    /**
+     * @brief Hot loops of the analyzers, compiled once per KernelVariant.
+     *
+     * Every variant runs the same portable source: the loops keep 16 independent accumulators,
+     * so each target's auto-vectorizer fills its own vector width without intrinsics, and all
+     * variants add in the same order. The channel kernels take channel-interleaved frames (see
+     * g_kChannelLanes) and ignore a trailing partial frame.
+     */
+    struct KernelTable
+    {
+        /** @brief Sum of squared samples. */
+        float (*sumOfSquares)(std::span<const float> samples);
+
+        /** @brief Sum of max(current[i] - previous[i], 0) over the shorter span (spectral flux). */
+        float (*positiveDifferenceSum)(std::span<const float> current, std::span<const float> previous);
+
+        /** @brief Largest absolute sample value, 0 for an empty span. */
+        float (*peakAbsolute)(std::span<const float> samples);
+
+        /** @brief Number of sign changes between adjacent samples (zero counts as positive). */
+        size_t (*countZeroCrossings)(std::span<const float> samples);
+
+        /** @brief Index of the first largest value, 0 for an empty span. */
+        size_t (*findPeak)(std::span<const float> values);
+
+        /** @brief Sum of a[i] * b[i] over the shorter span (FIR filter taps). */
+        float (*dotProduct)(std::span<const float> a, std::span<const float> b);
+
+        /** @brief Per channel, sum of squared samples. */
+        void (*channelSumOfSquares)(std::span<const float> frames, std::span<float, g_kChannelLanes> sums);
+
+        /** @brief Per channel, spectral flux between two spectra; frames beyond the shorter span are ignored. */
+        void (*channelPositiveDifferenceSum)(std::span<const float> current,
+            std::span<const float> previous,
+            std::span<float, g_kChannelLanes> sums);
+
+        /** @brief Per channel, largest absolute sample value. */
+        void (*channelPeakAbsolute)(std::span<const float> frames, std::span<float, g_kChannelLanes> peaks);
+
+        /** @brief Per channel, number of sign changes between adjacent frames (zero counts as positive). */
+        void (*channelZeroCrossings)(std::span<const float> frames, std::span<uint32_t, g_kChannelLanes> counts);
+
+        /**
+         * @brief Per channel, the YIN difference: sum of (x[j] - x[j + lag])^2 over j < window.
+         *
+         * The window is shortened to the frames available after the lag.
+         */
+        void (*channelDifference)(std::span<const float> frames,
+            size_t window,
+            size_t lag,
+            std::span<float, g_kChannelLanes> sums);
+    };
+
+    /**
+     * @brief Picks the kernel table for the CPU the process runs on.
+     *
+     * Release builds target a baseline ISA so one binary runs on every machine; the AVX2 and
+     * AVX-512 tables are compiled with those instruction sets enabled for their translation unit
+     * only and are bound at run time when the CPU and OS support them. Analyzers fetch the
+     * active table once in Configure() and call through its function pointers on every hop.
+     *
+     * ForceVariant() overrides the detection, so tests (and the --kernels command line option)
+     * can check every variant the machine supports against the baseline.
+     */
+    class KernelRegistry
+    {
+    public:
+        KernelRegistry() = delete;
+
+        /**
+         * @brief Gets the active table, detecting the best variant on first use.
+         * @return Kernel table; valid for the lifetime of the process.
+         */
+        static const KernelTable &GetKernels();
+
+        /**
+         * @brief Gets the variant of the active table.
+         * @return Active variant.
+         */
+        static KernelVariant GetActiveVariant();
+
+        /**
+         * @brief Gets the newest variant that is compiled in and supported by the CPU.
+         * @return Best variant.
+         */
+        static KernelVariant DetectBestVariant();
+
+        /**
+         * @brief Checks if a variant is compiled in and supported by the CPU.
+         * @param variant Variant to check.
+         * @return True if its table can run on this machine.
+         */
+        static bool IsSupported(KernelVariant variant);
+
+        /**
+         * @brief Gets the table of a specific variant without activating it.
+         * @param variant Variant to look up.
+         * @return Kernel table, or nullptr if the variant is not supported.
+         */
+        static const KernelTable *GetTable(KernelVariant variant);
+
+        /**
+         * @brief Makes a variant the active one. Affects analyzers configured afterwards.
+         * @param variant Variant to activate.
+         * @return True if activated, false if the variant is not supported (the active one is kept).
+         */
+        static bool ForceVariant(KernelVariant variant);
+
+        /**
+         * @brief Returns to the detected best variant after ForceVariant().
+         */
+        static void ResetVariant();
+
+        /**
+         * @brief Gets the display name of a variant, as accepted by ParseVariant().
+         * @param variant Variant.
+         * @return Lowercase name.
+         */
+        static std::string_view GetVariantName(KernelVariant variant);
+
+        /**
+         * @brief Parses a variant name.
+         * @param name "baseline", "avx2" or "avx512".
+         * @return The variant, or std::nullopt if the name is unknown.
+         */
+        static std::optional<KernelVariant> ParseVariant(std::string_view name);
+    };
+
+    namespace Kernels
+    {
+        /** @brief Table compiled for the build's target ISA. */
+        const KernelTable *GetBaselineTable();
+
+        /** @brief Table compiled with AVX2 and FMA, or nullptr if the compiler cannot target them. */
+        const KernelTable *GetAvx2Table();
+
+        /** @brief Table compiled with AVX-512F, or nullptr if the compiler cannot target it. */
+        const KernelTable *GetAvx512Table();
+    } // namespace Kernels
+
+} // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,16 @@
+// Compiled with AVX2 and FMA enabled (see src/CMakeLists.txt); only reached after a CPU check.
+#include "Analysis/Kernels/KernelLoops.h"
+
+namespace GuitarDiagnostics::Analysis::Kernels
+{
+
+    const KernelTable *GetAvx2Table()
+    {
+#if defined(__AVX2__)
+        return &g_kKernelLoops;
+#else
+        return nullptr;
+#endif
+    }
+
+} // namespace GuitarDiagnostics::Analysis::Kernels
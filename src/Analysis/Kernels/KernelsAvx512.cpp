@@ -0,0 +1,16 @@
+// Compiled with AVX-512F enabled (see src/CMakeLists.txt); only reached after a CPU check.
+#include "Analysis/Kernels/KernelLoops.h"
+
+namespace GuitarDiagnostics::Analysis::Kernels
+{
+
+    const KernelTable *GetAvx512Table()
+    {
+#if defined(__AVX512F__)
+        return &g_kKernelLoops;
+#else
+        return nullptr;
+#endif
+    }
+
+} // namespace GuitarDiagnostics::Analysis::Kernels
@@ -0,0 +1,11 @@
+#include "Analysis/Kernels/KernelLoops.h"
+
+namespace GuitarDiagnostics::Analysis::Kernels
+{
+
+    const KernelTable *GetBaselineTable()
+    {
+        return &g_kKernelLoops;
+    }
+
+} // namespace GuitarDiagnostics::Analysis::Kernels
@@ -0,0 +1,90 @@
+#include "Analysis/ParameterStore.h"
+
+#include <Logger.h>
+
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    ParameterStore::ParameterStore()
+        : publishMutex(), snapshots(), current(nullptr), version(0), filePath(), fileTime()
+    {
+        snapshots.push_back(std::make_unique<AnalyzerParameters>());
+        current.store(snapshots.back().get(), std::memory_order_release);
+    }
+
+    ParameterStore::~ParameterStore()
+    {
+    }
+
+    bool ParameterStore::LoadFromFile(const std::filesystem::path &path)
+    {
+        std::error_code error;
+        const auto modified = std::filesystem::last_write_time(path, error);
+
+        std::ifstream file(path);
+        if (error || !file)
+        {
+            LOG_ERROR("Cannot open analyzer parameter file: {}", path.string());
+            return false;
+        }
+
+        std::ostringstream text;
+        text << file.rdbuf();
+
+        // Remember the file even if it is invalid, so fixing it triggers a reload.
+        filePath = path;
+        fileTime = modified;
+
+        const auto parameters = ParseAnalyzerParameters(text.str());
+        if (!parameters)
+        {
+            LOG_ERROR("Keeping previous analyzer parameters, {} is invalid", path.string());
+            return false;
+        }
+
+        Publish(*parameters);
+        LOG_INFO("Loaded analyzer parameters from {}", path.string());
+        return true;
+    }
+
+    bool ParameterStore::ReloadIfChanged()
+    {
+        if (filePath.empty())
+        {
+            return false;
+        }
+
+        std::error_code error;
+        const auto modified = std::filesystem::last_write_time(filePath, error);
+        if (error || modified == fileTime)
+        {
+            return false;
+        }
+
+        return LoadFromFile(filePath);
+    }
+
+    void ParameterStore::Publish(const AnalyzerParameters &parameters)
+    {
+        std::lock_guard<std::mutex> lock(publishMutex);
+
+        snapshots.push_back(std::make_unique<AnalyzerParameters>(parameters));
+        current.store(snapshots.back().get(), std::memory_order_release);
+        version.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const AnalyzerParameters *ParameterStore::GetCurrent() const noexcept
+    {
+        return current.load(std::memory_order_acquire);
+    }
+
+    uint64_t ParameterStore::GetVersion() const noexcept
+    {
+        return version.load(std::memory_order_relaxed);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
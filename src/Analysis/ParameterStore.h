@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Analysis/AnalyzerParameters.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Publishes analyzer parameters from a JSON file to the analysis thread.
+     *
+     * Every update is stored as an immutable snapshot and made current with one atomic pointer
+     * store. Readers load the pointer without locks or allocation and compare it with the last
+     * snapshot they applied. Snapshots are kept until the store is destroyed, so a pointer
+     * returned by GetCurrent() never dangles; updates are rare, human-driven edits, so the
+     * retained memory stays small.
+     */
+    class ParameterStore
+    {
+    public:
+        /**
+         * @brief Constructs the ParameterStore with the default parameters as the current snapshot.
+         */
+        ParameterStore();
+
+        /**
+         * @brief Destructor.
+         */
+        ~ParameterStore();
+
+        ParameterStore(const ParameterStore &) = delete;
+
+        ParameterStore &operator=(const ParameterStore &) = delete;
+
+        ParameterStore(ParameterStore &&) = delete;
+
+        ParameterStore &operator=(ParameterStore &&) = delete;
+
+        /**
+         * @brief Loads parameters from a JSON file and publishes them.
+         *
+         * The file is remembered for ReloadIfChanged(). Keys missing from the file keep their
+         * default values.
+         * @param path Path to the JSON file.
+         * @return True if the file was read and published, false otherwise (the current snapshot is kept).
+         */
+        bool LoadFromFile(const std::filesystem::path &path);
+
+        /**
+         * @brief Reloads the file given to LoadFromFile() if its modification time changed.
+         * @return True if a new snapshot was published, false otherwise.
+         */
+        bool ReloadIfChanged();
+
+        /**
+         * @brief Publishes a new snapshot.
+         * @param parameters Parameters to make current.
+         */
+        void Publish(const AnalyzerParameters &parameters);
+
+        /**
+         * @brief Gets the current snapshot. Lock-free and allocation-free; safe on the analysis thread.
+         * @return Current parameters; valid for the lifetime of the store.
+         */
+        const AnalyzerParameters *GetCurrent() const noexcept;
+
+        /**
+         * @brief Gets the number of snapshots published after the defaults.
+         * @return Update count.
+         */
+        uint64_t GetVersion() const noexcept;
+
+    private:
+        std::mutex publishMutex;                                    ///< Serializes writers; readers never take it.
+        std::vector<std::unique_ptr<AnalyzerParameters>> snapshots; ///< Every published snapshot.
+        std::atomic<const AnalyzerParameters *> current;            ///< Snapshot seen by readers.
+        std::atomic<uint64_t> version;                              ///< Published update count.
+        std::filesystem::path filePath;                             ///< File watched by ReloadIfChanged().
+        std::filesystem::file_time_type fileTime;                   ///< Modification time of the last load.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
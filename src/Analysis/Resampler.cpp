@@ -0,0 +1,180 @@
+#include "Analysis/Resampler.h"
+
+#include <Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace
+    {
+        constexpr uint32_t g_kMaxPhases = 1024; ///< Largest L; bounds the filter bank size.
+        constexpr size_t g_kBaseTaps = 64;      ///< Taps per phase for L >= M; scaled by M / L when downsampling.
+        constexpr double g_kCutoff = 0.9;       ///< Cutoff as a fraction of the lower Nyquist frequency.
+        constexpr double g_kKaiserBeta = 8.6;   ///< About 86 dB of stopband attenuation.
+        constexpr double g_kPi = 3.14159265358979323846;
+
+        /**
+         * @brief Zeroth-order modified Bessel function of the first kind, for the Kaiser window.
+         */
+        double BesselI0(double x)
+        {
+            const double halfX = 0.5 * x;
+            double term = 1.0;
+            double sum = 1.0;
+            for (int k = 1; k < 64 && term > 1e-12 * sum; ++k)
+            {
+                term *= (halfX / k) * (halfX / k);
+                sum += term;
+            }
+            return sum;
+        }
+    } // namespace
+
+    Resampler::Resampler()
+        : kernels(nullptr), filterBank(), history(), interpolation(1), decimation(1), tapsPerPhase(0), maxInputBlock(0),
+          historyCount(0), readOffset(0), phase(0)
+    {
+    }
+
+    bool Resampler::Configure(float inputRate, float outputRate, size_t newMaxInputBlock)
+    {
+        const auto input = static_cast<uint64_t>(std::llround(inputRate));
+        const auto output = static_cast<uint64_t>(std::llround(outputRate));
+        if (input == 0 || output == 0 || newMaxInputBlock == 0)
+        {
+            LOG_ERROR("Cannot resample {} Hz to {} Hz", inputRate, outputRate);
+            return false;
+        }
+
+        const uint64_t divisor = std::gcd(input, output);
+        if (output / divisor > g_kMaxPhases)
+        {
+            LOG_ERROR("Resampling {} Hz to {} Hz needs {} filter phases", input, output, output / divisor);
+            return false;
+        }
+
+        interpolation = static_cast<uint32_t>(output / divisor);
+        decimation = static_cast<uint32_t>(input / divisor);
+        tapsPerPhase = g_kBaseTaps * std::max<size_t>(1, (decimation + interpolation - 1) / interpolation);
+        maxInputBlock = newMaxInputBlock;
+        kernels = &KernelRegistry::GetKernels();
+
+        // Prototype low-pass at L times the input rate, in cycles per sample.
+        const size_t length = tapsPerPhase * interpolation;
+        const double cutoff = 0.5 * g_kCutoff / static_cast<double>(std::max(interpolation, decimation));
+        const double center = 0.5 * static_cast<double>(length - 1);
+        const double windowScale = 1.0 / BesselI0(g_kKaiserBeta);
+
+        std::vector<double> prototype(length);
+        for (size_t k = 0; k < length; ++k)
+        {
+            const double offset = static_cast<double>(k) - center;
+            const double argument = 2.0 * cutoff * offset;
+            const double sinc = offset == 0.0 ? 1.0 : std::sin(g_kPi * argument) / (g_kPi * argument);
+            const double ratio = offset / center;
+            const double window =
+                BesselI0(g_kKaiserBeta * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) * windowScale;
+            prototype[k] = 2.0 * cutoff * sinc * window;
+        }
+
+        // Unity gain per phase on average; phases are stored reversed so they run forward over the history.
+        const double gain =
+            static_cast<double>(interpolation) / std::accumulate(prototype.begin(), prototype.end(), 0.0);
+        filterBank.assign(length, 0.0f);
+        for (uint32_t p = 0; p < interpolation; ++p)
+        {
+            for (size_t tap = 0; tap < tapsPerPhase; ++tap)
+            {
+                const size_t source = p + (tapsPerPhase - 1 - tap) * interpolation;
+                filterBank[p * tapsPerPhase + tap] = static_cast<float>(prototype[source] * gain);
+            }
+        }
+
+        history.assign(tapsPerPhase - 1 + maxInputBlock, 0.0f);
+        Reset();
+        return true;
+    }
+
+    size_t Resampler::Process(std::span<const float> input, std::span<float> output) noexcept
+    {
+        size_t written = 0;
+        while (!input.empty())
+        {
+            const size_t count = std::min(input.size(), history.size() - historyCount);
+            if (count == 0)
+            {
+                break; // Output full; the caller passed less than GetMaxOutputSize().
+            }
+            std::copy_n(input.begin(), count, history.begin() + static_cast<std::ptrdiff_t>(historyCount));
+            historyCount += count;
+            input = input.subspan(count);
+
+            while (readOffset + tapsPerPhase <= historyCount && written < output.size())
+            {
+                const std::span<const float> taps(filterBank.data() + phase * tapsPerPhase, tapsPerPhase);
+                const std::span<const float> recent(history.data() + readOffset, tapsPerPhase);
+                output[written++] = kernels->dotProduct(taps, recent);
+
+                phase += decimation;
+                readOffset += phase / interpolation;
+                phase %= interpolation;
+            }
+
+            // Keep the unconsumed tail (fewer than tapsPerPhase samples) at the front.
+            if (readOffset >= historyCount)
+            {
+                readOffset -= historyCount;
+                historyCount = 0;
+            }
+            else
+            {
+                std::copy(history.begin() + static_cast<std::ptrdiff_t>(readOffset),
+                    history.begin() + static_cast<std::ptrdiff_t>(historyCount),
+                    history.begin());
+                historyCount -= readOffset;
+                readOffset = 0;
+            }
+        }
+
+        return written;
+    }
+
+    void Resampler::Reset() noexcept
+    {
+        // Start with a full history of silence so the first input produces output right away.
+        std::fill(history.begin(), history.end(), 0.0f);
+        historyCount = tapsPerPhase > 0 ? tapsPerPhase - 1 : 0;
+        readOffset = 0;
+        phase = 0;
+    }
+
+    bool Resampler::IsConfigured() const noexcept
+    {
+        return kernels != nullptr;
+    }
+
+    size_t Resampler::GetMaxOutputSize(size_t inputCount) const noexcept
+    {
+        return (inputCount * interpolation) / decimation + 1;
+    }
+
+    uint32_t Resampler::GetInterpolation() const noexcept
+    {
+        return interpolation;
+    }
+
+    uint32_t Resampler::GetDecimation() const noexcept
+    {
+        return decimation;
+    }
+
+    size_t Resampler::GetTapsPerPhase() const noexcept
+    {
+        return tapsPerPhase;
+    }
+
+} // namespace GuitarDiagnostics::Analysis
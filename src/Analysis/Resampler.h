@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Analysis/Kernels/KernelRegistry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Streaming polyphase resampler between two integer sample rates.
+     *
+     * The rate ratio is reduced to L / M (48000 / 44100 is 160 / 147) and a Kaiser windowed
+     * sinc low-pass with its cutoff below the lower of the two Nyquist frequencies is designed
+     * once in Configure() and split into L phases. Every output sample is then a single dot
+     * product of one phase with the newest input samples, run through the active DSP kernel
+     * table, so only the L / M outputs actually needed are computed.
+     *
+     * Process() accepts blocks of any size and carries the filter history across calls; it
+     * neither allocates nor locks. Not thread-safe; each stream needs its own instance.
+     */
+    class Resampler
+    {
+    public:
+        /**
+         * @brief Constructs an unconfigured Resampler.
+         */
+        Resampler();
+
+        /**
+         * @brief Destructor.
+         */
+        ~Resampler() = default;
+
+        Resampler(const Resampler &) = delete;
+
+        Resampler &operator=(const Resampler &) = delete;
+
+        Resampler(Resampler &&) = delete;
+
+        Resampler &operator=(Resampler &&) = delete;
+
+        /**
+         * @brief Designs the filter bank and sizes the history. Allocates; call before streaming.
+         * @param inputRate Input sample rate in whole Hz.
+         * @param outputRate Output sample rate in whole Hz.
+         * @param maxInputBlock Largest input block processed in one step; bigger input is split.
+         * @return True if configured, false if a rate is invalid or the reduced ratio needs too many phases.
+         */
+        bool Configure(float inputRate, float outputRate, size_t maxInputBlock);
+
+        /**
+         * @brief Resamples the next block of the stream.
+         * @param input Input samples.
+         * @param output Receives the resampled samples; needs at least GetMaxOutputSize(input.size()).
+         * @return Number of samples written.
+         */
+        size_t Process(std::span<const float> input, std::span<float> output) noexcept;
+
+        /**
+         * @brief Clears the filter history, as if the stream started again.
+         */
+        void Reset() noexcept;
+
+        /**
+         * @brief Checks if the resampler has been configured.
+         * @return True once Configure() succeeded.
+         */
+        bool IsConfigured() const noexcept;
+
+        /**
+         * @brief Gets the most samples Process() can write for an input block.
+         * @param inputCount Input block size.
+         * @return Output capacity needed.
+         */
+        size_t GetMaxOutputSize(size_t inputCount) const noexcept;
+
+        /**
+         * @brief Gets the upsampling factor L of the reduced ratio.
+         * @return Number of filter phases.
+         */
+        uint32_t GetInterpolation() const noexcept;
+
+        /**
+         * @brief Gets the downsampling factor M of the reduced ratio.
+         * @return Input samples consumed per L outputs.
+         */
+        uint32_t GetDecimation() const noexcept;
+
+        /**
+         * @brief Gets the length of each filter phase.
+         * @return Input samples per output dot product.
+         */
+        size_t GetTapsPerPhase() const noexcept;
+
+    private:
+        const KernelTable *kernels;    ///< DSP kernels, bound in Configure().
+        std::vector<float> filterBank; ///< [phase * tapsPerPhase + tap], taps in input order.
+        std::vector<float> history;    ///< Unconsumed input, oldest first.
+        uint32_t interpolation;        ///< L.
+        uint32_t decimation;           ///< M.
+        size_t tapsPerPhase;           ///< Filter length per phase.
+        size_t maxInputBlock;          ///< Input samples appended to the history per step.
+        size_t historyCount;           ///< Valid samples in history.
+        size_t readOffset;             ///< History index of the oldest tap of the next output.
+        uint32_t phase;                ///< Filter phase of the next output.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
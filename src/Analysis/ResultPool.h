@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Fixed set of preallocated result objects recycled between hops.
+     *
+     * Analyzers publish results as shared_ptr so the UI can keep one alive while the worker moves
+     * on. Instead of allocating a new result every hop, the worker takes a slot that is neither
+     * the published result nor still held by a reader, overwrites it and publishes it. A slot is
+     * free once the pool holds the only reference.
+     *
+     * Acquire() must only be called by the thread that publishes results.
+     *
+     * @tparam T Result type, default-constructible.
+     */
+    template<typename T> class ResultPool
+    {
+    public:
+        /**
+         * @brief Constructs the pool and allocates every slot.
+         */
+        ResultPool();
+
+        /**
+         * @brief Gets a slot that no reader can observe.
+         *
+         * Falls back to allocating a fresh result if readers hold every slot, which only happens
+         * if the UI keeps several results alive at once.
+         *
+         * @param published Currently published result, which readers may copy at any time.
+         * @return Result to overwrite and publish.
+         */
+        std::shared_ptr<T> Acquire(const std::shared_ptr<T> &published);
+
+    private:
+        static constexpr size_t g_kSlotCount = 4; ///< Published, held by the UI, and spares.
+
+        std::array<std::shared_ptr<T>, g_kSlotCount> slots; ///< Preallocated results.
+    };
+
+    template<typename T> ResultPool<T>::ResultPool() : slots()
+    {
+        for (auto &slot : slots)
+        {
+            slot = std::make_shared<T>();
+        }
+    }
+
+    template<typename T> std::shared_ptr<T> ResultPool<T>::Acquire(const std::shared_ptr<T> &published)
+    {
+        for (const auto &slot : slots)
+        {
+            if (slot != published && slot.use_count() == 1)
+            {
+                // Pairs with the release in the reader's reference drop.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return slot;
+            }
+        }
+
+        return std::make_shared<T>();
+    }
+
+} // namespace GuitarDiagnostics::Analysis
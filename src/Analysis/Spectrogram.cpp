@@ -0,0 +1,203 @@
+#include "Analysis/Spectrogram.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    namespace
+    {
+        constexpr float g_kDbPerOctave = 6.0205999f; ///< 20 * log10(2): converts log2 of a magnitude to dB.
+        constexpr float g_kMinMagnitude = 1e-12f;    ///< Keeps silent bands finite (-240 dB).
+        constexpr size_t g_kPaletteSize = 256;       ///< Color steps between floor and ceiling.
+
+        /**
+         * @brief Color stop of the palette gradient.
+         */
+        struct ColorStop
+        {
+            float position; ///< Position in [0, 1].
+            float red;      ///< Red in [0, 255].
+            float green;    ///< Green in [0, 255].
+            float blue;     ///< Blue in [0, 255].
+        };
+
+        // Dark-to-bright gradient close to the "inferno" colormap.
+        constexpr std::array<ColorStop, 5> g_kColorStops = { {
+            { 0.00f, 0.0f, 0.0f, 4.0f },
+            { 0.25f, 87.0f, 16.0f, 110.0f },
+            { 0.50f, 188.0f, 55.0f, 84.0f },
+            { 0.75f, 249.0f, 142.0f, 9.0f },
+            { 1.00f, 252.0f, 255.0f, 164.0f },
+        } };
+
+        /**
+         * @brief Approximates log2 of a positive normal float to within 0.005.
+         *
+         * Uses only bit manipulation and a quadratic on the mantissa, so loops calling it
+         * vectorize; 0.005 in log2 is 0.03 dB, far below one palette step.
+         */
+        inline float FastLog2(float value)
+        {
+            const uint32_t bits = std::bit_cast<uint32_t>(value);
+            const float exponent = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+            const float mantissa = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u);
+            return exponent + (-0.34484843f * mantissa + 2.02466578f) * mantissa - 1.67487759f;
+        }
+
+        uint32_t PackColor(float red, float green, float blue)
+        {
+            return static_cast<uint32_t>(red + 0.5f) | (static_cast<uint32_t>(green + 0.5f) << 8)
+                   | (static_cast<uint32_t>(blue + 0.5f) << 16) | 0xFF000000u;
+        }
+    } // namespace
+
+    Spectrogram::Spectrogram(float sampleRate,
+        size_t fftSize,
+        size_t bandCount,
+        size_t rowCount,
+        float minFrequency,
+        float maxFrequency,
+        float floorDb,
+        float ceilingDb)
+        : sampleRate(sampleRate), mappedBins(0), bandCount(std::max<size_t>(bandCount, 1)),
+          rowCapacity(std::max<size_t>(rowCount, 2)), minFrequency(std::max(minFrequency, 1.0f)),
+          maxFrequency(std::min(maxFrequency, sampleRate * 0.5f)),
+          floorDb(floorDb), levelScale(static_cast<float>(g_kPaletteSize - 1) / std::max(ceilingDb - floorDb, 1.0f)),
+          firstBin(), lastBin(), bandLevels(), palette(), rows(), rowCount(0)
+    {
+        this->maxFrequency = std::max(this->maxFrequency, this->minFrequency * 2.0f);
+
+        firstBin.resize(this->bandCount);
+        lastBin.resize(this->bandCount);
+        bandLevels.assign(this->bandCount, 0.0f);
+
+        MapBands(std::max<size_t>(fftSize / 2, 1));
+
+        palette.resize(g_kPaletteSize);
+        for (size_t i = 0; i < g_kPaletteSize; ++i)
+        {
+            const float position = static_cast<float>(i) / static_cast<float>(g_kPaletteSize - 1);
+            size_t stop = 1;
+            while (stop + 1 < g_kColorStops.size() && position > g_kColorStops[stop].position)
+            {
+                ++stop;
+            }
+
+            const ColorStop &from = g_kColorStops[stop - 1];
+            const ColorStop &to = g_kColorStops[stop];
+            const float t = (position - from.position) / (to.position - from.position);
+            palette[i] = PackColor(from.red + (to.red - from.red) * t,
+                from.green + (to.green - from.green) * t,
+                from.blue + (to.blue - from.blue) * t);
+        }
+
+        rows.assign(this->bandCount * rowCapacity, palette[0]);
+    }
+
+    Spectrogram::~Spectrogram()
+    {
+    }
+
+    void Spectrogram::MapBands(size_t binCount) noexcept
+    {
+        // Log-spaced band edges; bands narrower than one bin all read their nearest bin.
+        const float binsPerHz = sampleRate > 0.0f ? static_cast<float>(binCount * 2) / sampleRate : 0.0f;
+        const float ratio = maxFrequency / minFrequency;
+        for (size_t band = 0; band < bandCount; ++band)
+        {
+            const float low = minFrequency * std::pow(ratio, static_cast<float>(band) / static_cast<float>(bandCount));
+            const float high =
+                minFrequency * std::pow(ratio, static_cast<float>(band + 1) / static_cast<float>(bandCount));
+            const auto first = std::min(static_cast<size_t>(low * binsPerHz + 0.5f), binCount - 1);
+            const auto last = std::clamp(static_cast<size_t>(high * binsPerHz + 0.5f), first + 1, binCount) - 1;
+            firstBin[band] = static_cast<uint32_t>(first);
+            lastBin[band] = static_cast<uint32_t>(last);
+        }
+
+        mappedBins = binCount;
+    }
+
+    void Spectrogram::PushSpectrum(std::span<const float> magnitudes) noexcept
+    {
+        if (magnitudes.empty())
+        {
+            return;
+        }
+
+        if (magnitudes.size() != mappedBins)
+        {
+            MapBands(magnitudes.size());
+        }
+
+        for (size_t band = 0; band < bandCount; ++band)
+        {
+            const size_t first = firstBin[band];
+            const size_t last = lastBin[band];
+
+            float peak = magnitudes[first];
+            for (size_t bin = first + 1; bin <= last; ++bin)
+            {
+                peak = std::max(peak, magnitudes[bin]);
+            }
+            bandLevels[band] = peak;
+        }
+
+        // Contiguous and branch-free, so the compiler vectorizes the dB and palette index math.
+        const float maxLevel = static_cast<float>(g_kPaletteSize - 1);
+        float *levels = bandLevels.data();
+        for (size_t band = 0; band < bandCount; ++band)
+        {
+            const float db = g_kDbPerOctave * FastLog2(std::max(levels[band], g_kMinMagnitude));
+            levels[band] = std::clamp((db - floorDb) * levelScale, 0.0f, maxLevel);
+        }
+
+        const uint64_t row = rowCount.load(std::memory_order_relaxed);
+        uint32_t *pixels = rows.data() + static_cast<size_t>(row % rowCapacity) * bandCount;
+        for (size_t band = 0; band < bandCount; ++band)
+        {
+            pixels[band] = palette[static_cast<size_t>(levels[band])];
+        }
+
+        rowCount.store(row + 1, std::memory_order_release);
+    }
+
+    uint64_t Spectrogram::GetRowCount() const noexcept
+    {
+        return rowCount.load(std::memory_order_acquire);
+    }
+
+    std::span<const uint32_t> Spectrogram::GetRow(uint64_t row) const noexcept
+    {
+        return std::span<const uint32_t>(rows.data() + static_cast<size_t>(row % rowCapacity) * bandCount, bandCount);
+    }
+
+    size_t Spectrogram::GetReadableRows() const noexcept
+    {
+        return rowCapacity / 2;
+    }
+
+    size_t Spectrogram::GetBandCount() const noexcept
+    {
+        return bandCount;
+    }
+
+    uint32_t Spectrogram::GetBackgroundColor() const noexcept
+    {
+        return palette[0];
+    }
+
+    float Spectrogram::GetFrequencyPosition(float frequency) const noexcept
+    {
+        if (frequency <= minFrequency)
+        {
+            return 0.0f;
+        }
+
+        return std::min(std::log(frequency / minFrequency) / std::log(maxFrequency / minFrequency), 1.0f);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
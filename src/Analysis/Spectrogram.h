@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Scrolling spectrogram fed with the spectrum an analyzer already computed.
+     *
+     * PushSpectrum() runs on the analysis thread once per hop. It folds the linear FFT magnitudes
+     * into log-spaced frequency bands, converts them to dB and colors, and stores the result as
+     * one row of packed RGBA pixels (0xAABBGGRR, the layout of IM_COL32) in a ring. The band loop
+     * uses a polynomial log2 instead of std::log10, so it vectorizes, and nothing is allocated
+     * after construction. The UI thread only copies finished rows to the screen.
+     *
+     * There is one writer and any number of readers. Readers must stay within the newest
+     * GetReadableRows() rows; the ring is twice that size, so the writer never reaches a row
+     * that a reader can see in the same frame.
+     */
+    class Spectrogram
+    {
+    public:
+        /**
+         * @brief Constructs the Spectrogram.
+         * @param sampleRate Sample rate of the analyzed audio in Hz.
+         * @param fftSize Expected FFT length of the pushed spectra; each spectrum holds fftSize / 2 magnitudes.
+         * @param bandCount Number of log-spaced frequency bands per row.
+         * @param rowCount Number of rows kept in the ring.
+         * @param minFrequency Lower edge of the lowest band in Hz.
+         * @param maxFrequency Upper edge of the highest band in Hz, limited to the Nyquist frequency.
+         * @param floorDb Level drawn with the darkest color.
+         * @param ceilingDb Level drawn with the brightest color.
+         */
+        Spectrogram(float sampleRate,
+            size_t fftSize,
+            size_t bandCount,
+            size_t rowCount,
+            float minFrequency,
+            float maxFrequency,
+            float floorDb,
+            float ceilingDb);
+
+        /**
+         * @brief Destructor.
+         */
+        ~Spectrogram();
+
+        Spectrogram(const Spectrogram &) = delete;
+
+        Spectrogram &operator=(const Spectrogram &) = delete;
+
+        Spectrogram(Spectrogram &&) = delete;
+
+        Spectrogram &operator=(Spectrogram &&) = delete;
+
+        /**
+         * @brief Converts one spectrum to a row and publishes it. Writer thread only; never allocates.
+         *
+         * A spectrum of a different length than the last one (the analyzer's FFT size was changed)
+         * remaps the bands before it is converted.
+         * @param magnitudes Linear FFT magnitudes, bin 0 first.
+         */
+        void PushSpectrum(std::span<const float> magnitudes) noexcept;
+
+        /**
+         * @brief Gets the number of rows published so far.
+         * @return Row count; row GetRowCount() - 1 is the newest.
+         */
+        uint64_t GetRowCount() const noexcept;
+
+        /**
+         * @brief Gets the pixels of a published row, lowest band first.
+         * @param row Row index within the newest GetReadableRows() rows.
+         * @return Packed RGBA colors, one per band.
+         */
+        std::span<const uint32_t> GetRow(uint64_t row) const noexcept;
+
+        /**
+         * @brief Gets how many of the newest rows readers may access.
+         * @return Readable row count.
+         */
+        size_t GetReadableRows() const noexcept;
+
+        /**
+         * @brief Gets the number of bands per row.
+         * @return Band count.
+         */
+        size_t GetBandCount() const noexcept;
+
+        /**
+         * @brief Gets the color used for levels at or below the floor.
+         * @return Packed RGBA color.
+         */
+        uint32_t GetBackgroundColor() const noexcept;
+
+        /**
+         * @brief Gets the position of a frequency on the log-frequency axis.
+         * @param frequency Frequency in Hz.
+         * @return 0 at the lower edge of the lowest band, 1 at the upper edge of the highest band.
+         */
+        float GetFrequencyPosition(float frequency) const noexcept;
+
+    private:
+        /**
+         * @brief Computes the FFT bin range of every band.
+         * @param binCount Number of magnitudes per spectrum.
+         */
+        void MapBands(size_t binCount) noexcept;
+
+        float sampleRate;               ///< Sample rate of the analyzed audio in Hz.
+        size_t mappedBins;              ///< Spectrum length the band ranges were computed for.
+        size_t bandCount;               ///< Bands per row.
+        size_t rowCapacity;             ///< Rows in the ring.
+        float minFrequency;             ///< Lower edge of the lowest band in Hz.
+        float maxFrequency;             ///< Upper edge of the highest band in Hz.
+        float floorDb;                  ///< Level mapped to palette entry 0.
+        float levelScale;               ///< Palette entries per dB.
+        std::vector<uint32_t> firstBin; ///< [band] first FFT bin folded into the band.
+        std::vector<uint32_t> lastBin;  ///< [band] last FFT bin folded into the band.
+        std::vector<float> bandLevels;  ///< [band] scratch: peak magnitude, then palette index.
+        std::vector<uint32_t> palette;  ///< Colors from floor to ceiling.
+        std::vector<uint32_t> rows;     ///< [row][band] ring of packed colors.
+        std::atomic<uint64_t> rowCount; ///< Rows published.
+    };
+
+} // namespace GuitarDiagnostics::Analysis
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Analysis/AnalysisClock.h"
+#include "Analysis/Analyzer.h"
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace GuitarDiagnostics::Analysis
+{
+
+    /**
+     * @brief Fixed set of analyzers run in order, with the set chosen at compile time.
+     *
+     * The analyzers are stored by value in one object, in declaration order, instead of behind
+     * separately allocated shared_ptrs. Every call is a fold over the concrete types, so with
+     * final analyzer classes there is no virtual dispatch and the compiler may inline the calls.
+     * AnalysisEngine remains the way to run a set that is only known at run time; it also
+     * provides the per-analyzer timing and shared result access the UI relies on.
+     *
+     * Not thread-safe; configure and drive the pipeline from one thread.
+     *
+     * @tparam TAnalyzers Analyzer types, each derived from Analyzer and listed at most once.
+     */
+    template<typename... TAnalyzers> class StaticPipeline
+    {
+    public:
+        static_assert(sizeof...(TAnalyzers) > 0, "StaticPipeline needs at least one analyzer");
+        static_assert((std::is_base_of_v<Analyzer, TAnalyzers> && ...), "StaticPipeline runs Analyzer types");
+
+        /**
+         * @brief Constructs every analyzer with its default parameters.
+         */
+        StaticPipeline();
+
+        /**
+         * @brief Constructs every analyzer from its own argument, e.g. its parameter block.
+         * @param arguments One constructor argument per analyzer, in order.
+         */
+        template<typename... TArguments>
+            requires(sizeof...(TArguments) == sizeof...(TAnalyzers) && sizeof...(TArguments) > 0)
+        explicit StaticPipeline(TArguments &&...arguments);
+
+        /**
+         * @brief Destructor.
+         */
+        ~StaticPipeline() = default;
+
+        StaticPipeline(const StaticPipeline &) = delete;
+
+        StaticPipeline &operator=(const StaticPipeline &) = delete;
+
+        StaticPipeline(StaticPipeline &&) = delete;
+
+        StaticPipeline &operator=(StaticPipeline &&) = delete;
+
+        /**
+         * @brief Configures every analyzer.
+         * @param config Analysis configuration settings.
+         */
+        void Configure(const AnalysisConfig &config);
+
+        /**
+         * @brief Advances the configured clock and runs every analyzer on one hop, in order.
+         * @param audioData Audio samples of the hop.
+         */
+        void ProcessBuffer(std::span<const float> audioData);
+
+        /**
+         * @brief Advances the configured clock over all hops and runs every analyzer's ProcessBlocks(), in order.
+         * @param samples Audio samples of the hops, back to back; a trailing partial hop is ignored.
+         * @param hop Frames per hop.
+         */
+        void ProcessBlocks(std::span<const float> samples, size_t hop);
+
+        /**
+         * @brief Resets every analyzer.
+         */
+        void Reset();
+
+        /**
+         * @brief Hands a parameter update to every analyzer. Must not allocate, like Analyzer::ApplyParameters().
+         * @param parameters Parameter blocks of all analyzers.
+         */
+        void ApplyParameters(const AnalyzerParameters &parameters);
+
+        /**
+         * @brief Calls a function with every analyzer, in order.
+         * @param function Callable taking any of the analyzer types by reference.
+         */
+        template<typename TFunction> void ForEach(TFunction &&function);
+
+        /**
+         * @brief Gets an analyzer by type.
+         * @tparam T One of TAnalyzers.
+         * @return The analyzer.
+         */
+        template<typename T> T &Get() noexcept
+        {
+            return std::get<T>(analyzers);
+        }
+
+        /**
+         * @brief Gets an analyzer by type.
+         * @tparam T One of TAnalyzers.
+         * @return The analyzer.
+         */
+        template<typename T> const T &Get() const noexcept
+        {
+            return std::get<T>(analyzers);
+        }
+
+        /**
+         * @brief Gets the number of analyzers.
+         * @return sizeof...(TAnalyzers).
+         */
+        static constexpr size_t GetAnalyzerCount() noexcept
+        {
+            return sizeof...(TAnalyzers);
+        }
+
+    private:
+        std::tuple<TAnalyzers...> analyzers; ///< Analyzers by value, in run order.
+        AnalysisClock *clock;                ///< Clock of the last configuration.
+    };
+
+    template<typename... TAnalyzers> StaticPipeline<TAnalyzers...>::StaticPipeline()
+        : analyzers(), clock(&SteadyClock::GetInstance())
+    {
+    }
+
+    template<typename... TAnalyzers>
+    template<typename... TArguments>
+        requires(sizeof...(TArguments) == sizeof...(TAnalyzers) && sizeof...(TArguments) > 0)
+    StaticPipeline<TAnalyzers...>::StaticPipeline(TArguments &&...arguments)
+        : analyzers(std::forward<TArguments>(arguments)...), clock(&SteadyClock::GetInstance())
+    {
+    }
+
+    template<typename... TAnalyzers> void StaticPipeline<TAnalyzers...>::Configure(const AnalysisConfig &config)
+    {
+        clock = config.clock;
+        std::apply([&config](TAnalyzers &...analyzer) { (analyzer.Configure(config), ...); }, analyzers);
+    }
+
+    template<typename... TAnalyzers>
+    void StaticPipeline<TAnalyzers...>::ProcessBuffer(std::span<const float> audioData)
+    {
+        clock->OnHop(audioData.size());
+        std::apply([audioData](TAnalyzers &...analyzer) { (analyzer.ProcessBuffer(audioData), ...); }, analyzers);
+    }
+
+    template<typename... TAnalyzers>
+    void StaticPipeline<TAnalyzers...>::ProcessBlocks(std::span<const float> samples, size_t hop)
+    {
+        if (hop == 0 || samples.size() < hop)
+        {
+            return;
+        }
+
+        const std::span<const float> hops = samples.first(samples.size() / hop * hop);
+        clock->OnHop(hops.size());
+        std::apply([hops, hop](TAnalyzers &...analyzer) { (analyzer.ProcessBlocks(hops, hop), ...); }, analyzers);
+    }
+
+    template<typename... TAnalyzers> void StaticPipeline<TAnalyzers...>::Reset()
+    {
+        std::apply([](TAnalyzers &...analyzer) { (analyzer.Reset(), ...); }, analyzers);
+    }
+
+    template<typename... TAnalyzers>
+    void StaticPipeline<TAnalyzers...>::ApplyParameters(const AnalyzerParameters &parameters)
+    {
+        std::apply([&parameters](TAnalyzers &...analyzer) { (analyzer.ApplyParameters(parameters), ...); }, analyzers);
+    }
+
+    template<typename... TAnalyzers>
+    template<typename TFunction>
+    void StaticPipeline<TAnalyzers...>::ForEach(TFunction &&function)
+    {
+        std::apply([&function](TAnalyzers &...analyzer) { (function(analyzer), ...); }, analyzers);
+    }
+
+} // namespace GuitarDiagnostics::Analysis
@@ -1,6 +1,11 @@
 #include "Analysis/StringHealth/StringHealthAnalyzer.h"
 
+#include "Analysis/AnalysisClock.h"
+#include "Util/Tracer.h"
+
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
 #include <numeric>
 
@@ -13,14 +18,15 @@ namespace GuitarDiagnostics::Analysis
     {
     }
 
-    StringHealthAnalyzer::StringHealthAnalyzer()
-        : config(0.0f, 0), pitchDetector(nullptr), fftProcessor(nullptr), harmonicEnergies(), timestamps(),
-          currentFundamental(0.0f), analysisFrameCount(0), currentHealthScore(0.0f), currentDecayRate(0.0f),
-          currentSpectralCentroid(0.0f), currentInharmonicity(0.0f),
-          latestResult(std::make_shared<StringHealthResult>())
+    StringHealthAnalyzer::StringHealthAnalyzer(const StringHealthParameters &newParameters)
+        : config(0.0f, 0), parameters(newParameters), pitchDetector(nullptr), fftProcessor(nullptr),
+          arena(), harmonicEnergies(), timestamps(), historyCount(0), batchLag(0), currentFundamental(0.0f),
+          analysisFrameCount(0), currentHealthScore(0.0f), currentDecayRate(0.0f), currentSpectralCentroid(0.0f),
+          currentInharmonicity(0.0f), latestResult(std::make_shared<StringHealthResult>()), resultPool()
     {
-        harmonicEnergies.reserve(g_kDecayHistorySize);
-        timestamps.reserve(g_kDecayHistorySize);
+        parameters.fftSize = std::bit_ceil(std::clamp<size_t>(parameters.fftSize, 256, 16384));
+        parameters.numHarmonics = std::clamp<size_t>(parameters.numHarmonics, 1, g_kMaxHarmonics);
+        parameters.decayHistorySize = std::clamp<size_t>(parameters.decayHistorySize, 10, g_kMaxDecayHistorySize);
     }
 
     StringHealthAnalyzer::~StringHealthAnalyzer()
@@ -32,12 +38,19 @@ namespace GuitarDiagnostics::Analysis
         config = newConfig;
 
         GuitarDSP::YinPitchDetectorConfig yinConfig;
-        yinConfig.threshold = 0.15f;
+        yinConfig.threshold = parameters.yinThreshold;
         yinConfig.minFrequency = 80.0f;
         yinConfig.maxFrequency = 1200.0f;
 
         pitchDetector = std::make_unique<GuitarDSP::YinPitchDetector>(yinConfig);
-        fftProcessor = std::make_unique<GuitarDSP::FFTProcessor>(g_kFFTSize, config.sampleRate);
+        fftProcessor = std::make_unique<GuitarDSP::FFTProcessor>(parameters.fftSize, config.sampleRate);
+
+        using TimePoint = AnalysisClock::Duration;
+        arena.Reset(Util::Arena::GetFootprint<float>(parameters.decayHistorySize)
+                    + Util::Arena::GetFootprint<TimePoint>(parameters.decayHistorySize));
+        harmonicEnergies = arena.Allocate<float>(parameters.decayHistorySize);
+        timestamps = arena.Allocate<TimePoint>(parameters.decayHistorySize);
+        historyCount = 0;
     }
 
     void StringHealthAnalyzer::ProcessBuffer(std::span<const float> audioData)
@@ -47,24 +60,67 @@ namespace GuitarDiagnostics::Analysis
             return;
         }
 
-        fftProcessor->ComputeSpectrum(audioData);
+        ProcessHop(audioData);
+        UpdateFeatures();
+        UpdateResult();
+    }
+
+    void StringHealthAnalyzer::ProcessBlocks(std::span<const float> samples, size_t hop)
+    {
+        if (!fftProcessor || !pitchDetector || hop == 0 || samples.size() < hop)
+        {
+            return;
+        }
+
+        // Only the published score needs the features, so they are derived once, from the last hop.
+        const size_t hopCount = samples.size() / hop;
+        for (size_t i = 0; i < hopCount; ++i)
+        {
+            batchLag = AnalysisClock::FramesToDuration((hopCount - 1 - i) * hop, config.sampleRate);
+            ProcessHop(samples.subspan(i * hop, hop));
+        }
+        batchLag = std::chrono::nanoseconds(0);
+
+        UpdateFeatures();
+        UpdateResult();
+    }
+
+    void StringHealthAnalyzer::ProcessHop(std::span<const float> audioData)
+    {
+        {
+            GD_TRACE_SCOPE("String Health", "FFT");
+            fftProcessor->ComputeSpectrum(audioData);
+        }
 
-        auto pitchResult = pitchDetector->Detect(audioData, config.sampleRate);
+        float frequency = 0.0f;
+        float confidence = 0.0f;
+        {
+            GD_TRACE_SCOPE("String Health", "YIN");
+            auto pitchResult = pitchDetector->Detect(audioData, config.sampleRate);
+            if (pitchResult.has_value())
+            {
+                frequency = pitchResult->frequency;
+                confidence = pitchResult->confidence;
+            }
+        }
 
-        if (pitchResult.has_value() && pitchResult->confidence > 0.5f)
+        if (confidence > 0.5f)
         {
-            currentFundamental = pitchResult->frequency;
+            currentFundamental = frequency;
             TrackHarmonicEnergy(currentFundamental);
         }
 
+        analysisFrameCount++;
+    }
+
+    void StringHealthAnalyzer::UpdateFeatures()
+    {
+        GD_TRACE_SCOPE("String Health", "Features");
         currentDecayRate = AnalyzeDecay();
         currentSpectralCentroid = CalculateSpectralCentroid();
         currentInharmonicity = CalculateInharmonicity(currentFundamental);
 
         CalculateHealthScore();
-        UpdateResult();
-
-        analysisFrameCount++;
     }
 
     std::shared_ptr<AnalysisResult> StringHealthAnalyzer::GetLatestResult() const
@@ -82,15 +138,34 @@ namespace GuitarDiagnostics::Analysis
         currentSpectralCentroid = 0.0f;
         currentInharmonicity = 0.0f;
 
-        harmonicEnergies.clear();
-        timestamps.clear();
+        historyCount = 0;
 
         UpdateResult();
     }
 
+    std::string StringHealthAnalyzer::GetName() const
+    {
+        return "String Health";
+    }
+
+    void StringHealthAnalyzer::ApplyParameters(const AnalyzerParameters &newParameters)
+    {
+        const auto &update = newParameters.stringHealth;
+        parameters.minDecayRate = update.minDecayRate;
+        parameters.maxDecayRate = update.maxDecayRate;
+        parameters.decayWeight = update.decayWeight;
+        parameters.spectralWeight = update.spectralWeight;
+        parameters.inharmonicityWeight = update.inharmonicityWeight;
+    }
+
+    const StringHealthParameters &StringHealthAnalyzer::GetParameters() const
+    {
+        return parameters;
+    }
+
     float StringHealthAnalyzer::AnalyzeDecay()
     {
-        if (harmonicEnergies.size() < 10)
+        if (historyCount < 10)
         {
             return 0.0f;
         }
@@ -100,69 +175,69 @@ namespace GuitarDiagnostics::Analysis
 
     void StringHealthAnalyzer::TrackHarmonicEnergy(float fundamental)
     {
-        std::vector<float> energies;
-        energies.reserve(g_kNumHarmonics);
+        GD_TRACE_SCOPE("String Health", "Harmonics");
 
-        for (size_t n = 1; n <= g_kNumHarmonics; ++n)
+        // Gather into an inline frame, then reduce; the hop allocates nothing.
+        const auto &spectrum = fftProcessor->GetSpectrum();
+        HarmonicFrame magnitudes;
+        for (size_t n = 1; n <= parameters.numHarmonics; ++n)
         {
             float harmonicFreq = fundamental * static_cast<float>(n);
-            float magnitude = fftProcessor->GetSpectrum().GetMagnitudeAtFrequency(harmonicFreq);
-            energies.push_back(magnitude);
+            magnitudes.PushBack(spectrum.GetMagnitudeAtFrequency(harmonicFreq));
         }
 
-        harmonicEnergies.push_back(energies);
-        timestamps.push_back(std::chrono::steady_clock::now());
+        const float energySum = std::accumulate(magnitudes.begin(), magnitudes.end(), 0.0f);
 
-        if (harmonicEnergies.size() > g_kDecayHistorySize)
+        // Keep the newest decayHistorySize frames, oldest first.
+        if (historyCount == harmonicEnergies.size())
         {
-            harmonicEnergies.erase(harmonicEnergies.begin());
-            timestamps.erase(timestamps.begin());
+            std::shift_left(harmonicEnergies.begin(), harmonicEnergies.end(), 1);
+            std::shift_left(timestamps.begin(), timestamps.end(), 1);
+            --historyCount;
         }
+
+        harmonicEnergies[historyCount] = energySum / static_cast<float>(parameters.numHarmonics);
+        timestamps[historyCount] = config.clock->Now() - batchLag;
+        ++historyCount;
     }
 
     float StringHealthAnalyzer::FitExponentialDecay() const
     {
-        if (harmonicEnergies.size() < 2 || timestamps.size() < 2)
+        if (historyCount < 2)
         {
             return 0.0f;
         }
 
-        std::vector<float> avgEnergies;
-        avgEnergies.reserve(harmonicEnergies.size());
+        std::array<float, g_kMaxDecayHistorySize> logEnergies{};
+        std::array<float, g_kMaxDecayHistorySize> times{};
+        size_t pointCount = 0;
 
-        for (const auto &energies : harmonicEnergies)
+        for (size_t i = 0; i < historyCount; ++i)
         {
-            float avg = std::accumulate(energies.begin(), energies.end(), 0.0f) / static_cast<float>(energies.size());
-            avgEnergies.push_back(avg);
-        }
-
-        std::vector<float> logEnergies;
-        std::vector<float> times;
-
-        for (size_t i = 0; i < avgEnergies.size(); ++i)
-        {
-            if (avgEnergies[i] > 1e-6f)
+            if (harmonicEnergies[i] > 1e-6f)
             {
-                logEnergies.push_back(std::log(avgEnergies[i]));
+                logEnergies[pointCount] = std::log(harmonicEnergies[i]);
                 auto duration =
                     std::chrono::duration_cast<std::chrono::milliseconds>(timestamps[i] - timestamps[0]).count();
-                times.push_back(static_cast<float>(duration) / 1000.0f);
+                times[pointCount] = static_cast<float>(duration) / 1000.0f;
+                pointCount++;
             }
         }
 
-        if (logEnergies.size() < 2)
+        if (pointCount < 2)
         {
             return 0.0f;
         }
 
-        float meanTime = std::accumulate(times.begin(), times.end(), 0.0f) / static_cast<float>(times.size());
-        float meanLogE =
-            std::accumulate(logEnergies.begin(), logEnergies.end(), 0.0f) / static_cast<float>(logEnergies.size());
+        float meanTime =
+            std::accumulate(times.begin(), times.begin() + pointCount, 0.0f) / static_cast<float>(pointCount);
+        float meanLogE = std::accumulate(logEnergies.begin(), logEnergies.begin() + pointCount, 0.0f)
+                         / static_cast<float>(pointCount);
 
         float numerator = 0.0f;
         float denominator = 0.0f;
 
-        for (size_t i = 0; i < times.size(); ++i)
+        for (size_t i = 0; i < pointCount; ++i)
         {
             float tDiff = times[i] - meanTime;
             float eDiff = logEnergies[i] - meanLogE;
@@ -194,15 +269,16 @@ namespace GuitarDiagnostics::Analysis
             return 0.0f;
         }
 
-        auto harmonicPeaks = FindHarmonicPeaks(fundamental);
+        HarmonicFrame harmonicPeaks;
+        FindHarmonicPeaks(fundamental, harmonicPeaks);
 
-        if (harmonicPeaks.empty())
+        if (harmonicPeaks.IsEmpty())
         {
             return 0.0f;
         }
 
         float totalDeviation = 0.0f;
-        for (size_t n = 0; n < harmonicPeaks.size(); ++n)
+        for (size_t n = 0; n < harmonicPeaks.GetSize(); ++n)
         {
             float expectedFreq = fundamental * static_cast<float>(n + 1);
             float actualFreq = harmonicPeaks[n];
@@ -214,23 +290,21 @@ namespace GuitarDiagnostics::Analysis
             }
         }
 
-        return std::clamp(totalDeviation / static_cast<float>(harmonicPeaks.size()), 0.0f, 1.0f);
+        return std::clamp(totalDeviation / static_cast<float>(harmonicPeaks.GetSize()), 0.0f, 1.0f);
     }
 
-    std::vector<float> StringHealthAnalyzer::FindHarmonicPeaks(float fundamental) const
+    void StringHealthAnalyzer::FindHarmonicPeaks(float fundamental, HarmonicFrame &peaks) const
     {
-        std::vector<float> peaks;
-        peaks.reserve(g_kNumHarmonics);
-
+        peaks.Clear();
         if (config.sampleRate <= 0.0f)
         {
-            return peaks;
+            return;
         }
 
         const auto &spectrum = fftProcessor->GetSpectrum();
-        float binWidth = config.sampleRate / static_cast<float>(g_kFFTSize);
+        float binWidth = config.sampleRate / static_cast<float>(parameters.fftSize);
 
-        for (size_t n = 1; n <= g_kNumHarmonics; ++n)
+        for (size_t n = 1; n <= parameters.numHarmonics; ++n)
         {
             float expectedFreq = fundamental * static_cast<float>(n);
             size_t expectedBin = static_cast<size_t>(expectedFreq / binWidth);
@@ -241,7 +315,7 @@ namespace GuitarDiagnostics::Analysis
             for (int offset = -3; offset <= 3; ++offset)
             {
                 int checkBin = static_cast<int>(expectedBin) + offset;
-                if (checkBin >= 0 && checkBin < static_cast<int>(g_kFFTSize / 2))
+                if (checkBin >= 0 && checkBin < static_cast<int>(parameters.fftSize / 2))
                 {
                     float mag = spectrum.GetMagnitudeAtBin(static_cast<size_t>(checkBin));
 
@@ -253,16 +327,19 @@ namespace GuitarDiagnostics::Analysis
                 }
             }
 
-            float peakFreq = static_cast<float>(peakBin) * binWidth;
-            peaks.push_back(peakFreq);
+            peaks.PushBack(static_cast<float>(peakBin) * binWidth);
         }
-
-        return peaks;
     }
 
     float StringHealthAnalyzer::NormalizeDecayRate(float decayRate) const
     {
-        float normalized = (decayRate - g_kMinDecayRate) / (g_kMaxDecayRate - g_kMinDecayRate);
+        const float range = parameters.maxDecayRate - parameters.minDecayRate;
+        if (range == 0.0f)
+        {
+            return 0.0f;
+        }
+
+        float normalized = (decayRate - parameters.minDecayRate) / range;
         return std::clamp(normalized, 0.0f, 1.0f);
     }
 
@@ -278,13 +355,16 @@ namespace GuitarDiagnostics::Analysis
         float spectralScore = NormalizeSpectralFeatures(currentSpectralCentroid);
         float inharmonicityScore = 1.0f - currentInharmonicity;
 
-        currentHealthScore = 0.3f * decayScore + 0.3f * spectralScore + 0.4f * inharmonicityScore;
+        currentHealthScore = parameters.decayWeight * decayScore + parameters.spectralWeight * spectralScore
+                             + parameters.inharmonicityWeight * inharmonicityScore;
         currentHealthScore = std::clamp(currentHealthScore, 0.0f, 1.0f);
     }
 
     void StringHealthAnalyzer::UpdateResult()
     {
-        auto result = std::make_shared<StringHealthResult>();
+        GD_TRACE_SCOPE("String Health", "Publish");
+
+        auto result = resultPool.Acquire(latestResult);
         result->timestamp = std::chrono::system_clock::now();
         result->isValid = true;
         result->healthScore = currentHealthScore;
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "Analysis/Analyzer.h"
+#include "Analysis/AnalyzerParameters.h"
+#include "Analysis/HarmonicFrame.h"
+#include "Analysis/ResultPool.h"
+#include "Util/Arena.h"
 
 #include <FFTProcessor.h>
 #include <YinPitchDetector.h>
@@ -8,7 +12,7 @@
 #include <chrono>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <span>
 
 namespace GuitarDiagnostics::Analysis
 {
@@ -35,13 +39,14 @@ namespace GuitarDiagnostics::Analysis
      *
      * Evaluates brightness, sustain, and inharmonicity to determine string age and quality.
      */
-    class StringHealthAnalyzer : public Analyzer
+    class StringHealthAnalyzer final : public Analyzer
     {
     public:
         /**
          * @brief Constructs the StringHealthAnalyzer.
+         * @param parameters Tuning parameters; out-of-range values are clamped.
          */
-        StringHealthAnalyzer();
+        explicit StringHealthAnalyzer(const StringHealthParameters &parameters = StringHealthParameters());
 
         /**
          * @brief Destructor.
@@ -60,11 +65,37 @@ namespace GuitarDiagnostics::Analysis
 
         void ProcessBuffer(std::span<const float> audioData) override;
 
+        /**
+         * @brief Tracks the harmonics of every hop, then scores and publishes the last one only.
+         * @param samples Audio samples of the hops, back to back.
+         * @param hop Frames per hop.
+         */
+        void ProcessBlocks(std::span<const float> samples, size_t hop) override;
+
         std::shared_ptr<AnalysisResult> GetLatestResult() const override;
 
         void Reset() override;
 
+        std::string GetName() const override;
+
+        void ApplyParameters(const AnalyzerParameters &parameters) override;
+
+        /**
+         * @brief Gets the tuning parameters in use.
+         * @return Parameters after clamping.
+         */
+        const StringHealthParameters &GetParameters() const;
+
     private:
+        /**
+         * @brief Computes the spectrum and pitch of one hop and extends the harmonic energy history.
+         * @param audioData Audio samples of the hop.
+         */
+        void ProcessHop(std::span<const float> audioData);
+
+        /** @brief Derives the features and health score from the latest hop and the history. */
+        void UpdateFeatures();
+
         /**
          * @brief Analyzes the amplitude decay envelope.
          * @return The calculated decay rate.
@@ -99,9 +130,9 @@ namespace GuitarDiagnostics::Analysis
         /**
          * @brief Identifies harmonic peaks given a fundamental.
          * @param fundamental The fundamental frequency.
-         * @return A vector of harmonic peak frequencies.
+         * @param peaks Receives the peak frequencies of harmonics 1..parameters.numHarmonics.
          */
-        std::vector<float> FindHarmonicPeaks(float fundamental) const;
+        void FindHarmonicPeaks(float fundamental, HarmonicFrame &peaks) const;
 
         /**
          * @brief Normalizes the raw decay rate to a 0-1 scale.
@@ -124,12 +155,16 @@ namespace GuitarDiagnostics::Analysis
         void UpdateResult();
 
         AnalysisConfig config;
+        StringHealthParameters parameters;
 
         std::unique_ptr<GuitarDSP::YinPitchDetector> pitchDetector;
         std::unique_ptr<GuitarDSP::FFTProcessor> fftProcessor;
 
-        std::vector<std::vector<float>> harmonicEnergies;
-        std::vector<std::chrono::steady_clock::time_point> timestamps;
+        Util::Arena arena;
+        std::span<float> harmonicEnergies;
+        std::span<std::chrono::nanoseconds> timestamps;
+        size_t historyCount;
+        std::chrono::nanoseconds batchLag;
 
         float currentFundamental;
         size_t analysisFrameCount;
@@ -141,12 +176,9 @@ namespace GuitarDiagnostics::Analysis
 
         mutable std::mutex resultMutex;
         std::shared_ptr<StringHealthResult> latestResult;
+        ResultPool<StringHealthResult> resultPool;
 
-        static constexpr size_t g_kFFTSize = 2048;
-        static constexpr size_t g_kNumHarmonics = 10;
-        static constexpr size_t g_kDecayHistorySize = 50;
-        static constexpr float g_kMinDecayRate = -50.0f;
-        static constexpr float g_kMaxDecayRate = -5.0f;
+        static constexpr size_t g_kMaxDecayHistorySize = 200;
     };
 
 } // namespace GuitarDiagnostics::Analysis
@@ -1,58 +1,86 @@
 #include "App/Application.h"
 
-#include "Analysis/Fretbuzz/FretBuzzDetector.h"
-#include "Analysis/Intonation/IntonationAnalyzer.h"
-#include "Analysis/StringHealth/StringHealthAnalyzer.h"
-#include "App/AudioProcessingLayer.h"
+#include "Analysis/ParameterStore.h"
 #include "App/DiagnosticVisualizationLayer.h"
-#include "Util/LockFreeRingBuffer.h"
-#include "Analysis/AnalysisEngine.h"
+#include "App/StationManager.h"
+#include "Audio/LiveAudioSource.h"
+#include "Audio/NullAudioSource.h"
+#include "UI/RedrawThrottle.h"
+#include "Util/Tracer.h"
 
 #include <Logger.h>
 
+#include <GLFW/glfw3.h>
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
+#include <filesystem>
 #include <stdexcept>
+#include <string>
 
 namespace GuitarDiagnostics::App
 {
 
-    Application::Application()
-        : Kappa::Application(GetApplicationSpec()),
-          ringBuffer(std::make_unique<Util::LockFreeRingBuffer<float>>(g_kRingBufferCapacity)),
-          audioLayer(std::make_unique<AudioProcessingLayer>(ringBuffer.get())),
-          analysisEngine(std::make_unique<Analysis::AnalysisEngine>(ringBuffer.get(),
-              Analysis::AnalysisConfig(g_kSampleRate, g_kBufferSize)))
+    Application::Application(const std::vector<uint32_t> &stationDevices)
+        : Kappa::Application(GetApplicationSpec()), parameterStore(std::make_unique<Analysis::ParameterStore>()),
+          lastParameterCheck(std::chrono::steady_clock::now()),
+          stationManager(
+              std::make_unique<StationManager>(parameterStore.get(), g_kSampleRate, g_kBufferSize, g_kFastBlockSize)),
+          redrawThrottle(
+              std::make_unique<UI::RedrawThrottle>(g_kResultRedrawInterval, g_kIdleRedrawInterval, g_kInputRedrawHold)),
+          uiWaiting(false)
     {
         LOG_INFO("Initializing Guitar Diagnostic Analyzer");
 
-        analysisEngine->RegisterAnalyzer(std::make_shared<Analysis::FretBuzzDetector>());
-        analysisEngine->RegisterAnalyzer(std::make_shared<Analysis::IntonationAnalyzer>());
-        analysisEngine->RegisterAnalyzer(std::make_shared<Analysis::StringHealthAnalyzer>());
+        if (std::filesystem::exists(g_kParameterFile))
+        {
+            parameterStore->LoadFromFile(g_kParameterFile);
+        }
+        else
+        {
+            LOG_INFO("No {} found, using default analyzer parameters", g_kParameterFile);
+        }
+
+        stationManager->SetResultListener([this]([[maybe_unused]] uint64_t resultSequence) {
+            if (uiWaiting.exchange(false))
+            {
+                glfwPostEmptyEvent();
+            }
+        });
 
-        if (!audioLayer->InitializeDefault(g_kSampleRate, g_kBufferSize))
+        // The first station also feeds the waveform and spectrogram tabs.
+        if (stationDevices.empty())
         {
-            LOG_ERROR("Failed to initialize audio layer");
-            throw std::runtime_error("Audio initialization failed");
+            stationManager->AddStation("Station 1", std::make_unique<Audio::LiveAudioSource>(), true);
+        }
+        for (uint32_t deviceId : stationDevices)
+        {
+            const std::string name = "Station " + std::to_string(stationManager->GetStationCount() + 1);
+            stationManager->AddStation(
+                name, std::make_unique<Audio::LiveAudioSource>(deviceId), stationManager->GetStationCount() == 0);
         }
 
-        if (!analysisEngine->Start())
+        if (stationManager->GetStationCount() == 0)
         {
-            LOG_ERROR("Failed to start analysis engine");
-            throw std::runtime_error("Analysis engine start failed");
+            LOG_ERROR("Failed to open input device, continuing without audio input");
+
+            if (!stationManager->AddStation("Station 1", std::make_unique<Audio::NullAudioSource>(), true))
+            {
+                LOG_ERROR("Failed to initialize audio layer");
+                throw std::runtime_error("Audio initialization failed");
+            }
         }
 
-        if (!audioLayer->Start())
+        if (!stationManager->Start(g_kAnalysisWorkers))
         {
-            LOG_ERROR("Failed to start audio processing");
-            throw std::runtime_error("Audio start failed");
+            LOG_ERROR("Failed to start stations");
+            throw std::runtime_error("Station start failed");
         }
 
         InitializeImGui();
 
-        PushLayer<DiagnosticVisualizationLayer>(analysisEngine.get(), ringBuffer.get());
+        PushLayer<DiagnosticVisualizationLayer>(stationManager.get(), redrawThrottle.get());
 
         LOG_INFO("Application initialized successfully");
     }
@@ -63,9 +91,8 @@ namespace GuitarDiagnostics::App
 
         ShutdownImGui();
 
-        audioLayer->Stop();
-        analysisEngine->Stop();
-        audioLayer->Shutdown();
+        // Stop the audio callbacks and analysis threads before the result listener's captures are destroyed.
+        stationManager->Stop();
 
         LOG_INFO("Application shutdown complete");
     }
@@ -107,8 +134,52 @@ namespace GuitarDiagnostics::App
         ImGui::DestroyContext();
     }
 
+    void Application::WaitForRedraw()
+    {
+        using Clock = UI::RedrawThrottle::Clock;
+
+        while (true)
+        {
+            const uint64_t sequence = stationManager->GetResultSequence();
+            const auto now = Clock::now();
+            const auto wait = redrawThrottle->GetWaitTime(sequence, now);
+            if (wait <= Clock::duration::zero())
+            {
+                redrawThrottle->MarkRendered(sequence, now);
+                return;
+            }
+
+            // Publish the wait before re-checking, so a result landing in between still wakes us.
+            uiWaiting.store(true);
+            if (stationManager->GetResultSequence() != sequence)
+            {
+                uiWaiting.store(false);
+                continue;
+            }
+
+            GD_TRACE_SCOPE("ui", "Idle");
+            glfwWaitEventsTimeout(std::chrono::duration<double>(wait).count());
+
+            const bool wokenByResult = !uiWaiting.exchange(false);
+            const auto woken = Clock::now();
+            if (!wokenByResult && woken < now + wait)
+            {
+                redrawThrottle->NotifyInput(woken);
+            }
+        }
+    }
+
     void Application::BeginFrame()
     {
+        WaitForRedraw();
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastParameterCheck >= g_kParameterCheckInterval)
+        {
+            lastParameterCheck = now;
+            parameterStore->ReloadIfChanged();
+        }
+
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
@@ -116,6 +187,8 @@ namespace GuitarDiagnostics::App
 
     void Application::EndFrame()
     {
+        GD_TRACE_SCOPE("ui", "Draw");
+
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     }
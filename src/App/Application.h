@@ -2,22 +2,25 @@
 
 #include <Application.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace GuitarDiagnostics::App
 {
-    class AudioProcessingLayer;
+    class StationManager;
 }
 
 namespace GuitarDiagnostics::Analysis
 {
-    class AnalysisEngine;
+    class ParameterStore;
 }
 
-namespace GuitarDiagnostics::Util
+namespace GuitarDiagnostics::UI
 {
-    template<typename T> class LockFreeRingBuffer;
+    class RedrawThrottle;
 }
 
 namespace GuitarDiagnostics::App
@@ -26,16 +29,17 @@ namespace GuitarDiagnostics::App
     /**
      * @brief Main application class inheriting from Kappa::Application.
      *
-     * Handles the initialization and management of the audio layer, analysis engine,
-     * and UI integration through ImGui.
+     * Handles the initialization and management of the stations (audio input plus analysis
+     * pipeline per device) and UI integration through ImGui.
      */
     class Application : public Kappa::Application
     {
     public:
         /**
          * @brief Constructs the Application instance.
+         * @param stationDevices Input device IDs to analyze, one station each; empty for the default device only.
          */
-        Application();
+        explicit Application(const std::vector<uint32_t> &stationDevices);
 
         /**
          * @brief Destructor.
@@ -54,7 +58,9 @@ namespace GuitarDiagnostics::App
         /**
          * @brief Called at the beginning of each frame.
          *
-         * Setup frame-specific resources or states.
+         * Sleeps until a frame is due (new analysis results, user input or the idle refresh),
+         * sets up frame-specific resources or states, and reloads the analyzer parameter file
+         * when it has been edited.
          */
         void BeginFrame() override;
 
@@ -82,14 +88,29 @@ namespace GuitarDiagnostics::App
          */
         void ShutdownImGui();
 
-        std::unique_ptr<Util::LockFreeRingBuffer<float>>
-            ringBuffer;                                   ///< Ring buffer for audio data transfer between threads.
-        std::unique_ptr<AudioProcessingLayer> audioLayer; ///< Handles platform-specific audio device interaction.
-        std::unique_ptr<Analysis::AnalysisEngine> analysisEngine; ///< Core engine for analyzing audio data.
-
-        static constexpr float g_kSampleRate = 48000.0f;       ///< Audio sample rate in Hz.
-        static constexpr uint32_t g_kBufferSize = 512;         ///< Audio buffer size.
-        static constexpr size_t g_kRingBufferCapacity = 16384; ///< Capacity of the ring buffer.
+        /**
+         * @brief Blocks the UI thread until the redraw throttle says a frame is due.
+         *
+         * Waits on window events with a timeout; the analysis thread wakes the wait when it
+         * publishes results, and any other early wake-up is treated as user input.
+         */
+        void WaitForRedraw();
+
+        std::unique_ptr<Analysis::ParameterStore> parameterStore; ///< Analyzer parameters, hot-reloaded from JSON.
+        std::chrono::steady_clock::time_point lastParameterCheck; ///< Time of the last parameter file check.
+        std::unique_ptr<StationManager> stationManager;           ///< Audio inputs and their analysis pipelines.
+        std::unique_ptr<UI::RedrawThrottle> redrawThrottle;       ///< Decides which frames are drawn.
+        std::atomic<bool> uiWaiting;                              ///< True while the UI thread sleeps until a frame.
+
+        static constexpr float g_kSampleRate = 48000.0f;                           ///< Analysis sample rate in Hz.
+        static constexpr uint32_t g_kBufferSize = 512;                             ///< Analysis hop size.
+        static constexpr uint32_t g_kFastBlockSize = 128;                          ///< Device and fast-path block.
+        static constexpr size_t g_kAnalysisWorkers = 0;                            ///< Analysis threads, 0 = per core.
+        static constexpr const char *g_kParameterFile = "guitar-diagnostics.json"; ///< Analyzer parameter file.
+        static constexpr std::chrono::seconds g_kParameterCheckInterval{ 1 };      ///< Parameter file poll period.
+        static constexpr std::chrono::milliseconds g_kResultRedrawInterval{ 33 };  ///< Max redraw rate for results.
+        static constexpr std::chrono::milliseconds g_kIdleRedrawInterval{ 500 };   ///< Redraw period when idle.
+        static constexpr std::chrono::milliseconds g_kInputRedrawHold{ 500 };      ///< Full-rate period after input.
     };
 
 } // namespace GuitarDiagnostics::App
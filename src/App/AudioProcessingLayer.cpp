@@ -1,14 +1,15 @@
 #include "App/AudioProcessingLayer.h"
 
-#include <AudioDevice.h>
+#include "Audio/LiveAudioSource.h"
 
-#include <span>
+#include <Logger.h>
 
 namespace GuitarDiagnostics::App
 {
 
-    AudioProcessingLayer::AudioProcessingLayer(Util::LockFreeRingBuffer<float> *ringBuffer)
-        : ringBuffer(ringBuffer), audioDevice(nullptr), bufferSize(0)
+    AudioProcessingLayer::AudioProcessingLayer(Util::LockFreeRingBuffer<float> *ringBuffer,
+        Util::LockFreeRingBuffer<float> *monitorBuffer)
+        : ringBuffer(ringBuffer), monitorBuffer(monitorBuffer), audioSource(nullptr), bufferSize(0)
     {
     }
 
@@ -19,67 +20,53 @@ namespace GuitarDiagnostics::App
 
     bool AudioProcessingLayer::Initialize(uint32_t deviceId, float sampleRate, uint32_t bufferSizeFrames)
     {
-        if (audioDevice && audioDevice->IsOpen())
-        {
-            return false;
-        }
-
-        this->bufferSize = bufferSizeFrames;
-        audioDevice = std::make_unique<GuitarIO::RtAudioDevice>();
-
-        GuitarIO::AudioStreamConfig config;
-        config.sampleRate = static_cast<uint32_t>(sampleRate);
-        config.bufferSize = bufferSizeFrames;
-        config.inputChannels = 1;
-        config.outputChannels = 0;
-
-        GuitarIO::AudioCallback callback =
-            [](std::span<const float> inputBuffer, std::span<float> outputBuffer, void *userData) -> int {
-            return AudioProcessingLayer::AudioCallback(inputBuffer, outputBuffer, userData);
-        };
-
-        return audioDevice->Open(deviceId, config, callback, this);
+        return Initialize(std::make_unique<Audio::LiveAudioSource>(deviceId), sampleRate, bufferSizeFrames);
     }
 
     bool AudioProcessingLayer::InitializeDefault(float sampleRate, uint32_t bufferSizeFrames)
     {
-        if (audioDevice && audioDevice->IsOpen())
+        return Initialize(std::make_unique<Audio::LiveAudioSource>(), sampleRate, bufferSizeFrames);
+    }
+
+    bool AudioProcessingLayer::Initialize(std::unique_ptr<Audio::AudioSource> source,
+        float sampleRate,
+        uint32_t bufferSizeFrames)
+    {
+        if (!source || (audioSource && audioSource->IsOpen()))
         {
             return false;
         }
 
         this->bufferSize = bufferSizeFrames;
-        audioDevice = std::make_unique<GuitarIO::RtAudioDevice>();
-
-        GuitarIO::AudioStreamConfig config;
-        config.sampleRate = static_cast<uint32_t>(sampleRate);
-        config.bufferSize = bufferSizeFrames;
-        config.inputChannels = 1;
-        config.outputChannels = 0;
+        audioSource = std::move(source);
+        audioSource->SetRingBuffer(ringBuffer);
+        audioSource->SetMonitorBuffer(monitorBuffer);
 
-        GuitarIO::AudioCallback callback =
-            [](std::span<const float> inputBuffer, std::span<float> outputBuffer, void *userData) -> int {
-            return AudioProcessingLayer::AudioCallback(inputBuffer, outputBuffer, userData);
-        };
+        if (!audioSource->Open(sampleRate, bufferSizeFrames))
+        {
+            LOG_ERROR("Failed to open audio source: {}", audioSource->GetName());
+            return false;
+        }
 
-        return audioDevice->OpenDefault(config, callback, this);
+        LOG_INFO("Audio source opened: {}", audioSource->GetName());
+        return true;
     }
 
     bool AudioProcessingLayer::Start()
     {
-        if (!audioDevice || !audioDevice->IsOpen())
+        if (!audioSource || !audioSource->IsOpen())
         {
             return false;
         }
 
-        return audioDevice->Start();
+        return audioSource->Start();
     }
 
     void AudioProcessingLayer::Stop()
     {
-        if (audioDevice && audioDevice->IsRunning())
+        if (audioSource && audioSource->IsRunning())
         {
-            audioDevice->Stop();
+            audioSource->Stop();
         }
     }
 
@@ -87,42 +74,27 @@ namespace GuitarDiagnostics::App
     {
         Stop();
 
-        if (audioDevice && audioDevice->IsOpen())
+        if (audioSource && audioSource->IsOpen())
         {
-            audioDevice->Close();
+            audioSource->Close();
         }
 
-        audioDevice.reset();
+        audioSource.reset();
     }
 
-    bool AudioProcessingLayer::IsOpen() const
-    {
-        return audioDevice && audioDevice->IsOpen();
-    }
-
-    bool AudioProcessingLayer::IsRunning() const
+    Audio::AudioSource *AudioProcessingLayer::GetSource() const
     {
-        return audioDevice && audioDevice->IsRunning();
+        return audioSource.get();
     }
 
-    int AudioProcessingLayer::AudioCallback(std::span<const float> inputBuffer,
-        [[maybe_unused]] std::span<float> outputBuffer,
-        void *userData)
+    bool AudioProcessingLayer::IsOpen() const
     {
-        auto *layer = static_cast<AudioProcessingLayer *>(userData);
-        if (layer)
-        {
-            layer->OnAudioInput(inputBuffer);
-        }
-        return 0;
+        return audioSource && audioSource->IsOpen();
     }
 
-    void AudioProcessingLayer::OnAudioInput(std::span<const float> inputBuffer)
+    bool AudioProcessingLayer::IsRunning() const
     {
-        if (!inputBuffer.empty() && ringBuffer)
-        {
-            ringBuffer->Write(inputBuffer);
-        }
+        return audioSource && audioSource->IsRunning();
     }
 
 } // namespace GuitarDiagnostics::App
@@ -1,10 +1,8 @@
 #pragma once
 
-#include "Audio/AudioDeviceManager.h"
+#include "Audio/AudioSource.h"
 #include "Util/LockFreeRingBuffer.h"
 
-#include <RtAudioDevice.h>
-
 #include <cstdint>
 #include <memory>
 
@@ -14,7 +12,9 @@ namespace GuitarDiagnostics::App
     /**
      * @brief Manages audio input and processing.
      *
-     * Handles audio device initialization, streaming, and buffering of input data.
+     * Owns the active AudioSource (live device, file, synthetic or null) and connects it
+     * to the ring buffer consumed by the analysis engine, plus an optional monitor ring buffer
+     * that receives a copy of the stream for the UI.
      */
     class AudioProcessingLayer
     {
@@ -22,8 +22,10 @@ namespace GuitarDiagnostics::App
         /**
          * @brief Constructs the AudioProcessingLayer.
          * @param ringBuffer Pointer to the ring buffer for storing audio samples.
+         * @param monitorBuffer Pointer to the ring buffer receiving a display copy, may be nullptr.
          */
-        AudioProcessingLayer(Util::LockFreeRingBuffer<float> *ringBuffer);
+        AudioProcessingLayer(Util::LockFreeRingBuffer<float> *ringBuffer,
+            Util::LockFreeRingBuffer<float> *monitorBuffer = nullptr);
 
         /**
          * @brief Destructor.
@@ -55,6 +57,15 @@ namespace GuitarDiagnostics::App
          */
         bool InitializeDefault(float sampleRate, uint32_t bufferSizeFrames);
 
+        /**
+         * @brief Initializes the layer with an arbitrary audio source.
+         * @param source The audio source to take ownership of.
+         * @param sampleRate Desired sample rate in Hz.
+         * @param bufferSizeFrames Desired buffer size in frames.
+         * @return True if initialization was successful, false otherwise.
+         */
+        bool Initialize(std::unique_ptr<Audio::AudioSource> source, float sampleRate, uint32_t bufferSizeFrames);
+
         /**
          * @brief Starts the audio stream.
          * @return True if started successfully, false otherwise.
@@ -71,6 +82,12 @@ namespace GuitarDiagnostics::App
          */
         void Shutdown();
 
+        /**
+         * @brief Retrieves the active audio source.
+         * @return Pointer to the source, nullptr if not initialized.
+         */
+        Audio::AudioSource *GetSource() const;
+
         /**
          * @brief Checks if the audio device is open.
          * @return True if open, false otherwise.
@@ -84,24 +101,10 @@ namespace GuitarDiagnostics::App
         bool IsRunning() const;
 
     private:
-        /**
-         * @brief Static audio callback function used by the audio device.
-         * @param inputBuffer Buffer containing input audio samples.
-         * @param outputBuffer Buffer for output audio samples (unused here).
-         * @param userData User data pointer (AudioProcessingLayer instance).
-         * @return 0 on success, non-zero on error.
-         */
-        static int AudioCallback(std::span<const float> inputBuffer, std::span<float> outputBuffer, void *userData);
-
-        /**
-         * @brief Processes incoming audio data.
-         * @param inputBuffer Buffer containing input audio samples.
-         */
-        void OnAudioInput(std::span<const float> inputBuffer);
-
-        Util::LockFreeRingBuffer<float> *ringBuffer; ///< Pointer to the ring buffer for thread-safe data transfer.
-        std::unique_ptr<GuitarIO::RtAudioDevice> audioDevice; ///< Audio device instance.
-        uint32_t bufferSize;                                  ///< Current buffer size in frames.
+        Util::LockFreeRingBuffer<float> *ringBuffer;     ///< Pointer to the ring buffer for thread-safe data transfer.
+        Util::LockFreeRingBuffer<float> *monitorBuffer;  ///< Pointer to the display copy ring buffer, may be null.
+        std::unique_ptr<Audio::AudioSource> audioSource; ///< Active audio source.
+        uint32_t bufferSize;                             ///< Current buffer size in frames.
     };
 
 } // namespace GuitarDiagnostics::App
@@ -1,33 +1,64 @@
 #include "App/DiagnosticVisualizationLayer.h"
 
+#include "App/AudioProcessingLayer.h"
+#include "App/StationManager.h"
+#include "Audio/AudioSource.h"
 #include "UI/Panels/AudioMonitorPanel.h"
 #include "UI/Panels/FretBuzzPanel.h"
 #include "UI/Panels/IntonationPanel.h"
+#include "UI/Panels/PerformancePanel.h"
+#include "UI/Panels/SpectrogramPanel.h"
+#include "UI/Panels/StationsPanel.h"
 #include "UI/Panels/StringHealthPanel.h"
+#include "UI/RedrawThrottle.h"
 #include "UI/TabController.h"
 #include "Util/LockFreeRingBuffer.h"
+#include "Util/Tracer.h"
 #include "Analysis/AnalysisEngine.h"
 
 #include <Logger.h>
 
+#include <imgui.h>
+
+#include <vector>
+
 namespace GuitarDiagnostics::App
 {
 
-    DiagnosticVisualizationLayer::DiagnosticVisualizationLayer(Analysis::AnalysisEngine *engine,
-        Util::LockFreeRingBuffer<float> *ringBuffer)
-        : analysisEngine(engine), tabController(nullptr)
+    DiagnosticVisualizationLayer::DiagnosticVisualizationLayer(const StationManager *stationManager,
+        UI::RedrawThrottle *redrawThrottle)
+        : analysisEngine(stationManager->GetStation(0).engine.get()), redrawThrottle(redrawThrottle),
+          tabController(nullptr)
     {
         LOG_INFO("Initializing DiagnosticVisualizationLayer");
 
+        GD_TRACE_THREAD_NAME("UI");
+
         auto fretBuzzPanel = std::make_unique<UI::FretBuzzPanel>(analysisEngine);
         auto intonationPanel = std::make_unique<UI::IntonationPanel>(analysisEngine);
         auto stringHealthPanel = std::make_unique<UI::StringHealthPanel>(analysisEngine);
-        auto audioMonitorPanel = std::make_unique<UI::AudioMonitorPanel>(ringBuffer);
+        const Station &primary = stationManager->GetStation(0);
+        // The monitor buffer holds the source's samples before resampling, at the source's own rate.
+        auto audioMonitorPanel = std::make_unique<UI::AudioMonitorPanel>(primary.monitorBuffer.get(),
+            primary.audioLayer->GetSource()->GetSampleRate());
+        auto spectrogramPanel = std::make_unique<UI::SpectrogramPanel>(primary.spectrogram.get());
+
+        std::vector<UI::StationView> stationViews;
+        for (size_t i = 0; i < stationManager->GetStationCount(); ++i)
+        {
+            const Station &station = stationManager->GetStation(i);
+            stationViews.emplace_back(station.name, station.engine.get(), station.audioLayer->GetSource());
+        }
+        auto stationsPanel = std::make_unique<UI::StationsPanel>(std::move(stationViews));
+        auto performancePanel = std::make_unique<UI::PerformancePanel>(analysisEngine, redrawThrottle);
 
         tabController = std::make_unique<UI::TabController>(std::move(fretBuzzPanel),
             std::move(intonationPanel),
             std::move(stringHealthPanel),
-            std::move(audioMonitorPanel));
+            std::move(audioMonitorPanel),
+            std::move(spectrogramPanel),
+            std::move(stationsPanel),
+            std::move(performancePanel));
 
         tabController->OnAttach();
 
@@ -46,6 +77,8 @@ namespace GuitarDiagnostics::App
 
     void DiagnosticVisualizationLayer::OnUpdate(float deltaTime)
     {
+        GD_TRACE_SCOPE("ui", "Update");
+
         if (tabController)
         {
             tabController->OnUpdate(deltaTime);
@@ -54,14 +87,26 @@ namespace GuitarDiagnostics::App
 
     void DiagnosticVisualizationLayer::OnRender()
     {
+        GD_TRACE_SCOPE("ui", "Render");
+
         if (tabController)
         {
             tabController->Render();
         }
+
+        // A held widget (slider drag, keyboard navigation) keeps animating without new window events.
+        if (redrawThrottle && ImGui::IsAnyItemActive())
+        {
+            redrawThrottle->NotifyInput(UI::RedrawThrottle::Clock::now());
+        }
     }
 
     void DiagnosticVisualizationLayer::OnEvent([[maybe_unused]] Kappa::Event &event)
     {
+        if (redrawThrottle)
+        {
+            redrawThrottle->NotifyInput(UI::RedrawThrottle::Clock::now());
+        }
     }
 
 } // namespace GuitarDiagnostics::App
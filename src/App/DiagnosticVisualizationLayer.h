@@ -9,34 +9,33 @@ namespace GuitarDiagnostics::Analysis
     class AnalysisEngine;
 }
 
-namespace GuitarDiagnostics::Util
-{
-    template<typename T> class LockFreeRingBuffer;
-}
-
 namespace GuitarDiagnostics::UI
 {
+    class RedrawThrottle;
     class TabController;
 }
 
 namespace GuitarDiagnostics::App
 {
+    class StationManager;
 
     /**
      * @brief Layer responsible for visualizing analysis results.
      *
      * Renders the UI panels for different diagnostic tools (Fret Buzz, Intonation, String Health)
-     * and visualization of raw audio data.
+     * and visualization of raw audio data and its spectrogram for the first station, plus a summary
+     * of all stations. Reports user input to the redraw throttle, so the application draws at full
+     * rate while the user interacts and idles otherwise.
      */
     class DiagnosticVisualizationLayer : public Kappa::Layer
     {
     public:
         /**
          * @brief Constructs the DiagnosticVisualizationLayer.
-         * @param engine Pointer to the analysis engine providing data.
-         * @param ringBuffer Pointer to the ring buffer for audio monitoring visualization.
+         * @param stationManager Pointer to the stations providing data; must hold at least one station.
+         * @param redrawThrottle Pointer to the application's redraw throttle.
          */
-        DiagnosticVisualizationLayer(Analysis::AnalysisEngine *engine, Util::LockFreeRingBuffer<float> *ringBuffer);
+        DiagnosticVisualizationLayer(const StationManager *stationManager, UI::RedrawThrottle *redrawThrottle);
 
         /**
          * @brief Destructor.
@@ -63,13 +62,14 @@ namespace GuitarDiagnostics::App
         void OnRender() override;
 
         /**
-         * @brief Handles events propagated to this layer.
+         * @brief Handles events propagated to this layer. Every event counts as user input.
          * @param event The event to handle.
          */
         void OnEvent(Kappa::Event &event) override;
 
     private:
-        Analysis::AnalysisEngine *analysisEngine;         ///< Pointer to the analysis engine.
+        Analysis::AnalysisEngine *analysisEngine;         ///< Engine of the station shown in detail.
+        UI::RedrawThrottle *redrawThrottle;               ///< Throttle notified of user input.
         std::unique_ptr<UI::TabController> tabController; ///< Controller for managing UI tabs.
     };
 
@@ -0,0 +1,220 @@
+#include "App/StationManager.h"
+
+#include "Analysis/AnalysisWorkerPool.h"
+#include "Analysis/Envelope/EnvelopeFollower.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/ParameterStore.h"
+#include "Analysis/Spectrogram.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "App/AudioProcessingLayer.h"
+#include "Audio/AudioSource.h"
+#include "Util/LockFreeRingBuffer.h"
+
+#include <Logger.h>
+
+#include <utility>
+
+namespace GuitarDiagnostics::App
+{
+
+    namespace
+    {
+        constexpr size_t g_kRingBufferCapacity = 16384;        ///< Capacity of each station's ring buffer.
+        constexpr size_t g_kMonitorBufferCapacity = 65536;     ///< Capacity of each monitor buffer.
+        constexpr size_t g_kSpectrogramBands = 96;             ///< Spectrogram bands per row.
+        constexpr size_t g_kSpectrogramRows = 1024;            ///< Spectrogram row ring size.
+        constexpr float g_kSpectrogramMinFrequency = 40.0f;    ///< Lowest spectrogram band in Hz.
+        constexpr float g_kSpectrogramMaxFrequency = 16000.0f; ///< Highest spectrogram band in Hz.
+        constexpr float g_kSpectrogramFloorDb = -100.0f;       ///< Darkest spectrogram level.
+        constexpr float g_kSpectrogramCeilingDb = -10.0f;      ///< Brightest spectrogram level.
+    } // namespace
+
+    Station::Station() : name(), ringBuffer(), monitorBuffer(), spectrogram(), engine(), audioLayer()
+    {
+    }
+
+    Station::~Station()
+    {
+    }
+
+    StationManager::StationManager(const Analysis::ParameterStore *parameterStore,
+        float sampleRate,
+        uint32_t bufferSize,
+        uint32_t fastBlockSize)
+        : parameterStore(parameterStore), sampleRate(sampleRate), bufferSize(bufferSize), fastBlockSize(fastBlockSize),
+          resultListener(), stations(), workerPool()
+    {
+    }
+
+    StationManager::~StationManager()
+    {
+        Stop();
+    }
+
+    bool StationManager::AddStation(const std::string &name,
+        std::unique_ptr<Audio::AudioSource> source,
+        bool withDisplay)
+    {
+        if (IsRunning())
+        {
+            LOG_ERROR("Cannot add station {} while running", name);
+            return false;
+        }
+
+        auto station = std::make_unique<Station>();
+        station->name = name;
+        station->ringBuffer = std::make_unique<Util::LockFreeRingBuffer<float>>(g_kRingBufferCapacity);
+        if (withDisplay)
+        {
+            station->monitorBuffer = std::make_unique<Util::LockFreeRingBuffer<float>>(g_kMonitorBufferCapacity);
+        }
+
+        station->audioLayer =
+            std::make_unique<AudioProcessingLayer>(station->ringBuffer.get(), station->monitorBuffer.get());
+        // With a fast path the device delivers small blocks so onsets reach the analyzers within a few milliseconds.
+        const uint32_t deviceBlockSize = fastBlockSize > 0 ? fastBlockSize : bufferSize;
+        if (!station->audioLayer->Initialize(std::move(source), sampleRate, deviceBlockSize))
+        {
+            LOG_ERROR("Failed to open input of station {}", name);
+            return false;
+        }
+
+        Analysis::AnalysisConfig config(sampleRate, bufferSize);
+        config.fastBlockSize = fastBlockSize;
+        station->engine = std::make_unique<Analysis::AnalysisEngine>(station->ringBuffer.get(), config);
+
+        // Devices that run at another rate are resampled on the analysis thread; analyzers stay at sampleRate.
+        const float inputRate = station->audioLayer->GetSource()->GetSampleRate();
+        if (!station->engine->SetInputSampleRate(inputRate))
+        {
+            LOG_ERROR("Cannot resample station {} from {} Hz to {} Hz", name, inputRate, sampleRate);
+            return false;
+        }
+        if (inputRate != sampleRate)
+        {
+            LOG_INFO("Station {} input runs at {} Hz, resampled to {} Hz", name, inputRate, sampleRate);
+        }
+
+        const Analysis::AnalyzerParameters &parameters = *parameterStore->GetCurrent();
+        auto fretBuzzDetector = std::make_shared<Analysis::FretBuzzDetector>(parameters.fretBuzz);
+        if (withDisplay)
+        {
+            station->spectrogram = std::make_unique<Analysis::Spectrogram>(sampleRate,
+                fretBuzzDetector->GetParameters().fftSize,
+                g_kSpectrogramBands,
+                g_kSpectrogramRows,
+                g_kSpectrogramMinFrequency,
+                g_kSpectrogramMaxFrequency,
+                g_kSpectrogramFloorDb,
+                g_kSpectrogramCeilingDb);
+            fretBuzzDetector->SetSpectrogram(station->spectrogram.get());
+        }
+
+        station->engine->RegisterAnalyzer(fretBuzzDetector);
+        station->engine->RegisterAnalyzer(std::make_shared<Analysis::IntonationAnalyzer>(parameters.intonation));
+        station->engine->RegisterAnalyzer(std::make_shared<Analysis::StringHealthAnalyzer>(parameters.stringHealth));
+        station->engine->RegisterAnalyzer(std::make_shared<Analysis::EnvelopeFollower>());
+        station->engine->SetParameterStore(parameterStore);
+        station->engine->SetResultListener(resultListener);
+
+        LOG_INFO("Added station {}: {}", stations.size(), name);
+        stations.push_back(std::move(station));
+        return true;
+    }
+
+    void StationManager::SetResultListener(Analysis::AnalysisEngine::ResultListener listener)
+    {
+        resultListener = std::move(listener);
+        for (auto &station : stations)
+        {
+            station->engine->SetResultListener(resultListener);
+        }
+    }
+
+    bool StationManager::Start(size_t workerCount)
+    {
+        if (IsRunning() || stations.empty())
+        {
+            return false;
+        }
+
+        // The pool is the only thread running hops; it also executes the engines' control commands between them.
+        workerPool = std::make_unique<Analysis::AnalysisWorkerPool>(workerCount);
+        for (auto &station : stations)
+        {
+            if (station->engine->IsRunning())
+            {
+                LOG_ERROR("Engine of station {} runs its own worker thread", station->name);
+                workerPool.reset();
+                return false;
+            }
+            workerPool->AddEngine(station->engine.get());
+        }
+
+        if (!workerPool->Start())
+        {
+            LOG_ERROR("Failed to start analysis workers");
+            workerPool.reset();
+            return false;
+        }
+
+        for (auto &station : stations)
+        {
+            if (!station->audioLayer->Start())
+            {
+                LOG_ERROR("Failed to start audio of station {}", station->name);
+                Stop();
+                return false;
+            }
+        }
+
+        LOG_INFO("Started {} stations on {} analysis threads", stations.size(), workerPool->GetThreadCount());
+        return true;
+    }
+
+    void StationManager::Stop()
+    {
+        for (auto &station : stations)
+        {
+            station->audioLayer->Stop();
+        }
+
+        if (workerPool)
+        {
+            workerPool->Stop();
+            workerPool.reset();
+        }
+    }
+
+    bool StationManager::IsRunning() const
+    {
+        return workerPool && workerPool->IsRunning();
+    }
+
+    size_t StationManager::GetStationCount() const
+    {
+        return stations.size();
+    }
+
+    const Station &StationManager::GetStation(size_t index) const
+    {
+        return *stations[index];
+    }
+
+    size_t StationManager::GetWorkerCount() const
+    {
+        return IsRunning() ? workerPool->GetThreadCount() : 0;
+    }
+
+    uint64_t StationManager::GetResultSequence() const
+    {
+        uint64_t sequence = 0;
+        for (const auto &station : stations)
+        {
+            sequence += station->engine->GetResultSequence();
+        }
+        return sequence;
+    }
+
+} // namespace GuitarDiagnostics::App
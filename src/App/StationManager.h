@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Analysis/AnalysisEngine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+    class AnalysisWorkerPool;
+    class ParameterStore;
+    class Spectrogram;
+}
+
+namespace GuitarDiagnostics::Audio
+{
+    class AudioSource;
+}
+
+namespace GuitarDiagnostics::Util
+{
+    template<typename T> class LockFreeRingBuffer;
+}
+
+namespace GuitarDiagnostics::App
+{
+    class AudioProcessingLayer;
+
+    /**
+     * @brief One input device and the pipeline that analyzes it.
+     *
+     * Stations share nothing but the parameter store and the worker pool: each has its own ring
+     * buffer, audio layer, analysis engine, analyzers, results and metrics.
+     */
+    struct Station
+    {
+        std::string name;                                               ///< Display name.
+        std::unique_ptr<Util::LockFreeRingBuffer<float>> ringBuffer;    ///< Audio from the source to the engine.
+        std::unique_ptr<Util::LockFreeRingBuffer<float>> monitorBuffer; ///< Display copy of the audio, may be null.
+        std::unique_ptr<Analysis::Spectrogram> spectrogram;             ///< Fret buzz spectrogram, may be null.
+        std::unique_ptr<Analysis::AnalysisEngine> engine;               ///< Engine running the station's analyzers.
+        std::unique_ptr<AudioProcessingLayer> audioLayer;               ///< Owner of the station's audio source.
+
+        /**
+         * @brief Constructs an empty Station.
+         */
+        Station();
+
+        /**
+         * @brief Destructor.
+         */
+        ~Station();
+
+        Station(const Station &) = delete;
+
+        Station &operator=(const Station &) = delete;
+
+        Station(Station &&) = delete;
+
+        Station &operator=(Station &&) = delete;
+    };
+
+    /**
+     * @brief Runs independent analysis pipelines for several input devices in one process.
+     *
+     * Every added station gets its own copy of the analyzers, configured from the shared
+     * parameter store. Start() schedules all engines on one AnalysisWorkerPool, so N stations
+     * cost as many threads as there are cores rather than one analysis thread each.
+     */
+    class StationManager
+    {
+    public:
+        /**
+         * @brief Constructs the StationManager.
+         * @param parameterStore Analyzer parameters shared by all stations; must outlive the manager.
+         * @param sampleRate Analysis sample rate of every station in Hz; sources at other rates are resampled.
+         * @param bufferSize Hop size of every station in frames.
+         * @param fastBlockSize Fast-path block size in frames, also requested from the devices; 0 for hop-sized blocks.
+         */
+        StationManager(const Analysis::ParameterStore *parameterStore,
+            float sampleRate,
+            uint32_t bufferSize,
+            uint32_t fastBlockSize = 0);
+
+        /**
+         * @brief Destructor. Stops all stations.
+         */
+        ~StationManager();
+
+        StationManager(const StationManager &) = delete;
+
+        StationManager &operator=(const StationManager &) = delete;
+
+        StationManager(StationManager &&) = delete;
+
+        StationManager &operator=(StationManager &&) = delete;
+
+        /**
+         * @brief Opens a source and builds a pipeline for it. Must not be called while running.
+         * @param name Display name of the station.
+         * @param source Audio source of the station.
+         * @param withDisplay True to also fill a monitor buffer and a spectrogram for the detail views.
+         * @return True if the source was opened and the station added, false otherwise.
+         */
+        bool AddStation(const std::string &name, std::unique_ptr<Audio::AudioSource> source, bool withDisplay);
+
+        /**
+         * @brief Sets the callback every station's engine notifies after a hop. Must not be called while running.
+         * @param listener Callback, or an empty function to stop notifications.
+         */
+        void SetResultListener(Analysis::AnalysisEngine::ResultListener listener);
+
+        /**
+         * @brief Starts the worker pool and then every station's audio source.
+         *
+         * The pool marks the engines as externally driven, so commands sent to a station's engine
+         * (Reset(), ApplyParameters(), SetAnalyzerEnabled()) run on the pool thread between hops.
+         * @param workerCount Number of analysis threads, 0 for one per hardware thread.
+         * @return True if everything started, false if a station's engine runs its own thread or a start failed.
+         */
+        bool Start(size_t workerCount);
+
+        /**
+         * @brief Stops the audio sources, then the worker pool.
+         */
+        void Stop();
+
+        /**
+         * @brief Checks if the stations are running.
+         * @return True if running, false otherwise.
+         */
+        bool IsRunning() const;
+
+        /**
+         * @brief Gets the number of stations.
+         * @return Station count.
+         */
+        size_t GetStationCount() const;
+
+        /**
+         * @brief Gets a station.
+         * @param index Station index, in the order the stations were added.
+         * @return The station.
+         */
+        const Station &GetStation(size_t index) const;
+
+        /**
+         * @brief Gets the number of analysis threads serving the stations.
+         * @return Thread count, 0 while stopped.
+         */
+        size_t GetWorkerCount() const;
+
+        /**
+         * @brief Gets the sum of all stations' result sequence numbers.
+         * @return Value that changes whenever any station publishes results; safe to read from any thread.
+         */
+        uint64_t GetResultSequence() const;
+
+    private:
+        const Analysis::ParameterStore *parameterStore;           ///< Shared analyzer parameters.
+        float sampleRate;                                         ///< Analysis sample rate of every station in Hz.
+        uint32_t bufferSize;                                      ///< Hop size of every station in frames.
+        uint32_t fastBlockSize;                                   ///< Fast-path block of every station, 0 if none.
+        Analysis::AnalysisEngine::ResultListener resultListener;  ///< Handed to every station's engine.
+        std::vector<std::unique_ptr<Station>> stations;           ///< Stations in the order they were added.
+        std::unique_ptr<Analysis::AnalysisWorkerPool> workerPool; ///< Threads driving the engines while running.
+    };
+
+} // namespace GuitarDiagnostics::App
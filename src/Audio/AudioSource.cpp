@@ -0,0 +1,58 @@
+#include "Audio/AudioSource.h"
+
+#include "Util/LockFreeRingBuffer.h"
+
+namespace GuitarDiagnostics::Audio
+{
+
+    AudioSource::AudioSource() : ringBuffer(nullptr), monitorBuffer(nullptr), droppedSamples(0)
+    {
+    }
+
+    void AudioSource::SetRingBuffer(Util::LockFreeRingBuffer<float> *newRingBuffer)
+    {
+        ringBuffer = newRingBuffer;
+    }
+
+    void AudioSource::SetMonitorBuffer(Util::LockFreeRingBuffer<float> *newMonitorBuffer)
+    {
+        monitorBuffer = newMonitorBuffer;
+    }
+
+    uint64_t AudioSource::GetDroppedSamples() const
+    {
+        return droppedSamples.load(std::memory_order_relaxed);
+    }
+
+    bool AudioSource::PushSamples(std::span<const float> samples) noexcept
+    {
+        if (samples.empty())
+        {
+            return true;
+        }
+
+        if (monitorBuffer)
+        {
+            monitorBuffer->Write(samples);
+        }
+
+        if (!ringBuffer)
+        {
+            return true;
+        }
+
+        if (!ringBuffer->Write(samples))
+        {
+            droppedSamples.fetch_add(samples.size(), std::memory_order_relaxed);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool AudioSource::HasSpaceFor(size_t count) const noexcept
+    {
+        return ringBuffer && ringBuffer->GetAvailableWrite() >= count;
+    }
+
+} // namespace GuitarDiagnostics::Audio
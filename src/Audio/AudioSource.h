@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace GuitarDiagnostics::Util
+{
+    template<typename T> class LockFreeRingBuffer;
+}
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Abstract producer of mono audio samples for the analysis pipeline.
+     *
+     * Every implementation (live device, file, synthetic, null) delivers audio through
+     * PushSamples(), which performs a single lock-free ring buffer write and never allocates.
+     * This keeps the hot path identical across deployments, tests and benchmarks.
+     */
+    class AudioSource
+    {
+    public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~AudioSource() = default;
+
+        /**
+         * @brief Opens the source with the requested stream parameters.
+         * @param sampleRate Desired sample rate in Hz; sources with a fixed or preferred rate may use another.
+         * @param bufferSizeFrames Desired block size in frames.
+         * @return True if the source was opened successfully, false otherwise.
+         */
+        virtual bool Open(float sampleRate, uint32_t bufferSizeFrames) = 0;
+
+        /**
+         * @brief Starts delivering samples into the connected ring buffer.
+         * @return True if started successfully, false otherwise.
+         */
+        virtual bool Start() = 0;
+
+        /**
+         * @brief Stops delivering samples.
+         */
+        virtual void Stop() = 0;
+
+        /**
+         * @brief Closes the source and releases its resources.
+         */
+        virtual void Close() = 0;
+
+        /**
+         * @brief Checks if the source is open.
+         * @return True if open, false otherwise.
+         */
+        virtual bool IsOpen() const = 0;
+
+        /**
+         * @brief Checks if the source is delivering samples.
+         * @return True if running, false otherwise.
+         */
+        virtual bool IsRunning() const = 0;
+
+        /**
+         * @brief Retrieves a human-readable name of the source.
+         * @return Name string.
+         */
+        virtual const std::string &GetName() const = 0;
+
+        /**
+         * @brief Gets the rate the source delivers samples at, which may differ from the one requested in Open().
+         * @return Sample rate in Hz, 0 if not open.
+         */
+        virtual float GetSampleRate() const = 0;
+
+        /**
+         * @brief Connects the source to the ring buffer consumed by the analysis engine.
+         * @param ringBuffer Pointer to the destination ring buffer (may be nullptr to disconnect).
+         */
+        void SetRingBuffer(Util::LockFreeRingBuffer<float> *ringBuffer);
+
+        /**
+         * @brief Connects a second ring buffer that receives a copy of every block for display.
+         *
+         * The monitor copy is best effort: a block that does not fit is skipped there without
+         * affecting the analysis ring buffer or the dropped sample count.
+         * @param monitorBuffer Pointer to the monitor ring buffer (may be nullptr to disconnect).
+         */
+        void SetMonitorBuffer(Util::LockFreeRingBuffer<float> *monitorBuffer);
+
+        /**
+         * @brief Gets the number of samples dropped because the ring buffer was full.
+         * @return Total dropped samples since construction.
+         */
+        uint64_t GetDroppedSamples() const;
+
+    protected:
+        AudioSource();
+
+        AudioSource(const AudioSource &) = delete;
+
+        AudioSource(AudioSource &&) = delete;
+
+        AudioSource &operator=(const AudioSource &) = delete;
+
+        AudioSource &operator=(AudioSource &&) = delete;
+
+        /**
+         * @brief Pushes a block of samples into the connected ring buffer and the monitor buffer.
+         *
+         * Real-time safe: no locks, no allocations. Blocks that do not fit are dropped and counted.
+         *
+         * @param samples Samples to deliver.
+         * @return True if the block was written, false if it was dropped.
+         */
+        bool PushSamples(std::span<const float> samples) noexcept;
+
+        /**
+         * @brief Checks whether the ring buffer can currently accept a block.
+         * @param count Number of samples to write.
+         * @return True if there is enough free space.
+         */
+        bool HasSpaceFor(size_t count) const noexcept;
+
+    private:
+        Util::LockFreeRingBuffer<float> *ringBuffer;    ///< Destination ring buffer.
+        Util::LockFreeRingBuffer<float> *monitorBuffer; ///< Optional display copy of the stream.
+        std::atomic<uint64_t> droppedSamples;           ///< Samples lost due to ring buffer overflow.
+    };
+
+} // namespace GuitarDiagnostics::Audio
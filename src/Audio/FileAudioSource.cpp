@@ -0,0 +1,87 @@
+#include "Audio/FileAudioSource.h"
+
+#include "Audio/WavFile.h"
+
+#include <Logger.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    FileAudioSource::FileAudioSource(std::filesystem::path path, bool loop)
+        : PacedAudioSource(), filePath(std::move(path)), sourceName(filePath.filename().string()), samples(),
+          playPosition(0), loop(loop)
+    {
+    }
+
+    FileAudioSource::~FileAudioSource()
+    {
+        Close();
+    }
+
+    const std::string &FileAudioSource::GetName() const
+    {
+        return sourceName;
+    }
+
+    size_t FileAudioSource::GetTotalFrames() const
+    {
+        return samples.size();
+    }
+
+    bool FileAudioSource::OnOpen(float &sampleRate, [[maybe_unused]] uint32_t bufferSizeFrames)
+    {
+        auto wav = ReadWavFile(filePath);
+        if (!wav.has_value() || wav->samples.empty())
+        {
+            return false;
+        }
+
+        // Play at the recording's own rate; the analysis engine resamples if it differs.
+        if (std::abs(wav->sampleRate - sampleRate) > 0.5f)
+        {
+            LOG_INFO("{} is {} Hz, requested {} Hz", sourceName, wav->sampleRate, sampleRate);
+            sampleRate = wav->sampleRate;
+        }
+
+        samples = std::move(wav->samples);
+        playPosition = 0;
+        return true;
+    }
+
+    void FileAudioSource::OnClose()
+    {
+        samples.clear();
+        samples.shrink_to_fit();
+        playPosition = 0;
+    }
+
+    size_t FileAudioSource::RenderBlock(std::span<float> block)
+    {
+        size_t written = 0;
+
+        while (written < block.size())
+        {
+            if (playPosition >= samples.size())
+            {
+                if (!loop)
+                {
+                    break;
+                }
+                playPosition = 0;
+            }
+
+            const size_t count = std::min(block.size() - written, samples.size() - playPosition);
+            std::copy_n(samples.begin() + static_cast<std::ptrdiff_t>(playPosition),
+                count,
+                block.begin() + static_cast<std::ptrdiff_t>(written));
+            playPosition += count;
+            written += count;
+        }
+
+        return written;
+    }
+
+} // namespace GuitarDiagnostics::Audio
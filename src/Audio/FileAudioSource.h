@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Audio/PacedAudioSource.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Audio source that plays back a WAV recording.
+     *
+     * The file is decoded into memory on Open(); playback only copies from that buffer.
+     */
+    class FileAudioSource : public PacedAudioSource
+    {
+    public:
+        /**
+         * @brief Constructs the FileAudioSource.
+         * @param path Path to the WAV file to play.
+         * @param loop True to restart from the beginning at end of file.
+         */
+        explicit FileAudioSource(std::filesystem::path path, bool loop = false);
+
+        /**
+         * @brief Destructor. Stops playback and releases the decoded file.
+         */
+        ~FileAudioSource() override;
+
+        FileAudioSource(const FileAudioSource &) = delete;
+
+        FileAudioSource &operator=(const FileAudioSource &) = delete;
+
+        FileAudioSource(FileAudioSource &&) = delete;
+
+        FileAudioSource &operator=(FileAudioSource &&) = delete;
+
+        const std::string &GetName() const override;
+
+        /**
+         * @brief Gets the number of frames in the decoded file.
+         * @return Total frame count, 0 if not open.
+         */
+        size_t GetTotalFrames() const;
+
+    protected:
+        bool OnOpen(float &sampleRate, uint32_t bufferSizeFrames) override;
+
+        void OnClose() override;
+
+        size_t RenderBlock(std::span<float> block) override;
+
+    private:
+        std::filesystem::path filePath; ///< Path to the WAV file.
+        std::string sourceName;         ///< Display name.
+        std::vector<float> samples;     ///< Decoded mono samples.
+        size_t playPosition;            ///< Current playback position in frames.
+        bool loop;                      ///< Loop playback flag.
+    };
+
+} // namespace GuitarDiagnostics::Audio
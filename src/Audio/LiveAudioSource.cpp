@@ -0,0 +1,160 @@
+#include "Audio/LiveAudioSource.h"
+
+#include "Audio/AudioDeviceManager.h"
+#include "Util/AllocationGuard.h"
+#include "Util/Tracer.h"
+
+#include <AudioDevice.h>
+#include <Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    namespace
+    {
+        /**
+         * @brief Picks the stream rate: the requested one if the device lists it (or lists none),
+         * otherwise the lowest listed rate above it, otherwise the highest listed rate.
+         */
+        uint32_t ChooseSampleRate(std::vector<uint32_t> supportedRates, uint32_t requested)
+        {
+            if (supportedRates.empty()
+                || std::find(supportedRates.begin(), supportedRates.end(), requested) != supportedRates.end())
+            {
+                return requested;
+            }
+
+            std::sort(supportedRates.begin(), supportedRates.end());
+            const auto above = std::upper_bound(supportedRates.begin(), supportedRates.end(), requested);
+            return above != supportedRates.end() ? *above : supportedRates.back();
+        }
+    } // namespace
+
+    LiveAudioSource::LiveAudioSource()
+        : AudioSource(), audioDevice(nullptr), sourceName("Default Input Device"), deviceId(0), useDefaultDevice(true),
+          sampleRate(0.0f)
+    {
+    }
+
+    LiveAudioSource::LiveAudioSource(uint32_t deviceId)
+        : AudioSource(), audioDevice(nullptr), sourceName("Input Device " + std::to_string(deviceId)),
+          deviceId(deviceId), useDefaultDevice(false), sampleRate(0.0f)
+    {
+    }
+
+    LiveAudioSource::~LiveAudioSource()
+    {
+        Close();
+    }
+
+    bool LiveAudioSource::Open(float requestedRate, uint32_t bufferSizeFrames)
+    {
+        if (audioDevice && audioDevice->IsOpen())
+        {
+            return false;
+        }
+
+        audioDevice = std::make_unique<GuitarIO::RtAudioDevice>();
+
+        const AudioDeviceManager deviceManager;
+        const uint32_t device = useDefaultDevice ? deviceManager.GetDefaultInputDevice() : deviceId;
+        const auto requested = static_cast<uint32_t>(std::lround(requestedRate));
+
+        GuitarIO::AudioStreamConfig config;
+        config.sampleRate = ChooseSampleRate(deviceManager.GetDeviceInfo(device).supportedSampleRates, requested);
+        config.bufferSize = bufferSizeFrames;
+        config.inputChannels = 1;
+        config.outputChannels = 0;
+
+        GuitarIO::AudioCallback callback =
+            [](std::span<const float> inputBuffer, std::span<float> outputBuffer, void *userData) -> int {
+            return LiveAudioSource::AudioCallback(inputBuffer, outputBuffer, userData);
+        };
+
+        const bool opened = useDefaultDevice ? audioDevice->OpenDefault(config, callback, this)
+                                             : audioDevice->Open(deviceId, config, callback, this);
+        if (!opened)
+        {
+            return false;
+        }
+
+        if (config.sampleRate != requested)
+        {
+            LOG_INFO("{} does not support {} Hz, opened at {} Hz", sourceName, requested, config.sampleRate);
+        }
+        sampleRate = static_cast<float>(config.sampleRate);
+        return true;
+    }
+
+    bool LiveAudioSource::Start()
+    {
+        if (!audioDevice || !audioDevice->IsOpen())
+        {
+            return false;
+        }
+
+        return audioDevice->Start();
+    }
+
+    void LiveAudioSource::Stop()
+    {
+        if (audioDevice && audioDevice->IsRunning())
+        {
+            audioDevice->Stop();
+        }
+    }
+
+    void LiveAudioSource::Close()
+    {
+        Stop();
+
+        if (audioDevice && audioDevice->IsOpen())
+        {
+            audioDevice->Close();
+        }
+
+        audioDevice.reset();
+        sampleRate = 0.0f;
+    }
+
+    bool LiveAudioSource::IsOpen() const
+    {
+        return audioDevice && audioDevice->IsOpen();
+    }
+
+    bool LiveAudioSource::IsRunning() const
+    {
+        return audioDevice && audioDevice->IsRunning();
+    }
+
+    const std::string &LiveAudioSource::GetName() const
+    {
+        return sourceName;
+    }
+
+    float LiveAudioSource::GetSampleRate() const
+    {
+        return sampleRate;
+    }
+
+    int LiveAudioSource::AudioCallback(std::span<const float> inputBuffer,
+        [[maybe_unused]] std::span<float> outputBuffer,
+        void *userData)
+    {
+        GD_TRACE_THREAD_NAME("Audio Callback");
+        GD_TRACE_SCOPE("audio", "Callback");
+        GD_NO_ALLOCATION_SCOPE();
+
+        auto *source = static_cast<LiveAudioSource *>(userData);
+        if (source)
+        {
+            source->PushSamples(inputBuffer);
+        }
+        return 0;
+    }
+
+} // namespace GuitarDiagnostics::Audio
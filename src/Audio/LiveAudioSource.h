@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Audio/AudioSource.h"
+
+#include <RtAudioDevice.h>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Audio source backed by a hardware input device through RtAudio.
+     *
+     * Samples are pushed directly from the device callback thread. If the device does not support
+     * the requested rate, it is opened at the nearest rate it lists instead.
+     */
+    class LiveAudioSource : public AudioSource
+    {
+    public:
+        /**
+         * @brief Constructs a source bound to the system default input device.
+         */
+        LiveAudioSource();
+
+        /**
+         * @brief Constructs a source bound to a specific input device.
+         * @param deviceId ID of the audio device to use.
+         */
+        explicit LiveAudioSource(uint32_t deviceId);
+
+        /**
+         * @brief Destructor. Closes the device if open.
+         */
+        ~LiveAudioSource() override;
+
+        LiveAudioSource(const LiveAudioSource &) = delete;
+
+        LiveAudioSource &operator=(const LiveAudioSource &) = delete;
+
+        LiveAudioSource(LiveAudioSource &&) = delete;
+
+        LiveAudioSource &operator=(LiveAudioSource &&) = delete;
+
+        bool Open(float sampleRate, uint32_t bufferSizeFrames) override;
+
+        bool Start() override;
+
+        void Stop() override;
+
+        void Close() override;
+
+        bool IsOpen() const override;
+
+        bool IsRunning() const override;
+
+        const std::string &GetName() const override;
+
+        float GetSampleRate() const override;
+
+    private:
+        /**
+         * @brief Static audio callback function used by the audio device.
+         * @param inputBuffer Buffer containing input audio samples.
+         * @param outputBuffer Buffer for output audio samples (unused here).
+         * @param userData User data pointer (LiveAudioSource instance).
+         * @return 0 on success, non-zero on error.
+         */
+        static int AudioCallback(std::span<const float> inputBuffer, std::span<float> outputBuffer, void *userData);
+
+        std::unique_ptr<GuitarIO::RtAudioDevice> audioDevice; ///< Audio device instance.
+        std::string sourceName;                               ///< Display name.
+        uint32_t deviceId;                                    ///< Requested device ID.
+        bool useDefaultDevice;                                ///< True to open the system default device.
+        float sampleRate;                                     ///< Rate the device was opened at.
+    };
+
+} // namespace GuitarDiagnostics::Audio
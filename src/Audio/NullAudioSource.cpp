@@ -0,0 +1,70 @@
+#include "Audio/NullAudioSource.h"
+
+namespace GuitarDiagnostics::Audio
+{
+
+    NullAudioSource::NullAudioSource()
+        : AudioSource(), sourceName("No Input"), sampleRate(0.0f), open(false), running(false)
+    {
+    }
+
+    NullAudioSource::~NullAudioSource()
+    {
+    }
+
+    bool NullAudioSource::Open(float newSampleRate, [[maybe_unused]] uint32_t bufferSizeFrames)
+    {
+        if (open)
+        {
+            return false;
+        }
+
+        sampleRate = newSampleRate;
+        open = true;
+        return true;
+    }
+
+    bool NullAudioSource::Start()
+    {
+        if (!open)
+        {
+            return false;
+        }
+
+        running = true;
+        return true;
+    }
+
+    void NullAudioSource::Stop()
+    {
+        running = false;
+    }
+
+    void NullAudioSource::Close()
+    {
+        Stop();
+        sampleRate = 0.0f;
+        open = false;
+    }
+
+    bool NullAudioSource::IsOpen() const
+    {
+        return open;
+    }
+
+    bool NullAudioSource::IsRunning() const
+    {
+        return running;
+    }
+
+    const std::string &NullAudioSource::GetName() const
+    {
+        return sourceName;
+    }
+
+    float NullAudioSource::GetSampleRate() const
+    {
+        return sampleRate;
+    }
+
+} // namespace GuitarDiagnostics::Audio
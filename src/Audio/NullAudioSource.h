@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Audio/AudioSource.h"
+
+#include <cstdint>
+#include <string>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Audio source that never produces samples.
+     *
+     * Used as a fallback on machines without audio hardware (CI, servers) so the
+     * application and analysis engine can run without an input device.
+     */
+    class NullAudioSource : public AudioSource
+    {
+    public:
+        /**
+         * @brief Constructs the NullAudioSource.
+         */
+        NullAudioSource();
+
+        /**
+         * @brief Destructor.
+         */
+        ~NullAudioSource() override;
+
+        NullAudioSource(const NullAudioSource &) = delete;
+
+        NullAudioSource &operator=(const NullAudioSource &) = delete;
+
+        NullAudioSource(NullAudioSource &&) = delete;
+
+        NullAudioSource &operator=(NullAudioSource &&) = delete;
+
+        bool Open(float sampleRate, uint32_t bufferSizeFrames) override;
+
+        bool Start() override;
+
+        void Stop() override;
+
+        void Close() override;
+
+        bool IsOpen() const override;
+
+        bool IsRunning() const override;
+
+        const std::string &GetName() const override;
+
+        float GetSampleRate() const override;
+
+    private:
+        std::string sourceName; ///< Display name.
+        float sampleRate;       ///< Rate requested in Open().
+        bool open;              ///< Open state flag.
+        bool running;           ///< Running state flag.
+    };
+
+} // namespace GuitarDiagnostics::Audio
@@ -0,0 +1,159 @@
+#include "Audio/PacedAudioSource.h"
+
+#include "Util/AllocationGuard.h"
+#include "Util/Tracer.h"
+
+#include <chrono>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    PacedAudioSource::PacedAudioSource()
+        : AudioSource(), blockBuffer(), sampleRate(0.0f), bufferSize(0), open(false), running(false), finished(false),
+          realTimePacing(true), producerThread()
+    {
+    }
+
+    PacedAudioSource::~PacedAudioSource()
+    {
+        Stop();
+    }
+
+    bool PacedAudioSource::Open(float newSampleRate, uint32_t bufferSizeFrames)
+    {
+        if (open || newSampleRate <= 0.0f || bufferSizeFrames == 0)
+        {
+            return false;
+        }
+
+        float streamRate = newSampleRate;
+        if (!OnOpen(streamRate, bufferSizeFrames))
+        {
+            return false;
+        }
+
+        sampleRate = streamRate;
+        bufferSize = bufferSizeFrames;
+        blockBuffer.assign(bufferSizeFrames, 0.0f);
+        finished.store(false);
+        open = true;
+        return true;
+    }
+
+    bool PacedAudioSource::Start()
+    {
+        if (!open)
+        {
+            return false;
+        }
+
+        bool expected = false;
+        if (!running.compare_exchange_strong(expected, true))
+        {
+            return false;
+        }
+
+        if (producerThread.joinable())
+        {
+            producerThread.join();
+        }
+
+        finished.store(false);
+        producerThread = std::thread(&PacedAudioSource::ProducerThreadFunction, this);
+        return true;
+    }
+
+    void PacedAudioSource::Stop()
+    {
+        running.store(false);
+
+        if (producerThread.joinable())
+        {
+            producerThread.join();
+        }
+    }
+
+    void PacedAudioSource::Close()
+    {
+        Stop();
+
+        if (open)
+        {
+            OnClose();
+            blockBuffer.clear();
+            sampleRate = 0.0f;
+            open = false;
+        }
+    }
+
+    bool PacedAudioSource::IsOpen() const
+    {
+        return open;
+    }
+
+    bool PacedAudioSource::IsRunning() const
+    {
+        return running.load();
+    }
+
+    float PacedAudioSource::GetSampleRate() const
+    {
+        return sampleRate;
+    }
+
+    void PacedAudioSource::SetRealTimePacing(bool enabled)
+    {
+        realTimePacing.store(enabled);
+    }
+
+    bool PacedAudioSource::IsFinished() const
+    {
+        return finished.load();
+    }
+
+    void PacedAudioSource::ProducerThreadFunction()
+    {
+        GD_TRACE_THREAD_NAME("Audio Source");
+
+        using Clock = std::chrono::steady_clock;
+
+        const auto blockDuration = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(bufferSize) / static_cast<double>(sampleRate)));
+        auto nextDeadline = Clock::now();
+
+        std::span<float> block(blockBuffer.data(), blockBuffer.size());
+
+        while (running.load())
+        {
+            const bool paced = realTimePacing.load(std::memory_order_relaxed);
+
+            if (!paced && !HasSpaceFor(block.size()))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            {
+                GD_TRACE_SCOPE("audio", "Block");
+                GD_NO_ALLOCATION_SCOPE();
+
+                const size_t frames = RenderBlock(block);
+                if (frames == 0)
+                {
+                    finished.store(true);
+                    running.store(false);
+                    break;
+                }
+
+                PushSamples(block.first(frames));
+            }
+
+            if (paced)
+            {
+                nextDeadline += blockDuration;
+                std::this_thread::sleep_until(nextDeadline);
+            }
+        }
+    }
+
+} // namespace GuitarDiagnostics::Audio
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Audio/AudioSource.h"
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Base class for software sources driven by their own producer thread.
+     *
+     * The producer thread renders fixed-size blocks into a preallocated buffer and pushes them
+     * through AudioSource::PushSamples(), emulating a device callback. With real-time pacing the
+     * blocks are released at the nominal device cadence; without it the source runs as fast as the
+     * ring buffer drains (useful for batch processing and throughput benchmarks).
+     */
+    class PacedAudioSource : public AudioSource
+    {
+    public:
+        /**
+         * @brief Destructor. Stops the producer thread if running.
+         */
+        ~PacedAudioSource() override;
+
+        PacedAudioSource(const PacedAudioSource &) = delete;
+
+        PacedAudioSource &operator=(const PacedAudioSource &) = delete;
+
+        PacedAudioSource(PacedAudioSource &&) = delete;
+
+        PacedAudioSource &operator=(PacedAudioSource &&) = delete;
+
+        bool Open(float sampleRate, uint32_t bufferSizeFrames) override;
+
+        bool Start() override;
+
+        void Stop() override;
+
+        void Close() override;
+
+        bool IsOpen() const override;
+
+        bool IsRunning() const override;
+
+        float GetSampleRate() const override;
+
+        /**
+         * @brief Enables or disables real-time pacing of produced blocks.
+         * @param enabled True to emulate device timing, false to run as fast as possible.
+         */
+        void SetRealTimePacing(bool enabled);
+
+        /**
+         * @brief Checks if the source has reached the end of its material.
+         * @return True once RenderBlock() has reported end of stream.
+         */
+        bool IsFinished() const;
+
+    protected:
+        PacedAudioSource();
+
+        /**
+         * @brief Prepares source-specific state. Called from Open().
+         * @param sampleRate Requested sample rate in Hz; a source whose material has a fixed rate replaces it.
+         * @param bufferSizeFrames Requested block size in frames.
+         * @return True if the source can produce audio with these parameters.
+         */
+        virtual bool OnOpen(float &sampleRate, uint32_t bufferSizeFrames) = 0;
+
+        /**
+         * @brief Releases source-specific state. Called from Close().
+         */
+        virtual void OnClose() = 0;
+
+        /**
+         * @brief Renders the next block of samples. Called on the producer thread; must not allocate.
+         * @param block Destination buffer of exactly one block.
+         * @return Number of frames written, 0 to signal end of stream.
+         */
+        virtual size_t RenderBlock(std::span<float> block) = 0;
+
+    private:
+        /**
+         * @brief Main loop for the producer thread.
+         */
+        void ProducerThreadFunction();
+
+        std::vector<float> blockBuffer;   ///< Preallocated block storage.
+        float sampleRate;                 ///< Stream sample rate in Hz.
+        uint32_t bufferSize;              ///< Block size in frames.
+        bool open;                        ///< Open state flag.
+        std::atomic<bool> running;        ///< Producer thread run flag.
+        std::atomic<bool> finished;       ///< End-of-stream flag.
+        std::atomic<bool> realTimePacing; ///< Emulate device timing when true.
+        std::thread producerThread;       ///< Producer thread instance.
+    };
+
+} // namespace GuitarDiagnostics::Audio
@@ -0,0 +1,73 @@
+#include "Audio/SyntheticAudioSource.h"
+
+#include "Util/SignalGenerator.h"
+
+#include <cmath>
+#include <numbers>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    SyntheticToneConfig::SyntheticToneConfig() : fundamental(110.0f), numHarmonics(5), amplitude(0.5f), noiseLevel(0.0f)
+    {
+    }
+
+    SyntheticAudioSource::SyntheticAudioSource(const SyntheticToneConfig &toneConfig)
+        : PacedAudioSource(), toneConfig(toneConfig), sourceName("Synthetic Tone"), generator()
+    {
+    }
+
+    SyntheticAudioSource::~SyntheticAudioSource()
+    {
+        Close();
+    }
+
+    const std::string &SyntheticAudioSource::GetName() const
+    {
+        return sourceName;
+    }
+
+    bool SyntheticAudioSource::OnOpen(float &newSampleRate, [[maybe_unused]] uint32_t bufferSizeFrames)
+    {
+        if (toneConfig.fundamental <= 0.0f || toneConfig.numHarmonics == 0)
+        {
+            return false;
+        }
+
+        Util::StringModelConfig string;
+        string.fundamental = toneConfig.fundamental;
+        string.inharmonicity = 0.0f;
+        string.numPartials = toneConfig.numHarmonics;
+        string.decayRate = 0.0f;
+        string.decayPerPartial = 0.0f;
+
+        // Scale the fundamental so the partials, shaped by the pluck position, peak at the configured amplitude.
+        const float pi = std::numbers::pi_v<float>;
+        float partialSum = 0.0f;
+        for (uint32_t n = 1; n <= toneConfig.numHarmonics; ++n)
+        {
+            const float harmonic = static_cast<float>(n);
+            partialSum += std::abs(std::sin(harmonic * pi * string.pluckPosition))
+                / (std::sin(pi * string.pluckPosition) * harmonic);
+        }
+        string.amplitude = toneConfig.amplitude / partialSum;
+
+        generator = std::make_unique<Util::SignalGenerator>(newSampleRate, 1, toneConfig.numHarmonics);
+        generator->SetString(0, string);
+        generator->SetNoiseLevel(0, toneConfig.noiseLevel);
+
+        return true;
+    }
+
+    void SyntheticAudioSource::OnClose()
+    {
+        generator.reset();
+    }
+
+    size_t SyntheticAudioSource::RenderBlock(std::span<float> block)
+    {
+        generator->Render(block);
+        return block.size();
+    }
+
+} // namespace GuitarDiagnostics::Audio
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Audio/PacedAudioSource.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace GuitarDiagnostics::Util
+{
+    class SignalGenerator;
+}
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Parameters of the tone rendered by SyntheticAudioSource.
+     */
+    struct SyntheticToneConfig
+    {
+        float fundamental;     ///< Fundamental frequency in Hz.
+        uint32_t numHarmonics; ///< Number of harmonic partials.
+        float amplitude;       ///< Peak amplitude of the harmonic part.
+        float noiseLevel;      ///< Amplitude of additive white noise.
+
+        /**
+         * @brief Constructs a SyntheticToneConfig for an A2 (110 Hz) note with five harmonics.
+         */
+        SyntheticToneConfig();
+    };
+
+    /**
+     * @brief Audio source that renders a synthetic harmonic tone with optional noise.
+     *
+     * The tone is a non-decaying, perfectly harmonic string rendered by Util::SignalGenerator.
+     * Allows running and load-testing the full pipeline without audio hardware.
+     */
+    class SyntheticAudioSource : public PacedAudioSource
+    {
+    public:
+        /**
+         * @brief Constructs the SyntheticAudioSource.
+         * @param toneConfig Tone parameters.
+         */
+        explicit SyntheticAudioSource(const SyntheticToneConfig &toneConfig);
+
+        /**
+         * @brief Destructor. Stops rendering.
+         */
+        ~SyntheticAudioSource() override;
+
+        SyntheticAudioSource(const SyntheticAudioSource &) = delete;
+
+        SyntheticAudioSource &operator=(const SyntheticAudioSource &) = delete;
+
+        SyntheticAudioSource(SyntheticAudioSource &&) = delete;
+
+        SyntheticAudioSource &operator=(SyntheticAudioSource &&) = delete;
+
+        const std::string &GetName() const override;
+
+    protected:
+        bool OnOpen(float &sampleRate, uint32_t bufferSizeFrames) override;
+
+        void OnClose() override;
+
+        size_t RenderBlock(std::span<float> block) override;
+
+    private:
+        SyntheticToneConfig toneConfig;                   ///< Tone parameters.
+        std::string sourceName;                           ///< Display name.
+        std::unique_ptr<Util::SignalGenerator> generator; ///< Tone renderer, created on open.
+    };
+
+} // namespace GuitarDiagnostics::Audio
@@ -0,0 +1,203 @@
+#include "Audio/WavFile.h"
+
+#include <Logger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    namespace
+    {
+        constexpr uint16_t g_kFormatPcm = 1;
+        constexpr uint16_t g_kFormatFloat = 3;
+        constexpr uint16_t g_kFormatExtensible = 0xFFFE;
+
+        uint16_t ReadU16(const uint8_t *data)
+        {
+            return static_cast<uint16_t>(data[0] | (data[1] << 8));
+        }
+
+        uint32_t ReadU32(const uint8_t *data)
+        {
+            return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+                   | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+        }
+
+        void WriteU16(std::ofstream &stream, uint16_t value)
+        {
+            const char bytes[2] = { static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF) };
+            stream.write(bytes, 2);
+        }
+
+        void WriteU32(std::ofstream &stream, uint32_t value)
+        {
+            const char bytes[4] = { static_cast<char>(value & 0xFF),
+                static_cast<char>((value >> 8) & 0xFF),
+                static_cast<char>((value >> 16) & 0xFF),
+                static_cast<char>((value >> 24) & 0xFF) };
+            stream.write(bytes, 4);
+        }
+
+        float DecodeSample(const uint8_t *data, uint16_t format, uint16_t bitsPerSample)
+        {
+            if (format == g_kFormatFloat && bitsPerSample == 32)
+            {
+                float value = 0.0f;
+                uint32_t bits = ReadU32(data);
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            switch (bitsPerSample)
+            {
+            case 16:
+                return static_cast<float>(static_cast<int16_t>(ReadU16(data))) / 32768.0f;
+            case 24: {
+                int32_t value = static_cast<int32_t>(data[0] | (data[1] << 8) | (data[2] << 16));
+                if ((value & 0x800000) != 0)
+                {
+                    value -= 0x1000000;
+                }
+                return static_cast<float>(value) / 8388608.0f;
+            }
+            case 32:
+                return static_cast<float>(static_cast<int32_t>(ReadU32(data))) / 2147483648.0f;
+            default:
+                return 0.0f;
+            }
+        }
+    } // namespace
+
+    WavData::WavData() : sampleRate(0.0f), channels(0), samples()
+    {
+    }
+
+    std::optional<WavData> ReadWavFile(const std::filesystem::path &path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            LOG_ERROR("Cannot open WAV file: {}", path.string());
+            return std::nullopt;
+        }
+
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0
+            || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0)
+        {
+            LOG_ERROR("Not a RIFF/WAVE file: {}", path.string());
+            return std::nullopt;
+        }
+
+        uint16_t format = 0;
+        uint16_t channels = 0;
+        uint32_t sampleRate = 0;
+        uint16_t bitsPerSample = 0;
+        const uint8_t *pcmData = nullptr;
+        size_t pcmSize = 0;
+
+        size_t offset = 12;
+        while (offset + 8 <= bytes.size())
+        {
+            const uint8_t *chunk = bytes.data() + offset;
+            const size_t chunkSize = ReadU32(chunk + 4);
+            const size_t bodyOffset = offset + 8;
+            const size_t bodySize = std::min(chunkSize, bytes.size() - bodyOffset);
+
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && bodySize >= 16)
+            {
+                format = ReadU16(chunk + 8);
+                channels = ReadU16(chunk + 10);
+                sampleRate = ReadU32(chunk + 12);
+                bitsPerSample = ReadU16(chunk + 22);
+
+                if (format == g_kFormatExtensible && bodySize >= 26)
+                {
+                    format = ReadU16(chunk + 32);
+                }
+            }
+            else if (std::memcmp(chunk, "data", 4) == 0)
+            {
+                pcmData = bytes.data() + bodyOffset;
+                pcmSize = bodySize;
+            }
+
+            offset = bodyOffset + chunkSize + (chunkSize & 1);
+        }
+
+        const bool supportedFormat = (format == g_kFormatPcm && (bitsPerSample == 16 || bitsPerSample == 24
+                                                                    || bitsPerSample == 32))
+                                     || (format == g_kFormatFloat && bitsPerSample == 32);
+
+        if (!pcmData || channels == 0 || sampleRate == 0 || !supportedFormat)
+        {
+            LOG_ERROR("Unsupported WAV format in {} (format {}, {} bits)", path.string(), format, bitsPerSample);
+            return std::nullopt;
+        }
+
+        const size_t bytesPerSample = bitsPerSample / 8;
+        const size_t frameSize = bytesPerSample * channels;
+        const size_t numFrames = pcmSize / frameSize;
+
+        WavData wav;
+        wav.sampleRate = static_cast<float>(sampleRate);
+        wav.channels = channels;
+        wav.samples.resize(numFrames);
+
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            const uint8_t *frameData = pcmData + frame * frameSize;
+            float sum = 0.0f;
+            for (size_t channel = 0; channel < channels; ++channel)
+            {
+                sum += DecodeSample(frameData + channel * bytesPerSample, format, bitsPerSample);
+            }
+            wav.samples[frame] = sum / static_cast<float>(channels);
+        }
+
+        return wav;
+    }
+
+    bool WriteWavFile(const std::filesystem::path &path, std::span<const float> samples, float sampleRate)
+    {
+        std::ofstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            LOG_ERROR("Cannot create WAV file: {}", path.string());
+            return false;
+        }
+
+        const uint32_t dataSize = static_cast<uint32_t>(samples.size() * sizeof(float));
+        const uint32_t rate = static_cast<uint32_t>(sampleRate);
+
+        stream.write("RIFF", 4);
+        WriteU32(stream, 36 + dataSize);
+        stream.write("WAVE", 4);
+
+        stream.write("fmt ", 4);
+        WriteU32(stream, 16);
+        WriteU16(stream, g_kFormatFloat);
+        WriteU16(stream, 1);
+        WriteU32(stream, rate);
+        WriteU32(stream, rate * static_cast<uint32_t>(sizeof(float)));
+        WriteU16(stream, static_cast<uint16_t>(sizeof(float)));
+        WriteU16(stream, 32);
+
+        stream.write("data", 4);
+        WriteU32(stream, dataSize);
+        for (float sample : samples)
+        {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &sample, sizeof(bits));
+            WriteU32(stream, bits);
+        }
+
+        return static_cast<bool>(stream);
+    }
+
+} // namespace GuitarDiagnostics::Audio
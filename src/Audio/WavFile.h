@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace GuitarDiagnostics::Audio
+{
+
+    /**
+     * @brief Decoded contents of a WAV file.
+     */
+    struct WavData
+    {
+        float sampleRate;           ///< Sample rate in Hz.
+        uint32_t channels;          ///< Channel count of the original file.
+        std::vector<float> samples; ///< Mono samples in [-1, 1] (multi-channel files are downmixed).
+
+        /**
+         * @brief Constructs an empty WavData.
+         */
+        WavData();
+    };
+
+    /**
+     * @brief Reads a RIFF/WAVE file into memory.
+     *
+     * Supports 16/24/32-bit integer PCM and 32-bit IEEE float. Multi-channel audio is
+     * averaged down to mono.
+     *
+     * @param path Path to the WAV file.
+     * @return Decoded data, or std::nullopt if the file is missing or unsupported.
+     */
+    std::optional<WavData> ReadWavFile(const std::filesystem::path &path);
+
+    /**
+     * @brief Writes mono samples as a 32-bit float WAV file.
+     * @param path Destination path.
+     * @param samples Samples to write.
+     * @param sampleRate Sample rate in Hz.
+     * @return True if the file was written successfully, false otherwise.
+     */
+    bool WriteWavFile(const std::filesystem::path &path, std::span<const float> samples, float sampleRate);
+
+} // namespace GuitarDiagnostics::Audio
@@ -3,12 +3,74 @@
  * @brief Main entry point for the Guitar Diagnostic Analyzer application.
  */
 
+#include "Analysis/Kernels/KernelRegistry.h"
 #include "App/Application.h"
 
 #include <Logger.h>
 
+#include <cstdint>
 #include <exception>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr const char *g_kUsage =
+        "usage: GuitarDiagnostics [--station DEVICE_ID]... [--kernels baseline|avx2|avx512]";
+
+    /**
+     * @brief Parses the command line.
+     *
+     * "--station ID" adds a station for a device, once per station; "--kernels NAME" forces a DSP
+     * kernel variant instead of the one detected for this CPU.
+     * @param argc Argument count.
+     * @param argv Argument values.
+     * @param stationDevices Receives the device IDs in command line order.
+     * @param kernelVariant Receives the forced kernel variant, if any.
+     * @return True if all arguments were understood, false otherwise.
+     */
+    bool ParseArguments(int argc,
+        char **argv,
+        std::vector<uint32_t> &stationDevices,
+        std::optional<GuitarDiagnostics::Analysis::KernelVariant> &kernelVariant)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            if ((arg != "--station" && arg != "--kernels") || i + 1 >= argc)
+            {
+                LOG_ERROR("Unknown argument {}; {}", arg, g_kUsage);
+                return false;
+            }
+
+            if (arg == "--kernels")
+            {
+                kernelVariant = GuitarDiagnostics::Analysis::KernelRegistry::ParseVariant(argv[++i]);
+                if (!kernelVariant)
+                {
+                    LOG_ERROR("Unknown kernel variant {}; {}", argv[i], g_kUsage);
+                    return false;
+                }
+                continue;
+            }
+
+            try
+            {
+                stationDevices.push_back(static_cast<uint32_t>(std::stoul(argv[++i])));
+            }
+            catch (const std::exception &)
+            {
+                LOG_ERROR("Invalid device ID {}", argv[i]);
+                return false;
+            }
+        }
+
+        return true;
+    }
+} // namespace
 
 /**
  * @brief Application entry point.
@@ -16,14 +78,30 @@
  * @param argv Argument values.
  * @return Exit code.
  */
-int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
+int main(int argc, char **argv)
 {
     Kappa::Logger::SetLoggerName("GuitarDiagnostics");
     LOG_INFO("Guitar Diagnostic Analyzer - Starting...");
 
+    using GuitarDiagnostics::Analysis::KernelRegistry;
+
+    std::vector<uint32_t> stationDevices;
+    std::optional<GuitarDiagnostics::Analysis::KernelVariant> kernelVariant;
+    if (!ParseArguments(argc, argv, stationDevices, kernelVariant))
+    {
+        return 1;
+    }
+
+    if (kernelVariant && !KernelRegistry::ForceVariant(*kernelVariant))
+    {
+        LOG_ERROR("Kernel variant {} is not supported on this CPU", KernelRegistry::GetVariantName(*kernelVariant));
+        return 1;
+    }
+    LOG_INFO("DSP kernels: {}", KernelRegistry::GetVariantName(KernelRegistry::GetActiveVariant()));
+
     try
     {
-        auto app = std::make_unique<GuitarDiagnostics::App::Application>();
+        auto app = std::make_unique<GuitarDiagnostics::App::Application>(stationDevices);
         app->Run();
     }
     catch (const std::exception &e)
@@ -6,15 +6,18 @@
 
 #include <algorithm>
 #include <cmath>
-#include <span>
+#include <cstdint>
 
 namespace GuitarDiagnostics::UI
 {
 
-    AudioMonitorPanel::AudioMonitorPanel(Util::LockFreeRingBuffer<float> *ringBuffer)
-        : ringBuffer(ringBuffer), panelName("Audio Monitor"), isActive(false), waveformBuffer(), currentRMS(0.0f)
+    AudioMonitorPanel::AudioMonitorPanel(Util::LockFreeRingBuffer<float> *ringBuffer, float sampleRate)
+        : ringBuffer(ringBuffer), panelName("Audio Monitor"), isActive(false), sampleRate(sampleRate),
+          readBuffer(g_kReadBlockSize, 0.0f),
+          envelope(g_kEnvelopeBinSize, g_kEnvelopeFanout, g_kEnvelopeLevels, g_kEnvelopeBins),
+          columnMinimums(g_kMaxColumns, 0.0f), columnMaximums(g_kMaxColumns, 0.0f), spanSeconds(5.0f),
+          currentRMS(0.0f)
     {
-        waveformBuffer.reserve(g_kWaveformSize);
     }
 
     AudioMonitorPanel::~AudioMonitorPanel()
@@ -31,16 +34,22 @@ namespace GuitarDiagnostics::UI
 
     void AudioMonitorPanel::OnUpdate([[maybe_unused]] float deltaTime)
     {
-        size_t available = ringBuffer->GetAvailableRead();
-
-        if (available >= g_kWaveformSize)
+        // Drain every frame, visible or not, so the history has no gaps and the ring never fills.
+        while (true)
         {
-            waveformBuffer.resize(g_kWaveformSize);
-            size_t samplesRead = ringBuffer->Read(std::span<float>(waveformBuffer.data(), g_kWaveformSize));
+            const size_t samplesRead = ringBuffer->Read(std::span<float>(readBuffer.data(), readBuffer.size()));
+            if (samplesRead == 0)
+            {
+                break;
+            }
 
-            if (samplesRead == g_kWaveformSize)
+            const std::span<const float> block(readBuffer.data(), samplesRead);
+            envelope.Push(block);
+            currentRMS = CalculateRMS(block.last(std::min(samplesRead, g_kRmsWindowSize)));
+
+            if (samplesRead < readBuffer.size())
             {
-                currentRMS = CalculateRMS(waveformBuffer);
+                break;
             }
         }
     }
@@ -50,21 +59,20 @@ namespace GuitarDiagnostics::UI
         ImGui::Text("Audio Input Monitor");
         ImGui::Separator();
 
-        if (waveformBuffer.empty())
+        if (envelope.GetSampleCount() == 0)
         {
             ImGui::Text("Waiting for audio data...");
             return;
         }
 
-        ImGui::Text("Waveform:");
-        ImGui::PlotLines("##waveform",
-            waveformBuffer.data(),
-            static_cast<int>(waveformBuffer.size()),
-            0,
-            nullptr,
-            -1.0f,
-            1.0f,
-            ImVec2(ImGui::GetContentRegionAvail().x, 200.0f));
+        ImGui::SliderFloat("Time span",
+            &spanSeconds,
+            g_kMinSpanSeconds,
+            g_kMaxSpanSeconds,
+            "%.3f s",
+            ImGuiSliderFlags_Logarithmic);
+
+        RenderEnvelope();
 
         ImGui::Separator();
 
@@ -77,6 +85,47 @@ namespace GuitarDiagnostics::UI
         ImGui::Text("Level: %.2f dB", dbLevel);
     }
 
+    void AudioMonitorPanel::RenderEnvelope()
+    {
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const ImVec2 size(std::max(ImGui::GetContentRegionAvail().x, 1.0f), g_kPlotHeight);
+        ImGui::Dummy(size);
+
+        const float wheel = ImGui::GetIO().MouseWheel;
+        if (ImGui::IsItemHovered() && wheel != 0.0f)
+        {
+            spanSeconds = std::clamp(spanSeconds * std::pow(0.8f, wheel), g_kMinSpanSeconds, g_kMaxSpanSeconds);
+        }
+
+        const size_t columns = std::min(static_cast<size_t>(size.x), g_kMaxColumns);
+        const auto spanSamples = static_cast<uint64_t>(static_cast<double>(spanSeconds) * sampleRate);
+        envelope.GetEnvelope(spanSamples,
+            std::span<float>(columnMinimums.data(), columns),
+            std::span<float>(columnMaximums.data(), columns));
+
+        ImDrawList *drawList = ImGui::GetWindowDrawList();
+        const float centre = origin.y + size.y * 0.5f;
+        const float halfHeight = size.y * 0.5f;
+
+        drawList->AddRectFilled(origin, ImVec2(origin.x + size.x, origin.y + size.y), IM_COL32(20, 20, 20, 255));
+        drawList->AddLine(ImVec2(origin.x, centre), ImVec2(origin.x + size.x, centre), IM_COL32(80, 80, 80, 255));
+
+        for (size_t column = 0; column < columns; ++column)
+        {
+            const float x = origin.x + static_cast<float>(column) + 0.5f;
+            const float top = centre - std::clamp(columnMaximums[column], -1.0f, 1.0f) * halfHeight;
+            const float bottom = centre - std::clamp(columnMinimums[column], -1.0f, 1.0f) * halfHeight;
+            drawList->AddLine(ImVec2(x, top), ImVec2(x, std::max(bottom, top + 1.0f)), IM_COL32(0, 200, 255, 255));
+        }
+
+        const size_t level = envelope.SelectLevel(spanSamples, columns);
+        ImGui::Text("Span: %.3f s, %llu samples per bin (level %zu of %zu)",
+            spanSeconds,
+            static_cast<unsigned long long>(envelope.GetBinSize(level)),
+            level + 1,
+            envelope.GetLevelCount());
+    }
+
     const std::string &AudioMonitorPanel::GetName() const
     {
         return panelName;
@@ -92,7 +141,7 @@ namespace GuitarDiagnostics::UI
         isActive = active;
     }
 
-    float AudioMonitorPanel::CalculateRMS(const std::vector<float> &buffer)
+    float AudioMonitorPanel::CalculateRMS(std::span<const float> buffer)
     {
         if (buffer.empty())
         {
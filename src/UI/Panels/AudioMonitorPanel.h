@@ -1,7 +1,9 @@
 #pragma once
 
 #include "UI/Panel.h"
+#include "Util/MinMaxPyramid.h"
 
+#include <span>
 #include <string>
 #include <vector>
 
@@ -16,16 +18,20 @@ namespace GuitarDiagnostics::UI
     /**
      * @brief Panel for monitoring raw audio input.
      *
-     * Displays a real-time waveform and RMS level of the input signal.
+     * Displays the waveform envelope and RMS level of the input signal. Samples from the monitor
+     * ring buffer feed a min/max pyramid, so spans from milliseconds to minutes are drawn at
+     * screen resolution with a fixed cost per frame; the span is zoomed with a slider or the
+     * mouse wheel over the plot.
      */
     class AudioMonitorPanel : public Panel
     {
     public:
         /**
          * @brief Constructs the AudioMonitorPanel.
-         * @param ringBuffer Pointer to the audio ring buffer.
+         * @param ringBuffer Pointer to the monitor ring buffer; the panel is its only reader.
+         * @param sampleRate Sample rate of the stream in Hz.
          */
-        explicit AudioMonitorPanel(Util::LockFreeRingBuffer<float> *ringBuffer);
+        AudioMonitorPanel(Util::LockFreeRingBuffer<float> *ringBuffer, float sampleRate);
 
         /**
          * @brief Destructor.
@@ -56,19 +62,38 @@ namespace GuitarDiagnostics::UI
 
     private:
         /**
-         * @brief Calculates RMS value of the current buffer.
-         * @param buffer Input audio buffer.
+         * @brief Calculates RMS value of a block.
+         * @param buffer Input audio samples.
          * @return Root Mean Square value.
          */
-        float CalculateRMS(const std::vector<float> &buffer);
+        float CalculateRMS(std::span<const float> buffer);
 
-        Util::LockFreeRingBuffer<float> *ringBuffer; ///< Pointer to the audio ring buffer.
+        /**
+         * @brief Draws the envelope of the selected span into the available width.
+         */
+        void RenderEnvelope();
+
+        Util::LockFreeRingBuffer<float> *ringBuffer; ///< Pointer to the monitor ring buffer.
         std::string panelName;                       ///< Display name of the panel.
         bool isActive;                               ///< Active state flag.
-        std::vector<float> waveformBuffer;           ///< Buffer for visualization data.
+        float sampleRate;                            ///< Stream sample rate in Hz.
+        std::vector<float> readBuffer;               ///< Scratch block drained from the ring buffer.
+        Util::MinMaxPyramid envelope;                ///< Min/max history of the stream.
+        std::vector<float> columnMinimums;           ///< Per-column minimums of the drawn span.
+        std::vector<float> columnMaximums;           ///< Per-column maximums of the drawn span.
+        float spanSeconds;                           ///< Displayed time span.
         float currentRMS;                            ///< Current RMS value.
 
-        static constexpr size_t g_kWaveformSize = 512; ///< Size of the waveform display buffer.
+        static constexpr size_t g_kReadBlockSize = 4096;   ///< Samples drained per ring buffer read.
+        static constexpr size_t g_kRmsWindowSize = 512;    ///< Most recent samples used for the RMS level.
+        static constexpr size_t g_kEnvelopeBinSize = 4;    ///< Samples per finest envelope bin.
+        static constexpr size_t g_kEnvelopeFanout = 4;     ///< Bins merged per coarser envelope level.
+        static constexpr size_t g_kEnvelopeLevels = 8;     ///< Envelope levels (4 samples to 64 Ki samples per bin).
+        static constexpr size_t g_kEnvelopeBins = 4096;    ///< Bins kept per envelope level.
+        static constexpr size_t g_kMaxColumns = 4096;      ///< Widest plot drawn, in pixels.
+        static constexpr float g_kMinSpanSeconds = 0.005f; ///< Shortest selectable span.
+        static constexpr float g_kMaxSpanSeconds = 600.0f; ///< Longest selectable span.
+        static constexpr float g_kPlotHeight = 200.0f;     ///< Plot height in pixels.
     };
 
 } // namespace GuitarDiagnostics::UI
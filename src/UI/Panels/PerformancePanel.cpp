@@ -0,0 +1,249 @@
+#include "UI/Panels/PerformancePanel.h"
+
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/EngineMetrics.h"
+#include "UI/RedrawThrottle.h"
+#include "Util/Tracer.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+
+namespace GuitarDiagnostics::UI
+{
+
+    namespace
+    {
+        constexpr const char *g_kTraceFileName = "guitar-diagnostics-trace.json"; ///< Trace export path.
+
+        double ToMicros(uint64_t nanoseconds)
+        {
+            return static_cast<double>(nanoseconds) / 1000.0;
+        }
+
+        float ToBudgetRatio(uint64_t nanoseconds, uint64_t budget)
+        {
+            return budget > 0 ? static_cast<float>(static_cast<double>(nanoseconds) / static_cast<double>(budget))
+                              : 0.0f;
+        }
+    } // namespace
+
+    PerformancePanel::PerformancePanel(Analysis::AnalysisEngine *engine, RedrawThrottle *redrawThrottle)
+        : analysisEngine(engine), redrawThrottle(redrawThrottle), panelName("Performance"), traceStatus(),
+          isActive(false)
+    {
+    }
+
+    PerformancePanel::~PerformancePanel()
+    {
+    }
+
+    void PerformancePanel::OnAttach()
+    {
+    }
+
+    void PerformancePanel::OnDetach()
+    {
+    }
+
+    void PerformancePanel::OnUpdate([[maybe_unused]] float deltaTime)
+    {
+    }
+
+    void PerformancePanel::OnImGuiRender()
+    {
+        const auto &metrics = analysisEngine->GetMetrics();
+        const auto &hops = metrics.GetHopHistogram();
+        const uint64_t budget = metrics.GetHopBudget();
+        const uint64_t hopCount = hops.GetCount();
+
+        ImGui::Text("Analysis Engine Performance");
+        ImGui::Separator();
+
+        RenderTraceControls();
+        RenderRedrawControls();
+
+        if (hopCount == 0)
+        {
+            ImGui::Text("Waiting for audio data...");
+            return;
+        }
+
+        ImGui::Text("Hop budget: %.3f ms", ToMicros(budget) / 1000.0);
+        ImGui::Text("Hops processed: %llu", static_cast<unsigned long long>(hopCount));
+
+        const uint64_t misses = metrics.GetDeadlineMisses();
+        const double missRate = 100.0 * static_cast<double>(misses) / static_cast<double>(hopCount);
+        const ImVec4 missColor = misses > 0 ? ImVec4(1.0f, 0.3f, 0.3f, 1.0f) : ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
+        ImGui::TextColored(missColor,
+            "Deadline misses: %llu (%.3f%%)",
+            static_cast<unsigned long long>(misses),
+            missRate);
+
+        ImGui::Spacing();
+        ImGui::Text("CPU budget usage (p50 / p99 / max): %.1f%% / %.1f%% / %.1f%%",
+            100.0f * ToBudgetRatio(hops.GetPercentile(50.0), budget),
+            100.0f * ToBudgetRatio(hops.GetPercentile(99.0), budget),
+            100.0f * ToBudgetRatio(hops.GetMax(), budget));
+
+        const float p99Usage = ToBudgetRatio(hops.GetPercentile(99.0), budget);
+        ImVec4 usageColor;
+        if (p99Usage < 0.5f)
+        {
+            usageColor = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
+        }
+        else if (p99Usage < 0.9f)
+        {
+            usageColor = ImVec4(1.0f, 1.0f, 0.0f, 1.0f);
+        }
+        else
+        {
+            usageColor = ImVec4(1.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        ImGui::PushStyleColor(ImGuiCol_PlotHistogram, usageColor);
+        ImGui::ProgressBar(std::min(p99Usage, 1.0f), ImVec2(-1, 0), "p99 hop time / budget");
+        ImGui::PopStyleColor();
+
+        ImGui::Spacing();
+        const size_t capacity = metrics.GetRingCapacity();
+        const size_t fill = metrics.GetRingFill();
+        ImGui::Text("Ring buffer fill: %zu / %zu samples (peak %zu)", fill, capacity, metrics.GetPeakRingFill());
+        ImGui::ProgressBar(capacity > 0 ? static_cast<float>(fill) / static_cast<float>(capacity) : 0.0f,
+            ImVec2(-1, 0));
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Text("Per-analyzer ProcessBuffer() time:");
+
+        size_t heaviest = 0;
+        for (size_t i = 1; i < metrics.GetAnalyzerCount(); ++i)
+        {
+            if (metrics.GetAnalyzerHistogram(i).GetPercentile(99.0)
+                > metrics.GetAnalyzerHistogram(heaviest).GetPercentile(99.0))
+            {
+                heaviest = i;
+            }
+        }
+
+        if (ImGui::BeginTable("AnalyzerTimings", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Analyzer");
+            ImGui::TableSetupColumn("p50 (us)");
+            ImGui::TableSetupColumn("p99 (us)");
+            ImGui::TableSetupColumn("p99.9 (us)");
+            ImGui::TableSetupColumn("max (us)");
+            ImGui::TableSetupColumn("p99 budget share");
+            ImGui::TableHeadersRow();
+
+            for (size_t i = 0; i < metrics.GetAnalyzerCount(); ++i)
+            {
+                const auto &histogram = metrics.GetAnalyzerHistogram(i);
+                const bool isHeaviest = i == heaviest && metrics.GetAnalyzerCount() > 1;
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                if (isHeaviest)
+                {
+                    ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.0f, 1.0f), "%s", metrics.GetAnalyzerName(i).c_str());
+                }
+                else
+                {
+                    ImGui::Text("%s", metrics.GetAnalyzerName(i).c_str());
+                }
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToMicros(histogram.GetPercentile(50.0)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToMicros(histogram.GetPercentile(99.0)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToMicros(histogram.GetPercentile(99.9)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToMicros(histogram.GetMax()));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f%%", 100.0f * ToBudgetRatio(histogram.GetPercentile(99.0), budget));
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGui::Spacing();
+        if (ImGui::Button("Reset Statistics"))
+        {
+            analysisEngine->GetMetrics().RequestReset();
+        }
+    }
+
+    void PerformancePanel::RenderTraceControls()
+    {
+#if GD_ENABLE_TRACING
+        auto &tracer = Util::Tracer::Get();
+
+        if (tracer.IsRecording())
+        {
+            if (ImGui::Button("Stop Trace"))
+            {
+                tracer.Stop();
+                traceStatus = tracer.WriteChromeTrace(std::string(g_kTraceFileName))
+                                  ? "Saved " + std::to_string(tracer.GetEventCount()) + " events to " + g_kTraceFileName
+                                  : "Failed to write " + std::string(g_kTraceFileName);
+            }
+            ImGui::SameLine();
+            ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f),
+                "Recording (%zu events, %llu dropped)",
+                tracer.GetEventCount(),
+                static_cast<unsigned long long>(tracer.GetDroppedCount()));
+        }
+        else
+        {
+            if (ImGui::Button("Start Trace"))
+            {
+                tracer.Start();
+                traceStatus.clear();
+            }
+            if (!traceStatus.empty())
+            {
+                ImGui::SameLine();
+                ImGui::Text("%s", traceStatus.c_str());
+            }
+        }
+
+        ImGui::Separator();
+#endif
+    }
+
+    void PerformancePanel::RenderRedrawControls()
+    {
+        if (!redrawThrottle)
+        {
+            return;
+        }
+
+        bool idleRendering = redrawThrottle->IsEnabled();
+        if (ImGui::Checkbox("Idle rendering", &idleRendering))
+        {
+            redrawThrottle->SetEnabled(idleRendering);
+        }
+        ImGui::SameLine();
+        ImGui::Text("UI: %.1f frames/s, result sequence %llu",
+            ImGui::GetIO().Framerate,
+            static_cast<unsigned long long>(analysisEngine->GetResultSequence()));
+
+        ImGui::Separator();
+    }
+
+    const std::string &PerformancePanel::GetName() const
+    {
+        return panelName;
+    }
+
+    bool PerformancePanel::IsActive() const
+    {
+        return isActive;
+    }
+
+    void PerformancePanel::SetActive(bool active)
+    {
+        isActive = active;
+    }
+
+} // namespace GuitarDiagnostics::UI
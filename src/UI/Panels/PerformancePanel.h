@@ -0,0 +1,79 @@
+#pragma once
+
+#include "UI/Panel.h"
+
+#include <string>
+
+namespace GuitarDiagnostics::Analysis
+{
+    class AnalysisEngine;
+}
+
+namespace GuitarDiagnostics::UI
+{
+    class RedrawThrottle;
+
+    /**
+     * @brief Panel showing real-time performance of the analysis engine.
+     *
+     * Displays per-analyzer ProcessBuffer() percentiles, CPU budget usage, deadline misses and
+     * ring buffer fill, so an overloaded machine can be diagnosed without a profiler. Can also
+     * record a Chrome trace of the audio, analysis and UI threads, and shows the UI frame rate
+     * with a switch for idle rendering.
+     */
+    class PerformancePanel : public Panel
+    {
+    public:
+        /**
+         * @brief Constructs the PerformancePanel.
+         * @param engine Pointer to the analysis engine.
+         * @param redrawThrottle Pointer to the application's redraw throttle, may be null.
+         */
+        PerformancePanel(Analysis::AnalysisEngine *engine, RedrawThrottle *redrawThrottle);
+
+        /**
+         * @brief Destructor.
+         */
+        ~PerformancePanel() override;
+
+        PerformancePanel(const PerformancePanel &) = delete;
+
+        PerformancePanel &operator=(const PerformancePanel &) = delete;
+
+        PerformancePanel(PerformancePanel &&) = delete;
+
+        PerformancePanel &operator=(PerformancePanel &&) = delete;
+
+        void OnAttach() override;
+
+        void OnDetach() override;
+
+        void OnUpdate(float deltaTime) override;
+
+        void OnImGuiRender() override;
+
+        const std::string &GetName() const override;
+
+        bool IsActive() const override;
+
+        void SetActive(bool active) override;
+
+    private:
+        /**
+         * @brief Renders the trace recording controls.
+         */
+        void RenderTraceControls();
+
+        /**
+         * @brief Renders the UI frame rate and the idle rendering switch.
+         */
+        void RenderRedrawControls();
+
+        Analysis::AnalysisEngine *analysisEngine; ///< Pointer to the analysis engine.
+        RedrawThrottle *redrawThrottle;           ///< UI frame throttle, may be null.
+        std::string panelName;                    ///< Display name.
+        std::string traceStatus;                  ///< Result of the last trace export.
+        bool isActive;                            ///< Active state.
+    };
+
+} // namespace GuitarDiagnostics::UI
@@ -0,0 +1,151 @@
+#include "UI/Panels/SpectrogramPanel.h"
+
+#include "Analysis/Spectrogram.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace GuitarDiagnostics::UI
+{
+
+    namespace
+    {
+        /**
+         * @brief Frequency axis label.
+         */
+        struct AxisTick
+        {
+            float frequency;   ///< Frequency in Hz.
+            const char *label; ///< Text drawn next to the axis.
+        };
+
+        constexpr std::array<AxisTick, 7> g_kAxisTicks = { {
+            { 50.0f, "50" },
+            { 100.0f, "100" },
+            { 250.0f, "250" },
+            { 500.0f, "500" },
+            { 1000.0f, "1k" },
+            { 4000.0f, "4k" },
+            { 10000.0f, "10k" },
+        } };
+    } // namespace
+
+    SpectrogramPanel::SpectrogramPanel(const Analysis::Spectrogram *spectrogram)
+        : spectrogram(spectrogram), panelName("Spectrogram"), isActive(false)
+    {
+    }
+
+    SpectrogramPanel::~SpectrogramPanel()
+    {
+    }
+
+    void SpectrogramPanel::OnAttach()
+    {
+    }
+
+    void SpectrogramPanel::OnDetach()
+    {
+    }
+
+    void SpectrogramPanel::OnUpdate([[maybe_unused]] float deltaTime)
+    {
+    }
+
+    void SpectrogramPanel::OnImGuiRender()
+    {
+        ImGui::Text("Spectrogram");
+        ImGui::Separator();
+
+        if (!spectrogram)
+        {
+            ImGui::Text("Error: Spectrogram not initialized");
+            return;
+        }
+
+        const uint64_t rowCount = spectrogram->GetRowCount();
+        if (rowCount == 0)
+        {
+            ImGui::Text("Waiting for audio data...");
+            return;
+        }
+
+        const ImVec2 available = ImGui::GetContentRegionAvail();
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const ImVec2 size(std::max(available.x, g_kAxisWidth + 1.0f), std::max(available.y, 100.0f));
+        ImGui::Dummy(size);
+
+        ImDrawList *drawList = ImGui::GetWindowDrawList();
+        const float plotLeft = origin.x + g_kAxisWidth;
+        const float plotRight = origin.x + size.x;
+        const float plotBottom = origin.y + size.y;
+        drawList->AddRectFilled(ImVec2(plotLeft, origin.y),
+            ImVec2(plotRight, plotBottom),
+            spectrogram->GetBackgroundColor());
+
+        // Fixed time scale, newest hop at the right edge; silent cells are left to the background.
+        const size_t slots = std::min(spectrogram->GetReadableRows(), g_kMaxVisibleRows);
+        const size_t visibleRows = static_cast<size_t>(std::min<uint64_t>(rowCount, slots));
+        const float rowWidth = (plotRight - plotLeft) / static_cast<float>(slots);
+        const size_t bandCount = spectrogram->GetBandCount();
+        const float bandHeight = size.y / static_cast<float>(bandCount);
+        const uint32_t background = spectrogram->GetBackgroundColor();
+
+        for (size_t i = 0; i < visibleRows; ++i)
+        {
+            const auto row = spectrogram->GetRow(rowCount - visibleRows + i);
+            const float right = plotRight - static_cast<float>(visibleRows - 1 - i) * rowWidth;
+            const float left = right - rowWidth;
+
+            size_t band = 0;
+            while (band < bandCount)
+            {
+                const uint32_t color = row[band];
+                size_t end = band + 1;
+                while (end < bandCount && row[end] == color)
+                {
+                    ++end;
+                }
+
+                if (color != background)
+                {
+                    drawList->AddRectFilled(ImVec2(left, plotBottom - static_cast<float>(end) * bandHeight),
+                        ImVec2(right, plotBottom - static_cast<float>(band) * bandHeight),
+                        color);
+                }
+                band = end;
+            }
+        }
+
+        for (const auto &tick : g_kAxisTicks)
+        {
+            const float position = spectrogram->GetFrequencyPosition(tick.frequency);
+            if (position <= 0.0f || position >= 1.0f)
+            {
+                continue;
+            }
+
+            const float y = plotBottom - position * size.y;
+            drawList->AddLine(ImVec2(plotLeft - 4.0f, y), ImVec2(plotLeft, y), IM_COL32(200, 200, 200, 255));
+            drawList->AddText(ImVec2(origin.x, y - 7.0f), IM_COL32(200, 200, 200, 255), tick.label);
+        }
+    }
+
+    const std::string &SpectrogramPanel::GetName() const
+    {
+        return panelName;
+    }
+
+    bool SpectrogramPanel::IsActive() const
+    {
+        return isActive;
+    }
+
+    void SpectrogramPanel::SetActive(bool active)
+    {
+        isActive = active;
+    }
+
+} // namespace GuitarDiagnostics::UI
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "UI/Panel.h"
+
+#include <string>
+
+namespace GuitarDiagnostics::Analysis
+{
+    class Spectrogram;
+}
+
+namespace GuitarDiagnostics::UI
+{
+
+    /**
+     * @brief Panel showing a scrolling log-frequency spectrogram.
+     *
+     * Rows arrive already colored from the analysis thread; the panel only lays them out as
+     * rectangles, merging runs of equal color within a row, so it does no spectral math and no
+     * FFT of its own.
+     */
+    class SpectrogramPanel : public Panel
+    {
+    public:
+        /**
+         * @brief Constructs the SpectrogramPanel.
+         * @param spectrogram Pointer to the spectrogram filled by the analysis thread, may be null.
+         */
+        explicit SpectrogramPanel(const Analysis::Spectrogram *spectrogram);
+
+        /**
+         * @brief Destructor.
+         */
+        ~SpectrogramPanel() override;
+
+        SpectrogramPanel(const SpectrogramPanel &) = delete;
+
+        SpectrogramPanel &operator=(const SpectrogramPanel &) = delete;
+
+        SpectrogramPanel(SpectrogramPanel &&) = delete;
+
+        SpectrogramPanel &operator=(SpectrogramPanel &&) = delete;
+
+        void OnAttach() override;
+
+        void OnDetach() override;
+
+        void OnUpdate(float deltaTime) override;
+
+        void OnImGuiRender() override;
+
+        const std::string &GetName() const override;
+
+        bool IsActive() const override;
+
+        void SetActive(bool active) override;
+
+    private:
+        const Analysis::Spectrogram *spectrogram; ///< Spectrogram filled by the analysis thread.
+        std::string panelName;                    ///< Display name of the panel.
+        bool isActive;                            ///< Active state flag.
+
+        static constexpr size_t g_kMaxVisibleRows = 256; ///< Hops shown across the plot width.
+        static constexpr float g_kAxisWidth = 48.0f;     ///< Width reserved for frequency labels.
+    };
+
+} // namespace GuitarDiagnostics::UI
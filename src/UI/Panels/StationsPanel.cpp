@@ -0,0 +1,166 @@
+#include "UI/Panels/StationsPanel.h"
+
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/EngineMetrics.h"
+#include "Analysis/Envelope/EnvelopeFollower.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Audio/AudioSource.h"
+
+#include <imgui.h>
+
+#include <utility>
+
+namespace GuitarDiagnostics::UI
+{
+
+    StationView::StationView(std::string name, Analysis::AnalysisEngine *engine, const Audio::AudioSource *source)
+        : name(std::move(name)), engine(engine), source(source)
+    {
+    }
+
+    StationsPanel::StationsPanel(std::vector<StationView> stations)
+        : stations(std::move(stations)), panelName("Stations"), isActive(false)
+    {
+    }
+
+    StationsPanel::~StationsPanel()
+    {
+    }
+
+    void StationsPanel::OnAttach()
+    {
+    }
+
+    void StationsPanel::OnDetach()
+    {
+    }
+
+    void StationsPanel::OnUpdate([[maybe_unused]] float deltaTime)
+    {
+    }
+
+    void StationsPanel::OnImGuiRender()
+    {
+        ImGui::Text("Stations: %zu", stations.size());
+        ImGui::Separator();
+
+        if (ImGui::BeginTable("Stations", 9, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Station");
+            ImGui::TableSetupColumn("Input");
+            ImGui::TableSetupColumn("Level (dB) / onsets");
+            ImGui::TableSetupColumn("Buzz");
+            ImGui::TableSetupColumn("Intonation (cents)");
+            ImGui::TableSetupColumn("Health");
+            ImGui::TableSetupColumn("p99 hop / budget");
+            ImGui::TableSetupColumn("Misses");
+            ImGui::TableSetupColumn("Dropped");
+            ImGui::TableHeadersRow();
+
+            for (const auto &station : stations)
+            {
+                RenderStation(station);
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    void StationsPanel::RenderStation(const StationView &station)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%s", station.name.c_str());
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%s", station.source ? station.source->GetName().c_str() : "-");
+
+        ImGui::TableNextColumn();
+        auto follower = station.engine->GetAnalyzer<Analysis::EnvelopeFollower>();
+        auto envelope = follower ? std::dynamic_pointer_cast<Analysis::EnvelopeResult>(follower->GetLatestResult())
+                                 : nullptr;
+        if (envelope && envelope->isValid)
+        {
+            ImGui::Text("%.0f / %llu", envelope->levelDb, static_cast<unsigned long long>(envelope->onsetCount));
+        }
+        else
+        {
+            ImGui::Text("-");
+        }
+
+        ImGui::TableNextColumn();
+        auto detector = station.engine->GetAnalyzer<Analysis::FretBuzzDetector>();
+        auto buzz = detector ? std::dynamic_pointer_cast<Analysis::FretBuzzResult>(detector->GetLatestResult())
+                             : nullptr;
+        if (buzz && buzz->isValid)
+        {
+            const ImVec4 color = buzz->buzzScore > 0.5f ? ImVec4(1.0f, 0.0f, 0.0f, 1.0f)
+                                                         : ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
+            ImGui::TextColored(color, "%.2f", buzz->buzzScore);
+        }
+        else
+        {
+            ImGui::Text("-");
+        }
+
+        ImGui::TableNextColumn();
+        auto intonation = station.engine->GetAnalyzer<Analysis::IntonationAnalyzer>();
+        auto tuning = intonation
+                          ? std::dynamic_pointer_cast<Analysis::IntonationResult>(intonation->GetLatestResult())
+                          : nullptr;
+        if (tuning && tuning->isValid && tuning->state == Analysis::IntonationState::Complete)
+        {
+            const ImVec4 color = tuning->isInTune ? ImVec4(0.0f, 1.0f, 0.0f, 1.0f) : ImVec4(1.0f, 0.0f, 0.0f, 1.0f);
+            ImGui::TextColored(color, "%+.1f", tuning->centDeviation);
+        }
+        else
+        {
+            ImGui::Text("-");
+        }
+
+        ImGui::TableNextColumn();
+        auto stringHealth = station.engine->GetAnalyzer<Analysis::StringHealthAnalyzer>();
+        auto health = stringHealth
+                          ? std::dynamic_pointer_cast<Analysis::StringHealthResult>(stringHealth->GetLatestResult())
+                          : nullptr;
+        if (health && health->isValid)
+        {
+            ImGui::Text("%.2f", health->healthScore);
+        }
+        else
+        {
+            ImGui::Text("-");
+        }
+
+        const auto &metrics = station.engine->GetMetrics();
+        const uint64_t budget = metrics.GetHopBudget();
+        const uint64_t p99 = metrics.GetHopHistogram().GetPercentile(99.0);
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f%%", budget > 0 ? 100.0 * static_cast<double>(p99) / static_cast<double>(budget) : 0.0);
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(metrics.GetDeadlineMisses()));
+
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(station.source ? station.source->GetDroppedSamples() : 0));
+    }
+
+    const std::string &StationsPanel::GetName() const
+    {
+        return panelName;
+    }
+
+    bool StationsPanel::IsActive() const
+    {
+        return isActive;
+    }
+
+    void StationsPanel::SetActive(bool active)
+    {
+        isActive = active;
+    }
+
+} // namespace GuitarDiagnostics::UI
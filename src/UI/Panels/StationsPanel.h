@@ -0,0 +1,94 @@
+#pragma once
+
+#include "UI/Panel.h"
+
+#include <string>
+#include <vector>
+
+namespace GuitarDiagnostics::Analysis
+{
+    class AnalysisEngine;
+}
+
+namespace GuitarDiagnostics::Audio
+{
+    class AudioSource;
+}
+
+namespace GuitarDiagnostics::UI
+{
+
+    /**
+     * @brief What the stations panel shows of one station.
+     */
+    struct StationView
+    {
+        std::string name;                 ///< Display name.
+        Analysis::AnalysisEngine *engine; ///< Engine analyzing the station.
+        const Audio::AudioSource *source; ///< Input of the station.
+
+        /**
+         * @brief Constructs a StationView.
+         * @param name Display name.
+         * @param engine Engine analyzing the station.
+         * @param source Input of the station.
+         */
+        StationView(std::string name, Analysis::AnalysisEngine *engine, const Audio::AudioSource *source);
+    };
+
+    /**
+     * @brief Panel summarizing every station of a multi-station setup in one table.
+     *
+     * Shows the latest buzz, intonation and string health result of each station next to its
+     * hop time, deadline misses and dropped samples, so one operator can watch several guitars
+     * being checked at once.
+     */
+    class StationsPanel : public Panel
+    {
+    public:
+        /**
+         * @brief Constructs the StationsPanel.
+         * @param stations Stations to show, in display order.
+         */
+        explicit StationsPanel(std::vector<StationView> stations);
+
+        /**
+         * @brief Destructor.
+         */
+        ~StationsPanel() override;
+
+        StationsPanel(const StationsPanel &) = delete;
+
+        StationsPanel &operator=(const StationsPanel &) = delete;
+
+        StationsPanel(StationsPanel &&) = delete;
+
+        StationsPanel &operator=(StationsPanel &&) = delete;
+
+        void OnAttach() override;
+
+        void OnDetach() override;
+
+        void OnUpdate(float deltaTime) override;
+
+        void OnImGuiRender() override;
+
+        const std::string &GetName() const override;
+
+        bool IsActive() const override;
+
+        void SetActive(bool active) override;
+
+    private:
+        /**
+         * @brief Renders the table row of one station.
+         * @param station Station to render.
+         */
+        void RenderStation(const StationView &station);
+
+        std::vector<StationView> stations; ///< Stations in display order.
+        std::string panelName;             ///< Display name of the panel.
+        bool isActive;                     ///< Active state flag.
+    };
+
+} // namespace GuitarDiagnostics::UI
@@ -0,0 +1,59 @@
+#include "UI/RedrawThrottle.h"
+
+#include <algorithm>
+
+namespace GuitarDiagnostics::UI
+{
+
+    RedrawThrottle::RedrawThrottle(std::chrono::milliseconds resultInterval,
+        std::chrono::milliseconds idleInterval,
+        std::chrono::milliseconds inputHold)
+        : resultInterval(resultInterval), idleInterval(idleInterval), inputHold(inputHold), lastRender(), lastInput(),
+          renderedSequence(0), renderedFrames(0), hasRendered(false), isEnabled(true)
+    {
+    }
+
+    RedrawThrottle::~RedrawThrottle()
+    {
+    }
+
+    void RedrawThrottle::NotifyInput(Clock::time_point now)
+    {
+        lastInput = std::max(lastInput, now);
+    }
+
+    RedrawThrottle::Clock::duration RedrawThrottle::GetWaitTime(uint64_t resultSequence, Clock::time_point now) const
+    {
+        if (!isEnabled || !hasRendered || now < lastInput + inputHold)
+        {
+            return Clock::duration::zero();
+        }
+
+        const auto interval = resultSequence != renderedSequence ? resultInterval : idleInterval;
+        return std::max(Clock::duration::zero(), lastRender + interval - now);
+    }
+
+    void RedrawThrottle::MarkRendered(uint64_t resultSequence, Clock::time_point now)
+    {
+        lastRender = now;
+        renderedSequence = resultSequence;
+        ++renderedFrames;
+        hasRendered = true;
+    }
+
+    void RedrawThrottle::SetEnabled(bool enabled)
+    {
+        isEnabled = enabled;
+    }
+
+    bool RedrawThrottle::IsEnabled() const
+    {
+        return isEnabled;
+    }
+
+    uint64_t RedrawThrottle::GetRenderedFrames() const
+    {
+        return renderedFrames;
+    }
+
+} // namespace GuitarDiagnostics::UI
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace GuitarDiagnostics::UI
+{
+
+    /**
+     * @brief Decides when the UI needs to draw a frame.
+     *
+     * A frame is due when the analysis engine has published a new result sequence number, when the
+     * user interacted recently, or when the idle interval has passed since the last frame (so clocks
+     * and slow-moving text still refresh). New results are drawn at most once per result interval,
+     * so a fast hop rate cannot push the UI above a useful refresh rate. Between frames the UI
+     * thread sleeps for GetWaitTime(); it owns the throttle, which is not thread-safe.
+     */
+    class RedrawThrottle
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Constructs the RedrawThrottle. The first query always requests a frame.
+         * @param resultInterval Shortest time between frames drawn for new results.
+         * @param idleInterval Time between frames when nothing changed.
+         * @param inputHold Time after the last input during which every frame is drawn.
+         */
+        RedrawThrottle(std::chrono::milliseconds resultInterval,
+            std::chrono::milliseconds idleInterval,
+            std::chrono::milliseconds inputHold);
+
+        /**
+         * @brief Destructor.
+         */
+        ~RedrawThrottle();
+
+        RedrawThrottle(const RedrawThrottle &) = delete;
+
+        RedrawThrottle &operator=(const RedrawThrottle &) = delete;
+
+        RedrawThrottle(RedrawThrottle &&) = delete;
+
+        RedrawThrottle &operator=(RedrawThrottle &&) = delete;
+
+        /**
+         * @brief Records user input, which keeps the UI at full frame rate for the input hold time.
+         * @param now Time of the input.
+         */
+        void NotifyInput(Clock::time_point now);
+
+        /**
+         * @brief Gets how long the UI may sleep before the next frame is due.
+         * @param resultSequence Latest result sequence number of the analysis engine.
+         * @param now Current time.
+         * @return Zero if a frame should be drawn now, otherwise the time until one is due.
+         */
+        Clock::duration GetWaitTime(uint64_t resultSequence, Clock::time_point now) const;
+
+        /**
+         * @brief Records that a frame was drawn.
+         * @param resultSequence Result sequence number shown by the frame.
+         * @param now Time the frame started.
+         */
+        void MarkRendered(uint64_t resultSequence, Clock::time_point now);
+
+        /**
+         * @brief Enables or disables idle rendering; when disabled every frame is drawn.
+         * @param enabled True to skip frames while idle.
+         */
+        void SetEnabled(bool enabled);
+
+        /**
+         * @brief Checks if idle rendering is enabled.
+         * @return True if frames are skipped while idle.
+         */
+        bool IsEnabled() const;
+
+        /**
+         * @brief Gets the number of frames drawn.
+         * @return Frame count since construction.
+         */
+        uint64_t GetRenderedFrames() const;
+
+    private:
+        std::chrono::milliseconds resultInterval; ///< Shortest time between result-driven frames.
+        std::chrono::milliseconds idleInterval;   ///< Time between frames when nothing changed.
+        std::chrono::milliseconds inputHold;      ///< Full-rate period after input.
+        Clock::time_point lastRender;             ///< Start of the last drawn frame.
+        Clock::time_point lastInput;              ///< Time of the last input.
+        uint64_t renderedSequence;                ///< Result sequence number of the last drawn frame.
+        uint64_t renderedFrames;                  ///< Frames drawn since construction.
+        bool hasRendered;                         ///< False until the first frame is drawn.
+        bool isEnabled;                           ///< Idle rendering switch.
+    };
+
+} // namespace GuitarDiagnostics::UI
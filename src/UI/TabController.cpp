@@ -8,14 +8,20 @@ namespace GuitarDiagnostics::UI
     TabController::TabController(std::unique_ptr<Panel> fretBuzzPanel,
         std::unique_ptr<Panel> intonationPanel,
         std::unique_ptr<Panel> stringHealthPanel,
-        std::unique_ptr<Panel> audioMonitorPanel)
+        std::unique_ptr<Panel> audioMonitorPanel,
+        std::unique_ptr<Panel> spectrogramPanel,
+        std::unique_ptr<Panel> stationsPanel,
+        std::unique_ptr<Panel> performancePanel)
         : panels(), activeTabIndex(0)
     {
-        panels.reserve(4);
+        panels.reserve(7);
         panels.push_back(std::move(fretBuzzPanel));
         panels.push_back(std::move(intonationPanel));
         panels.push_back(std::move(stringHealthPanel));
         panels.push_back(std::move(audioMonitorPanel));
+        panels.push_back(std::move(spectrogramPanel));
+        panels.push_back(std::move(stationsPanel));
+        panels.push_back(std::move(performancePanel));
     }
 
     TabController::~TabController()
@@ -22,11 +22,17 @@ namespace GuitarDiagnostics::UI
          * @param intonationPanel Panel for Intonation analysis.
          * @param stringHealthPanel Panel for String Health analysis.
          * @param audioMonitorPanel Panel for raw audio monitoring.
+         * @param spectrogramPanel Panel for the scrolling spectrogram.
+         * @param stationsPanel Panel summarizing all stations.
+         * @param performancePanel Panel for analysis engine performance.
          */
         TabController(std::unique_ptr<Panel> fretBuzzPanel,
             std::unique_ptr<Panel> intonationPanel,
             std::unique_ptr<Panel> stringHealthPanel,
-            std::unique_ptr<Panel> audioMonitorPanel);
+            std::unique_ptr<Panel> audioMonitorPanel,
+            std::unique_ptr<Panel> spectrogramPanel,
+            std::unique_ptr<Panel> stationsPanel,
+            std::unique_ptr<Panel> performancePanel);
 
         /**
          * @brief Destructor.
@@ -0,0 +1,143 @@
+#include "Util/AllocationGuard.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace GuitarDiagnostics::Util
+{
+
+    namespace
+    {
+        thread_local int g_noAllocationDepth = 0; ///< Open NoAllocationScope count of the thread.
+        thread_local bool g_reporting = false;    ///< Set while a violation is printed, which may allocate.
+
+        std::atomic<uint64_t> g_violationCount{ 0 };                                   ///< Violations on all threads.
+        std::atomic<AllocationGuard::Policy> g_policy{ AllocationGuard::Policy::Log }; ///< Current policy.
+    } // namespace
+
+    bool AllocationGuard::IsEnabled()
+    {
+        return GD_ENABLE_ALLOCATION_GUARD != 0;
+    }
+
+    void AllocationGuard::SetPolicy(Policy policy)
+    {
+        g_policy.store(policy, std::memory_order_relaxed);
+    }
+
+    AllocationGuard::Policy AllocationGuard::GetPolicy()
+    {
+        return g_policy.load(std::memory_order_relaxed);
+    }
+
+    uint64_t AllocationGuard::GetViolationCount()
+    {
+        return g_violationCount.load(std::memory_order_relaxed);
+    }
+
+    void AllocationGuard::ResetViolationCount()
+    {
+        g_violationCount.store(0, std::memory_order_relaxed);
+    }
+
+    void AllocationGuard::OnAllocation(size_t size) noexcept
+    {
+        if (g_noAllocationDepth == 0 || g_reporting)
+        {
+            return;
+        }
+
+        g_violationCount.fetch_add(1, std::memory_order_relaxed);
+
+        const Policy policy = g_policy.load(std::memory_order_relaxed);
+        if (policy == Policy::Count)
+        {
+            return;
+        }
+
+        g_reporting = true;
+        std::fprintf(stderr, "AllocationGuard: %zu byte heap allocation inside a no-allocation scope\n", size);
+        g_reporting = false;
+
+        if (policy == Policy::Abort)
+        {
+            std::abort();
+        }
+    }
+
+    NoAllocationScope::NoAllocationScope() noexcept
+    {
+        ++g_noAllocationDepth;
+    }
+
+    NoAllocationScope::~NoAllocationScope()
+    {
+        --g_noAllocationDepth;
+    }
+
+} // namespace GuitarDiagnostics::Util
+
+#if GD_ENABLE_ALLOCATION_GUARD
+
+// Replacements of the global allocation functions. Over-aligned new keeps the standard library
+// implementation and is not checked.
+
+void *operator new(std::size_t size)
+{
+    GuitarDiagnostics::Util::AllocationGuard::OnAllocation(size);
+    if (void *memory = std::malloc(size > 0 ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    GuitarDiagnostics::Util::AllocationGuard::OnAllocation(size);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+#endif
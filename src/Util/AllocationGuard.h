@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef GD_ENABLE_ALLOCATION_GUARD
+#define GD_ENABLE_ALLOCATION_GUARD 0
+#endif
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief Debug check that real-time code paths do not allocate.
+     *
+     * When the build sets GD_ENABLE_ALLOCATION_GUARD to 1, the global operator new is replaced
+     * with a hook that detects heap allocations made on a thread inside a NoAllocationScope
+     * and reacts according to the configured policy. Otherwise the hook is not compiled and
+     * GD_NO_ALLOCATION_SCOPE does nothing.
+     */
+    class AllocationGuard
+    {
+    public:
+        /**
+         * @brief Reaction to an allocation inside a no-allocation scope.
+         */
+        enum class Policy
+        {
+            Count, ///< Only count violations.
+            Log,   ///< Count and print each violation to stderr.
+            Abort  ///< Print the violation and abort the process.
+        };
+
+        AllocationGuard() = delete;
+
+        /**
+         * @brief Checks whether the operator new hook is compiled in.
+         * @return True if GD_ENABLE_ALLOCATION_GUARD is set.
+         */
+        static bool IsEnabled();
+
+        /**
+         * @brief Sets the reaction to violations.
+         * @param policy New policy.
+         */
+        static void SetPolicy(Policy policy);
+
+        /**
+         * @brief Gets the reaction to violations.
+         * @return Current policy.
+         */
+        static Policy GetPolicy();
+
+        /**
+         * @brief Gets the number of allocations made inside no-allocation scopes on any thread.
+         * @return Violation count.
+         */
+        static uint64_t GetViolationCount();
+
+        /**
+         * @brief Resets the violation count to zero.
+         */
+        static void ResetViolationCount();
+
+        /**
+         * @brief Reports an allocation. Called by the operator new hook.
+         * @param size Requested size in bytes.
+         */
+        static void OnAllocation(size_t size) noexcept;
+    };
+
+    /**
+     * @brief RAII region of the calling thread in which heap allocation is a violation.
+     *
+     * Scopes nest; allocation is checked while at least one is open on the thread.
+     */
+    class NoAllocationScope
+    {
+    public:
+        /**
+         * @brief Opens the region.
+         */
+        NoAllocationScope() noexcept;
+
+        /**
+         * @brief Closes the region.
+         */
+        ~NoAllocationScope();
+
+        NoAllocationScope(const NoAllocationScope &) = delete;
+
+        NoAllocationScope &operator=(const NoAllocationScope &) = delete;
+
+        NoAllocationScope(NoAllocationScope &&) = delete;
+
+        NoAllocationScope &operator=(NoAllocationScope &&) = delete;
+    };
+
+} // namespace GuitarDiagnostics::Util
+
+#if GD_ENABLE_ALLOCATION_GUARD
+#define GD_NO_ALLOCATION_CONCAT_IMPL(a, b) a##b
+#define GD_NO_ALLOCATION_CONCAT(a, b) GD_NO_ALLOCATION_CONCAT_IMPL(a, b)
+#define GD_NO_ALLOCATION_SCOPE()                                                                                       \
+    ::GuitarDiagnostics::Util::NoAllocationScope GD_NO_ALLOCATION_CONCAT(gdNoAllocationScope, __LINE__)
+#else
+#define GD_NO_ALLOCATION_SCOPE() static_cast<void>(0)
+#endif
@@ -0,0 +1,45 @@
+#include "Util/Arena.h"
+
+#include <new>
+
+namespace GuitarDiagnostics::Util
+{
+
+    void Arena::BlockDeleter::operator()(std::byte *memory) const noexcept
+    {
+        ::operator delete[](memory, std::align_val_t(g_kAlignment));
+    }
+
+    Arena::Arena() : block(), capacity(0), used(0)
+    {
+    }
+
+    Arena::~Arena()
+    {
+    }
+
+    void Arena::Reset(size_t blockSize)
+    {
+        // Free first, so the old and new blocks never coexist.
+        block.reset();
+        capacity = 0;
+        used = 0;
+
+        if (blockSize > 0)
+        {
+            block.reset(static_cast<std::byte *>(::operator new[](blockSize, std::align_val_t(g_kAlignment))));
+            capacity = blockSize;
+        }
+    }
+
+    size_t Arena::GetCapacity() const noexcept
+    {
+        return capacity;
+    }
+
+    size_t Arena::GetUsed() const noexcept
+    {
+        return used;
+    }
+
+} // namespace GuitarDiagnostics::Util
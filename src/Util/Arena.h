@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief Monotonic arena holding an analyzer's working buffers in one contiguous block.
+     *
+     * The owner sizes the arena with Reset() at configure time and then carves its buffers from
+     * it with Allocate(). Every buffer starts on its own cache line, so buffers touched by the hot
+     * path sit next to each other without sharing lines. There is no per-buffer free: the next
+     * Reset() releases all buffers at once and allocates a single new block, so reconfiguring
+     * never leaves small holes in the heap. Only trivially destructible types are allowed, since
+     * no destructors run.
+     *
+     * Not thread-safe; buffers are set up before the analysis thread starts using them.
+     */
+    class Arena
+    {
+    public:
+        static constexpr size_t g_kAlignment = 64; ///< Alignment of every buffer, one cache line.
+
+        /**
+         * @brief Constructs an empty Arena with no block.
+         */
+        Arena();
+
+        /**
+         * @brief Destructor. Releases the block.
+         */
+        ~Arena();
+
+        Arena(const Arena &) = delete;
+
+        Arena &operator=(const Arena &) = delete;
+
+        Arena(Arena &&) = delete;
+
+        Arena &operator=(Arena &&) = delete;
+
+        /**
+         * @brief Gets the bytes a buffer of count elements takes in the arena, padding included.
+         * @tparam T Element type.
+         * @param count Number of elements.
+         * @return Bytes to add to the capacity passed to Reset().
+         */
+        template<typename T> static constexpr size_t GetFootprint(size_t count) noexcept
+        {
+            return (count * sizeof(T) + g_kAlignment - 1) / g_kAlignment * g_kAlignment;
+        }
+
+        /**
+         * @brief Releases all buffers and allocates a new block. Invalidates every span handed out.
+         * @param blockSize Block size in bytes, usually a sum of GetFootprint() values; 0 frees the block.
+         */
+        void Reset(size_t blockSize);
+
+        /**
+         * @brief Carves a value-initialized, cache-line aligned buffer from the block.
+         * @tparam T Element type; must be trivially destructible and at most cache-line aligned.
+         * @param count Number of elements.
+         * @return The buffer, or an empty span if the remaining capacity is too small.
+         */
+        template<typename T> std::span<T> Allocate(size_t count) noexcept
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena never runs destructors");
+            static_assert(alignof(T) <= g_kAlignment, "Arena aligns buffers to one cache line");
+
+            const size_t footprint = GetFootprint<T>(count);
+            if (count == 0 || footprint > capacity - used)
+            {
+                return {};
+            }
+
+            T *elements = reinterpret_cast<T *>(block.get() + used);
+            std::uninitialized_value_construct_n(elements, count);
+            used += footprint;
+            return std::span<T>(elements, count);
+        }
+
+        /**
+         * @brief Gets the size of the current block.
+         * @return Capacity in bytes.
+         */
+        size_t GetCapacity() const noexcept;
+
+        /**
+         * @brief Gets the bytes handed out since the last Reset().
+         * @return Used bytes, padding included.
+         */
+        size_t GetUsed() const noexcept;
+
+    private:
+        /**
+         * @brief Releases a block allocated with cache-line alignment.
+         */
+        struct BlockDeleter
+        {
+            void operator()(std::byte *memory) const noexcept;
+        };
+
+        std::unique_ptr<std::byte[], BlockDeleter> block; ///< Cache-line aligned block, may be null.
+        size_t capacity;                                  ///< Size of the block in bytes.
+        size_t used;                                      ///< Bytes handed out since the last Reset().
+    };
+
+} // namespace GuitarDiagnostics::Util
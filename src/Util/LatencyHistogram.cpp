@@ -0,0 +1,176 @@
+#include "Util/LatencyHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace GuitarDiagnostics::Util
+{
+
+    namespace
+    {
+        constexpr size_t g_kSubBucketBits = 5;                                      ///< log2 of sub-buckets per octave.
+        constexpr size_t g_kSubBucketCount = size_t{ 1 } << g_kSubBucketBits;       ///< Sub-buckets per octave.
+        constexpr size_t g_kOctaveCount = 36;                                       ///< Octaves above the linear range.
+        constexpr size_t g_kBucketCount = g_kSubBucketCount * (g_kOctaveCount + 1); ///< Total buckets.
+
+        /**
+         * @brief Single-writer increment that stays readable from other threads.
+         */
+        void Add(std::atomic<uint64_t> &counter, uint64_t value) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    } // namespace
+
+    LatencyHistogram::LatencyHistogram()
+        : buckets(std::make_unique<std::atomic<uint64_t>[]>(g_kBucketCount)), count(0), sum(0),
+          min(std::numeric_limits<uint64_t>::max()), max(0)
+    {
+        Reset();
+    }
+
+    LatencyHistogram::~LatencyHistogram()
+    {
+    }
+
+    void LatencyHistogram::Record(uint64_t nanoseconds, uint64_t occurrences) noexcept
+    {
+        if (occurrences == 0)
+        {
+            return;
+        }
+
+        Add(buckets[GetBucketIndex(nanoseconds)], occurrences);
+        Add(count, occurrences);
+        Add(sum, nanoseconds * occurrences);
+
+        if (nanoseconds < min.load(std::memory_order_relaxed))
+        {
+            min.store(nanoseconds, std::memory_order_relaxed);
+        }
+        if (nanoseconds > max.load(std::memory_order_relaxed))
+        {
+            max.store(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+
+    void LatencyHistogram::Merge(const LatencyHistogram &other) noexcept
+    {
+        if (other.GetCount() == 0)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < g_kBucketCount; ++i)
+        {
+            Add(buckets[i], other.buckets[i].load(std::memory_order_relaxed));
+        }
+
+        Add(count, other.count.load(std::memory_order_relaxed));
+        Add(sum, other.sum.load(std::memory_order_relaxed));
+        min.store(std::min(min.load(std::memory_order_relaxed), other.min.load(std::memory_order_relaxed)),
+            std::memory_order_relaxed);
+        max.store(std::max(max.load(std::memory_order_relaxed), other.max.load(std::memory_order_relaxed)),
+            std::memory_order_relaxed);
+    }
+
+    void LatencyHistogram::Reset() noexcept
+    {
+        for (size_t i = 0; i < g_kBucketCount; ++i)
+        {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+
+        count.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::GetPercentile(double percentile) const noexcept
+    {
+        const uint64_t total = GetCount();
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        const double clamped = std::clamp(percentile, 0.0, 100.0);
+        const auto target =
+            std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(total))));
+
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < g_kBucketCount; ++i)
+        {
+            cumulative += buckets[i].load(std::memory_order_relaxed);
+            if (cumulative >= target)
+            {
+                return std::min(GetBucketUpperBound(i), GetMax());
+            }
+        }
+
+        return GetMax();
+    }
+
+    uint64_t LatencyHistogram::GetCount() const noexcept
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::GetMin() const noexcept
+    {
+        return GetCount() == 0 ? 0 : min.load(std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::GetMax() const noexcept
+    {
+        return max.load(std::memory_order_relaxed);
+    }
+
+    double LatencyHistogram::GetMean() const noexcept
+    {
+        const uint64_t total = GetCount();
+        if (total == 0)
+        {
+            return 0.0;
+        }
+        return static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(total);
+    }
+
+    size_t LatencyHistogram::GetBucketIndex(uint64_t value) noexcept
+    {
+        if (value < g_kSubBucketCount)
+        {
+            return static_cast<size_t>(value);
+        }
+
+        const size_t octave = static_cast<size_t>(std::bit_width(value)) - 1 - g_kSubBucketBits;
+        if (octave >= g_kOctaveCount)
+        {
+            return g_kBucketCount - 1;
+        }
+
+        const size_t subBucket = static_cast<size_t>(value >> octave) - g_kSubBucketCount;
+        return g_kSubBucketCount + octave * g_kSubBucketCount + subBucket;
+    }
+
+    uint64_t LatencyHistogram::GetBucketUpperBound(size_t index) noexcept
+    {
+        if (index < g_kSubBucketCount)
+        {
+            return index;
+        }
+
+        const size_t octave = (index - g_kSubBucketCount) / g_kSubBucketCount;
+        const size_t subBucket = (index - g_kSubBucketCount) % g_kSubBucketCount;
+        const uint64_t lower = static_cast<uint64_t>(g_kSubBucketCount + subBucket) << octave;
+        if (index == g_kBucketCount - 1)
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return lower + (uint64_t{ 1 } << octave) - 1;
+    }
+
+} // namespace GuitarDiagnostics::Util
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief Fixed-size log-linear histogram of durations in nanoseconds.
+     *
+     * Each power-of-two range is split into 32 linear sub-buckets, giving about 3% relative
+     * resolution from 1 ns up to roughly 18 minutes. Memory is allocated once in the constructor;
+     * Record() is wait-free and safe to call on a real-time thread.
+     *
+     * One thread may record while any number of threads read percentiles concurrently. Readers
+     * see a consistent-enough view for monitoring (individual counters never tear), but totals may
+     * lag by a few samples.
+     */
+    class LatencyHistogram
+    {
+    public:
+        /**
+         * @brief Constructs an empty LatencyHistogram.
+         */
+        LatencyHistogram();
+
+        /**
+         * @brief Destructor.
+         */
+        ~LatencyHistogram();
+
+        LatencyHistogram(const LatencyHistogram &) = delete;
+
+        LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+        LatencyHistogram(LatencyHistogram &&) = delete;
+
+        LatencyHistogram &operator=(LatencyHistogram &&) = delete;
+
+        /**
+         * @brief Records a duration. Single writer only.
+         * @param nanoseconds Duration in nanoseconds.
+         * @param occurrences Number of occurrences to add.
+         */
+        void Record(uint64_t nanoseconds, uint64_t occurrences = 1) noexcept;
+
+        /**
+         * @brief Adds all samples of another histogram. Not safe against a concurrent writer.
+         * @param other Histogram to merge.
+         */
+        void Merge(const LatencyHistogram &other) noexcept;
+
+        /**
+         * @brief Clears all samples. Not safe against a concurrent writer.
+         */
+        void Reset() noexcept;
+
+        /**
+         * @brief Gets the value at a percentile.
+         * @param percentile Percentile in [0, 100].
+         * @return Upper bound of the bucket holding the percentile in nanoseconds, 0 if empty.
+         */
+        uint64_t GetPercentile(double percentile) const noexcept;
+
+        /**
+         * @brief Gets the number of recorded samples.
+         * @return Sample count.
+         */
+        uint64_t GetCount() const noexcept;
+
+        /**
+         * @brief Gets the smallest recorded value.
+         * @return Minimum in nanoseconds, 0 if empty.
+         */
+        uint64_t GetMin() const noexcept;
+
+        /**
+         * @brief Gets the largest recorded value.
+         * @return Maximum in nanoseconds, 0 if empty.
+         */
+        uint64_t GetMax() const noexcept;
+
+        /**
+         * @brief Gets the arithmetic mean of recorded values.
+         * @return Mean in nanoseconds, 0 if empty.
+         */
+        double GetMean() const noexcept;
+
+    private:
+        /**
+         * @brief Maps a value to its bucket index.
+         * @param value Value in nanoseconds.
+         * @return Bucket index, clamped to the last bucket.
+         */
+        static size_t GetBucketIndex(uint64_t value) noexcept;
+
+        /**
+         * @brief Gets the largest value that maps to a bucket.
+         * @param index Bucket index.
+         * @return Inclusive upper bound in nanoseconds.
+         */
+        static uint64_t GetBucketUpperBound(size_t index) noexcept;
+
+        std::unique_ptr<std::atomic<uint64_t>[]> buckets; ///< Per-bucket sample counts.
+        std::atomic<uint64_t> count;                      ///< Total number of samples.
+        std::atomic<uint64_t> sum;                        ///< Sum of all samples in nanoseconds.
+        std::atomic<uint64_t> min;                        ///< Smallest sample.
+        std::atomic<uint64_t> max;                        ///< Largest sample.
+    };
+
+} // namespace GuitarDiagnostics::Util
@@ -56,6 +56,18 @@ namespace GuitarDiagnostics::Util
          */
         size_t GetAvailableRead() const noexcept;
 
+        /**
+         * @brief Gets the number of free slots available to write.
+         * @return Number of writable elements.
+         */
+        size_t GetAvailableWrite() const noexcept;
+
+        /**
+         * @brief Gets the maximum number of elements the buffer can hold.
+         * @return Usable capacity.
+         */
+        size_t GetCapacity() const noexcept;
+
     private:
         /**
          * @brief Internal helper to calculate available read items.
@@ -141,6 +153,18 @@ namespace GuitarDiagnostics::Util
         return GetAvailableReadInternal(readIdx, writeIdx);
     }
 
+    template<typename T> size_t LockFreeRingBuffer<T>::GetAvailableWrite() const noexcept
+    {
+        const size_t writeIdx = writeIndex.load(std::memory_order_relaxed);
+        const size_t readIdx = readIndex.load(std::memory_order_acquire);
+        return GetAvailableWriteInternal(writeIdx, readIdx);
+    }
+
+    template<typename T> size_t LockFreeRingBuffer<T>::GetCapacity() const noexcept
+    {
+        return capacity - 1;
+    }
+
     template<typename T>
     size_t LockFreeRingBuffer<T>::GetAvailableReadInternal(size_t readIdx, size_t writeIdx) const noexcept
     {
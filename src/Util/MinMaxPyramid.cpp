@@ -0,0 +1,198 @@
+#include "Util/MinMaxPyramid.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace GuitarDiagnostics::Util
+{
+
+    namespace
+    {
+        constexpr float g_kEmptyMin = std::numeric_limits<float>::max();    ///< Minimum of a bin with no samples.
+        constexpr float g_kEmptyMax = std::numeric_limits<float>::lowest(); ///< Maximum of a bin with no samples.
+    } // namespace
+
+    MinMaxPyramid::MinMaxPyramid(size_t baseBinSize, size_t fanout, size_t levelCount, size_t binsPerLevel)
+        : levels(), binsPerLevel(std::max<size_t>(binsPerLevel, 1)), sampleCount(0)
+    {
+        baseBinSize = std::max<size_t>(baseBinSize, 1);
+        fanout = std::max<size_t>(fanout, 2);
+        levelCount = std::max<size_t>(levelCount, 1);
+
+        levels.resize(levelCount);
+        uint64_t binSize = baseBinSize;
+        for (size_t i = 0; i < levelCount; ++i)
+        {
+            Level &level = levels[i];
+            level.binSize = binSize;
+            level.unitsPerBin = i == 0 ? baseBinSize : fanout;
+            level.minimums.assign(this->binsPerLevel, 0.0f);
+            level.maximums.assign(this->binsPerLevel, 0.0f);
+            binSize *= fanout;
+        }
+
+        Reset();
+    }
+
+    MinMaxPyramid::~MinMaxPyramid()
+    {
+    }
+
+    void MinMaxPyramid::Push(std::span<const float> samples) noexcept
+    {
+        Level &base = levels[0];
+        for (float sample : samples)
+        {
+            base.partialMin = std::min(base.partialMin, sample);
+            base.partialMax = std::max(base.partialMax, sample);
+
+            if (++base.partialUnits == base.unitsPerBin)
+            {
+                const float minimum = base.partialMin;
+                const float maximum = base.partialMax;
+                base.partialMin = g_kEmptyMin;
+                base.partialMax = g_kEmptyMax;
+                base.partialUnits = 0;
+                CompleteBin(0, minimum, maximum);
+            }
+        }
+
+        sampleCount += samples.size();
+    }
+
+    void MinMaxPyramid::CompleteBin(size_t levelIndex, float minimum, float maximum) noexcept
+    {
+        for (size_t i = levelIndex; i < levels.size(); ++i)
+        {
+            Level &level = levels[i];
+            const size_t slot = static_cast<size_t>(level.completedBins % binsPerLevel);
+            level.minimums[slot] = minimum;
+            level.maximums[slot] = maximum;
+            ++level.completedBins;
+
+            if (i + 1 == levels.size())
+            {
+                return;
+            }
+
+            Level &next = levels[i + 1];
+            next.partialMin = std::min(next.partialMin, minimum);
+            next.partialMax = std::max(next.partialMax, maximum);
+            if (++next.partialUnits < next.unitsPerBin)
+            {
+                return;
+            }
+
+            minimum = next.partialMin;
+            maximum = next.partialMax;
+            next.partialMin = g_kEmptyMin;
+            next.partialMax = g_kEmptyMax;
+            next.partialUnits = 0;
+        }
+    }
+
+    size_t MinMaxPyramid::SelectLevel(uint64_t spanSamples, size_t columns) const noexcept
+    {
+        const uint64_t samplesPerColumn = spanSamples / std::max<size_t>(columns, 1);
+
+        // Coarsest level that still gives every column at least one bin...
+        size_t index = 0;
+        while (index + 1 < levels.size() && levels[index + 1].binSize <= samplesPerColumn)
+        {
+            ++index;
+        }
+
+        // ...unless the span reaches further back than that level remembers.
+        while (index + 1 < levels.size() && spanSamples > levels[index].binSize * binsPerLevel)
+        {
+            ++index;
+        }
+
+        return index;
+    }
+
+    size_t MinMaxPyramid::GetEnvelope(uint64_t spanSamples,
+        std::span<float> minimums,
+        std::span<float> maximums) const noexcept
+    {
+        const size_t columns = std::min(minimums.size(), maximums.size());
+        if (columns == 0)
+        {
+            return 0;
+        }
+
+        const Level &level = levels[SelectLevel(spanSamples, columns)];
+
+        // Bin indices are absolute since Reset(); the bin being filled sits at completedBins.
+        const int64_t newestEnd = static_cast<int64_t>(level.completedBins) + (level.partialUnits > 0 ? 1 : 0);
+        const int64_t oldestRetained = static_cast<int64_t>(
+            level.completedBins > binsPerLevel ? level.completedBins - binsPerLevel : 0);
+        const int64_t binsInSpan = std::max<int64_t>(
+            1, static_cast<int64_t>((spanSamples + level.binSize - 1) / level.binSize));
+        const int64_t windowStart = newestEnd - binsInSpan;
+
+        const auto columnCount = static_cast<int64_t>(columns);
+        for (size_t column = 0; column < columns; ++column)
+        {
+            const int64_t first = windowStart + binsInSpan * static_cast<int64_t>(column) / columnCount;
+            const int64_t last =
+                std::max(first + 1, windowStart + binsInSpan * static_cast<int64_t>(column + 1) / columnCount);
+
+            float minimum = g_kEmptyMin;
+            float maximum = g_kEmptyMax;
+            for (int64_t bin = std::max(first, oldestRetained); bin < std::min(last, newestEnd); ++bin)
+            {
+                if (bin == static_cast<int64_t>(level.completedBins))
+                {
+                    minimum = std::min(minimum, level.partialMin);
+                    maximum = std::max(maximum, level.partialMax);
+                }
+                else
+                {
+                    const size_t slot = static_cast<size_t>(static_cast<uint64_t>(bin) % binsPerLevel);
+                    minimum = std::min(minimum, level.minimums[slot]);
+                    maximum = std::max(maximum, level.maximums[slot]);
+                }
+            }
+
+            const bool empty = minimum > maximum;
+            minimums[column] = empty ? 0.0f : minimum;
+            maximums[column] = empty ? 0.0f : maximum;
+        }
+
+        return columns;
+    }
+
+    void MinMaxPyramid::Reset() noexcept
+    {
+        for (Level &level : levels)
+        {
+            level.completedBins = 0;
+            level.partialMin = g_kEmptyMin;
+            level.partialMax = g_kEmptyMax;
+            level.partialUnits = 0;
+        }
+        sampleCount = 0;
+    }
+
+    uint64_t MinMaxPyramid::GetSampleCount() const noexcept
+    {
+        return sampleCount;
+    }
+
+    uint64_t MinMaxPyramid::GetHistoryCapacity() const noexcept
+    {
+        return levels.back().binSize * binsPerLevel;
+    }
+
+    size_t MinMaxPyramid::GetLevelCount() const noexcept
+    {
+        return levels.size();
+    }
+
+    uint64_t MinMaxPyramid::GetBinSize(size_t level) const noexcept
+    {
+        return levels[std::min(level, levels.size() - 1)].binSize;
+    }
+
+} // namespace GuitarDiagnostics::Util
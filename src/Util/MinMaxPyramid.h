@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief Streaming multi-level min/max envelope of an audio signal for waveform displays.
+     *
+     * Level 0 keeps the minimum and maximum of every baseBinSize samples; each higher level
+     * merges fanout bins of the level below. Every level is a ring of binsPerLevel bins, so
+     * coarse levels reach back minutes while fine levels keep the recent past at full detail.
+     * Push() costs amortized O(1) per sample and GetEnvelope() reads the coarsest level that
+     * still resolves one screen column, so drawing any time span costs O(columns * fanout)
+     * and never rescans raw samples. Memory is allocated in the constructor only.
+     *
+     * Not thread-safe; the owner feeds and queries it from one thread.
+     */
+    class MinMaxPyramid
+    {
+    public:
+        /**
+         * @brief Constructs an empty MinMaxPyramid.
+         * @param baseBinSize Samples per level-0 bin (at least 1).
+         * @param fanout Bins of one level merged into a bin of the next (at least 2).
+         * @param levelCount Number of levels (at least 1).
+         * @param binsPerLevel Bins retained per level (at least 1).
+         */
+        MinMaxPyramid(size_t baseBinSize, size_t fanout, size_t levelCount, size_t binsPerLevel);
+
+        /**
+         * @brief Destructor.
+         */
+        ~MinMaxPyramid();
+
+        MinMaxPyramid(const MinMaxPyramid &) = delete;
+
+        MinMaxPyramid &operator=(const MinMaxPyramid &) = delete;
+
+        MinMaxPyramid(MinMaxPyramid &&) = delete;
+
+        MinMaxPyramid &operator=(MinMaxPyramid &&) = delete;
+
+        /**
+         * @brief Appends samples to the envelope. Never allocates.
+         * @param samples New samples, oldest first.
+         */
+        void Push(std::span<const float> samples) noexcept;
+
+        /**
+         * @brief Computes one min/max pair per screen column for the most recent samples.
+         *
+         * Columns are ordered oldest to newest and the newest column includes samples that have
+         * not yet filled a bin. Columns before the start of the retained history read as silence.
+         * @param spanSamples Number of most recent samples to cover.
+         * @param minimums Per-column minimums; its size is the column count.
+         * @param maximums Per-column maximums; must be at least as large as minimums.
+         * @return Number of columns written.
+         */
+        size_t GetEnvelope(uint64_t spanSamples, std::span<float> minimums, std::span<float> maximums) const noexcept;
+
+        /**
+         * @brief Discards all history.
+         */
+        void Reset() noexcept;
+
+        /**
+         * @brief Gets the total number of samples pushed since construction or Reset().
+         * @return Sample count.
+         */
+        uint64_t GetSampleCount() const noexcept;
+
+        /**
+         * @brief Gets the longest span the coarsest level can cover.
+         * @return Retained history in samples.
+         */
+        uint64_t GetHistoryCapacity() const noexcept;
+
+        /**
+         * @brief Gets the number of levels.
+         * @return Level count.
+         */
+        size_t GetLevelCount() const noexcept;
+
+        /**
+         * @brief Gets the number of samples summarized by one bin of a level.
+         * @param level Level index, 0 being the finest.
+         * @return Samples per bin.
+         */
+        uint64_t GetBinSize(size_t level) const noexcept;
+
+        /**
+         * @brief Gets the level GetEnvelope() reads for a span and column count.
+         * @param spanSamples Number of most recent samples to cover.
+         * @param columns Number of screen columns.
+         * @return Level index.
+         */
+        size_t SelectLevel(uint64_t spanSamples, size_t columns) const noexcept;
+
+    private:
+        /**
+         * @brief One resolution of the pyramid.
+         */
+        struct Level
+        {
+            uint64_t binSize;            ///< Samples per bin.
+            size_t unitsPerBin;          ///< Samples (level 0) or lower-level bins merged per bin.
+            std::vector<float> minimums; ///< Ring of bin minimums.
+            std::vector<float> maximums; ///< Ring of bin maximums.
+            uint64_t completedBins;      ///< Bins completed since Reset(); the next ring slot is this modulo size.
+            float partialMin;            ///< Minimum of the bin being filled.
+            float partialMax;            ///< Maximum of the bin being filled.
+            size_t partialUnits;         ///< Units merged into the bin being filled.
+        };
+
+        /**
+         * @brief Stores a completed bin and merges it into the next level.
+         * @param levelIndex Level receiving the bin.
+         * @param minimum Bin minimum.
+         * @param maximum Bin maximum.
+         */
+        void CompleteBin(size_t levelIndex, float minimum, float maximum) noexcept;
+
+        std::vector<Level> levels; ///< Levels from finest to coarsest.
+        size_t binsPerLevel;       ///< Ring size of every level.
+        uint64_t sampleCount;      ///< Samples pushed since Reset().
+    };
+
+} // namespace GuitarDiagnostics::Util
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief A bounded multi-producer, single-consumer lock-free queue.
+     *
+     * Every slot carries a sequence number that tells producers whether the slot is free for the
+     * lap they are on and tells the consumer whether the slot has been published. Producers claim
+     * a position with one compare-exchange and never wait for each other beyond retrying it; the
+     * consumer never writes the producers' index. All storage is allocated in the constructor, so
+     * pushing and popping neither allocate nor lock.
+     *
+     * @tparam T Element type; must be default constructible and move assignable.
+     */
+    template<typename T> class MpscQueue
+    {
+    public:
+        /**
+         * @brief Constructs the queue.
+         * @param capacity Minimum number of elements the queue can hold; rounded up to a power of two.
+         */
+        explicit MpscQueue(size_t capacity);
+
+        /**
+         * @brief Destructor.
+         */
+        ~MpscQueue() = default;
+
+        MpscQueue(const MpscQueue &) = delete;
+
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        MpscQueue(MpscQueue &&) = delete;
+
+        MpscQueue &operator=(MpscQueue &&) = delete;
+
+        /**
+         * @brief Appends an element. Safe to call from any number of threads.
+         * @param value Element to move in; left untouched if the queue is full.
+         * @return True if the element was queued, false if the queue is full.
+         */
+        bool TryPush(T &&value) noexcept;
+
+        /**
+         * @brief Removes the oldest element. Must only be called by one thread at a time.
+         * @param output Receives the element.
+         * @return True if an element was removed, false if the queue is empty.
+         */
+        bool TryPop(T &output) noexcept;
+
+        /**
+         * @brief Checks whether any element is waiting. Safe from any thread; exact only on the consumer.
+         * @return True if no published element is waiting.
+         */
+        bool IsEmpty() const noexcept;
+
+        /**
+         * @brief Gets the number of elements the queue can hold.
+         * @return Capacity after rounding.
+         */
+        size_t GetCapacity() const noexcept;
+
+    private:
+        /**
+         * @brief One element with its publication sequence.
+         */
+        struct Slot
+        {
+            std::atomic<size_t> sequence; ///< Position the slot is ready for; position + 1 once published.
+            T value;                      ///< Stored element.
+        };
+
+        const size_t mask;                          ///< Capacity - 1.
+        std::unique_ptr<Slot[]> slots;              ///< Storage.
+        alignas(64) std::atomic<size_t> enqueuePos; ///< Next position producers claim.
+        alignas(64) std::atomic<size_t> dequeuePos; ///< Next position the consumer reads, written only by it.
+    };
+
+    template<typename T>
+    MpscQueue<T>::MpscQueue(size_t capacity)
+        : mask(std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity) - 1), slots(std::make_unique<Slot[]>(mask + 1)),
+          enqueuePos(0), dequeuePos(0)
+    {
+        for (size_t i = 0; i <= mask; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template<typename T> bool MpscQueue<T>::TryPush(T &&value) noexcept
+    {
+        size_t position = enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot &slot = slots[position & mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (difference == 0)
+            {
+                // The slot is free for this lap; claim the position or retry with the winner's successor.
+                if (enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // The consumer has not freed this slot from the previous lap.
+            }
+            else
+            {
+                position = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename T> bool MpscQueue<T>::TryPop(T &output) noexcept
+    {
+        const size_t position = dequeuePos.load(std::memory_order_relaxed);
+        Slot &slot = slots[position & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+        {
+            return false;
+        }
+
+        output = std::move(slot.value);
+        slot.sequence.store(position + mask + 1, std::memory_order_release); // Free for the next lap.
+        dequeuePos.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    template<typename T> bool MpscQueue<T>::IsEmpty() const noexcept
+    {
+        const size_t position = dequeuePos.load(std::memory_order_acquire);
+        return slots[position & mask].sequence.load(std::memory_order_acquire) != position + 1;
+    }
+
+    template<typename T> size_t MpscQueue<T>::GetCapacity() const noexcept
+    {
+        return mask + 1;
+    }
+
+} // namespace GuitarDiagnostics::Util
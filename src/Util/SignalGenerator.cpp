@@ -0,0 +1,404 @@
+#include "Util/SignalGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+namespace GuitarDiagnostics::Util
+{
+
+    namespace
+    {
+        constexpr size_t g_kLaneMultiple = 8;       ///< Channel padding so inner loops fill AVX registers.
+        constexpr size_t g_kChunkFrames = 128;      ///< Frames rendered between oscillator resyncs.
+        constexpr float g_kMaxPartialRatio = 0.45f; ///< Partials above this fraction of fs are muted.
+
+        size_t PadToLanes(size_t count)
+        {
+            return (count + g_kLaneMultiple - 1) / g_kLaneMultiple * g_kLaneMultiple;
+        }
+    } // namespace
+
+    StringModelConfig::StringModelConfig()
+        : fundamental(110.0f), inharmonicity(1e-4f), numPartials(16), amplitude(0.5f), decayRate(1.5f),
+          decayPerPartial(0.5f), pluckPosition(0.13f)
+    {
+    }
+
+    BuzzConfig::BuzzConfig() : amplitude(0.0f), duration(0.3f), burstLength(0.002f)
+    {
+    }
+
+    SignalGenerator::SignalGenerator(float sampleRate, size_t numChannels, uint32_t maxPartials)
+        : sampleRate(sampleRate), numChannels(numChannels), laneStride(PadToLanes(std::max<size_t>(numChannels, 1))),
+          maxPartials(std::max<uint32_t>(maxPartials, 1)), activePartials(0),
+          partialFrequency(laneStride * this->maxPartials, 0.0f), partialAmplitude(laneStride * this->maxPartials, 0.0f),
+          partialDecay(laneStride * this->maxPartials, 0.0f), oscRe(laneStride * this->maxPartials, 0.0f),
+          oscIm(laneStride * this->maxPartials, 0.0f), rotRe(laneStride * this->maxPartials, 1.0f),
+          rotIm(laneStride * this->maxPartials, 0.0f), channelTime(laneStride, 0), periodPhase(laneStride, 0.0f),
+          periodIncrement(laneStride, 0.0f), noiseLevel(laneStride, 0.0f), noiseState(laneStride, 0),
+          buzzAmplitude(laneStride, 0.0f), buzzRemaining(laneStride, 0.0f), buzzWindow(laneStride, 0.0f),
+          burstEnvelope(laneStride, 0.0f), burstDecay(laneStride, 0.0f), mixBuffer(laneStride * g_kChunkFrames, 0.0f),
+          noiseActive(false)
+    {
+        for (size_t lane = 0; lane < laneStride; ++lane)
+        {
+            noiseState[lane] = 0x9E3779B9u * static_cast<uint32_t>(lane + 1) | 1u;
+        }
+    }
+
+    SignalGenerator::~SignalGenerator()
+    {
+    }
+
+    void SignalGenerator::SetString(size_t channel, const StringModelConfig &config)
+    {
+        if (channel >= numChannels)
+        {
+            return;
+        }
+
+        const float twoPi = 2.0f * std::numbers::pi_v<float>;
+        const bool plucked = config.pluckPosition > 0.0f;
+        const float pluckPosition = std::clamp(config.pluckPosition, 0.01f, 0.5f);
+        const float pluckNorm = std::sin(std::numbers::pi_v<float> * pluckPosition);
+        const uint32_t numPartials = std::min(config.numPartials, maxPartials);
+
+        for (uint32_t p = 0; p < maxPartials; ++p)
+        {
+            const size_t idx = p * laneStride + channel;
+            const float n = static_cast<float>(p + 1);
+            const float frequency = n * config.fundamental * std::sqrt(1.0f + config.inharmonicity * n * n);
+            const bool audible = p < numPartials && frequency < g_kMaxPartialRatio * sampleRate;
+
+            const float comb = plucked ? std::sin(n * std::numbers::pi_v<float> * pluckPosition) / pluckNorm : 1.0f;
+            const float decay = config.decayRate + config.decayPerPartial * static_cast<float>(p);
+            const float radius = std::exp(-decay / sampleRate);
+            const float omega = twoPi * frequency / sampleRate;
+
+            partialFrequency[idx] = frequency;
+            partialAmplitude[idx] = audible ? config.amplitude * comb / n : 0.0f;
+            partialDecay[idx] = decay;
+            rotRe[idx] = radius * std::cos(omega);
+            rotIm[idx] = radius * std::sin(omega);
+        }
+
+        periodIncrement[channel] = config.fundamental / sampleRate;
+
+        activePartials = 0;
+        for (uint32_t p = 0; p < maxPartials; ++p)
+        {
+            for (size_t lane = 0; lane < numChannels; ++lane)
+            {
+                if (partialAmplitude[p * laneStride + lane] != 0.0f)
+                {
+                    activePartials = p + 1;
+                }
+            }
+        }
+
+        Pluck(channel);
+    }
+
+    void SignalGenerator::SetBuzz(size_t channel, const BuzzConfig &config)
+    {
+        if (channel >= numChannels)
+        {
+            return;
+        }
+
+        buzzAmplitude[channel] = config.amplitude;
+        buzzWindow[channel] = config.duration * sampleRate;
+        buzzRemaining[channel] = buzzWindow[channel];
+        burstDecay[channel] = config.burstLength > 0.0f ? std::exp(-1.0f / (config.burstLength * sampleRate)) : 0.0f;
+        noiseActive = noiseActive || config.amplitude > 0.0f;
+    }
+
+    void SignalGenerator::SetNoiseLevel(size_t channel, float level)
+    {
+        if (channel >= numChannels)
+        {
+            return;
+        }
+
+        noiseLevel[channel] = level;
+        noiseActive = noiseActive || level > 0.0f;
+    }
+
+    void SignalGenerator::Pluck(size_t channel)
+    {
+        if (channel >= numChannels)
+        {
+            return;
+        }
+
+        channelTime[channel] = 0;
+        periodPhase[channel] = 0.0f;
+        buzzRemaining[channel] = buzzWindow[channel];
+        burstEnvelope[channel] = 0.0f;
+    }
+
+    void SignalGenerator::Render(std::span<float> output)
+    {
+        if (numChannels == 0)
+        {
+            return;
+        }
+
+        const size_t totalFrames = output.size() / numChannels;
+        size_t offset = 0;
+
+        while (offset < totalFrames)
+        {
+            const size_t frames = std::min(g_kChunkFrames, totalFrames - offset);
+
+            ResyncOscillators();
+            RenderChunk(frames);
+
+            for (size_t channel = 0; channel < numChannels; ++channel)
+            {
+                float *destination = output.data() + channel * totalFrames + offset;
+                for (size_t i = 0; i < frames; ++i)
+                {
+                    destination[i] = mixBuffer[i * laneStride + channel];
+                }
+                channelTime[channel] += frames;
+            }
+
+            offset += frames;
+        }
+    }
+
+    size_t SignalGenerator::GetNumChannels() const
+    {
+        return numChannels;
+    }
+
+    float SignalGenerator::GetSampleRate() const
+    {
+        return sampleRate;
+    }
+
+    void SignalGenerator::ResyncOscillators()
+    {
+        const double twoPi = 2.0 * std::numbers::pi;
+
+        for (uint32_t p = 0; p < activePartials; ++p)
+        {
+            for (size_t lane = 0; lane < numChannels; ++lane)
+            {
+                const size_t idx = p * laneStride + lane;
+                const double time = static_cast<double>(channelTime[lane]) / static_cast<double>(sampleRate);
+                const double cycles = static_cast<double>(partialFrequency[idx]) * time;
+                const double phase = twoPi * (cycles - std::floor(cycles));
+                const double envelope =
+                    static_cast<double>(partialAmplitude[idx]) * std::exp(-static_cast<double>(partialDecay[idx]) * time);
+
+                oscRe[idx] = static_cast<float>(envelope * std::cos(phase));
+                oscIm[idx] = static_cast<float>(envelope * std::sin(phase));
+            }
+        }
+    }
+
+    void SignalGenerator::RenderChunk(size_t frames)
+    {
+        std::fill(mixBuffer.begin(), mixBuffer.begin() + static_cast<std::ptrdiff_t>(frames * laneStride), 0.0f);
+
+        for (uint32_t p = 0; p < activePartials; ++p)
+        {
+            float *re = oscRe.data() + p * laneStride;
+            float *im = oscIm.data() + p * laneStride;
+            const float *wr = rotRe.data() + p * laneStride;
+            const float *wi = rotIm.data() + p * laneStride;
+
+            for (size_t i = 0; i < frames; ++i)
+            {
+                float *mix = mixBuffer.data() + i * laneStride;
+                for (size_t lane = 0; lane < laneStride; ++lane)
+                {
+                    const float nextRe = re[lane] * wr[lane] - im[lane] * wi[lane];
+                    const float nextIm = re[lane] * wi[lane] + im[lane] * wr[lane];
+                    mix[lane] += im[lane];
+                    re[lane] = nextRe;
+                    im[lane] = nextIm;
+                }
+            }
+        }
+
+        if (!noiseActive)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < frames; ++i)
+        {
+            float *mix = mixBuffer.data() + i * laneStride;
+            for (size_t lane = 0; lane < laneStride; ++lane)
+            {
+                uint32_t state = noiseState[lane];
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                noiseState[lane] = state;
+                const float noise = static_cast<float>(state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+
+                const float phase = periodPhase[lane] + periodIncrement[lane];
+                const bool wrapped = phase >= 1.0f;
+                periodPhase[lane] = wrapped ? phase - 1.0f : phase;
+
+                const bool buzzing = buzzRemaining[lane] > 0.0f;
+                burstEnvelope[lane] =
+                    (wrapped && buzzing) ? buzzAmplitude[lane] : burstEnvelope[lane] * burstDecay[lane];
+                buzzRemaining[lane] = std::max(buzzRemaining[lane] - 1.0f, -1.0f);
+
+                mix[lane] += noise * (noiseLevel[lane] + burstEnvelope[lane]);
+            }
+        }
+    }
+
+    KarplusStrongString::KarplusStrongString(float sampleRate, float frequency, float feedback, float dispersion)
+        : delayLine(), delayIndex(0), feedback(std::clamp(feedback, 0.0f, 0.99999f)), tuningCoeff(0.0f),
+          dispersionCoeff(-std::clamp(dispersion, 0.0f, 0.9f)), lastSample(0.0f), tuningState(0.0f),
+          dispersionState(0.0f)
+    {
+        // Loop delay budget: averaging filter (0.5) + dispersion allpass DC delay + integer line + tuning allpass.
+        const float loopDelay = sampleRate / std::max(frequency, 1.0f);
+        const float dispersionDelay = (1.0f - dispersionCoeff) / (1.0f + dispersionCoeff);
+        const float remaining = std::max(loopDelay - 0.5f - dispersionDelay, 2.1f);
+
+        const size_t integerDelay = static_cast<size_t>(std::floor(remaining - 0.1f));
+        const float fractionalDelay = remaining - static_cast<float>(integerDelay);
+
+        tuningCoeff = (1.0f - fractionalDelay) / (1.0f + fractionalDelay);
+        delayLine.assign(std::max<size_t>(integerDelay, 2), 0.0f);
+    }
+
+    KarplusStrongString::~KarplusStrongString()
+    {
+    }
+
+    void KarplusStrongString::Pluck(float amplitude, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-amplitude, amplitude);
+
+        float mean = 0.0f;
+        for (auto &sample : delayLine)
+        {
+            sample = dist(rng);
+            mean += sample;
+        }
+        mean /= static_cast<float>(delayLine.size());
+
+        for (auto &sample : delayLine)
+        {
+            sample -= mean;
+        }
+
+        delayIndex = 0;
+        lastSample = 0.0f;
+        tuningState = 0.0f;
+        dispersionState = 0.0f;
+    }
+
+    void KarplusStrongString::Render(std::span<float> output)
+    {
+        const size_t length = delayLine.size();
+
+        for (auto &sample : output)
+        {
+            const float delayed = delayLine[delayIndex];
+            const float averaged = 0.5f * (delayed + lastSample);
+            lastSample = delayed;
+
+            const float tuned = tuningCoeff * averaged + tuningState;
+            tuningState = averaged - tuningCoeff * tuned;
+
+            const float dispersed = dispersionCoeff * tuned + dispersionState;
+            dispersionState = tuned - dispersionCoeff * dispersed;
+
+            delayLine[delayIndex] = feedback * dispersed;
+            delayIndex = delayIndex + 1 == length ? 0 : delayIndex + 1;
+
+            sample = delayed;
+        }
+    }
+
+    std::vector<float> GenerateSine(float frequency, float sampleRate, size_t numSamples, float amplitude)
+    {
+        std::vector<float> buffer(numSamples);
+        const float twoPi = 2.0f * std::numbers::pi_v<float>;
+
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            float phase = twoPi * frequency * static_cast<float>(i) / sampleRate;
+            buffer[i] = amplitude * std::sin(phase);
+        }
+
+        return buffer;
+    }
+
+    std::vector<float> GenerateHarmonicTone(float fundamental, float sampleRate, size_t numSamples, size_t numHarmonics)
+    {
+        std::vector<float> buffer(numSamples, 0.0f);
+        const float twoPi = 2.0f * std::numbers::pi_v<float>;
+
+        for (size_t harmonic = 1; harmonic <= numHarmonics; ++harmonic)
+        {
+            float amplitude = 1.0f / static_cast<float>(harmonic);
+            float freq = fundamental * static_cast<float>(harmonic);
+
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                float phase = twoPi * freq * static_cast<float>(i) / sampleRate;
+                buffer[i] += amplitude * std::sin(phase);
+            }
+        }
+
+        if (!buffer.empty())
+        {
+            float maxVal = *std::max_element(buffer.begin(), buffer.end());
+            if (maxVal > 0.0f)
+            {
+                for (auto &sample : buffer)
+                {
+                    sample /= maxVal;
+                }
+            }
+        }
+
+        return buffer;
+    }
+
+    std::vector<float> GenerateWhiteNoise(size_t numSamples, float amplitude, uint32_t seed)
+    {
+        std::vector<float> buffer(numSamples);
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-amplitude, amplitude);
+
+        for (auto &sample : buffer)
+        {
+            sample = dist(rng);
+        }
+
+        return buffer;
+    }
+
+    std::vector<float> GeneratePluckedString(const StringModelConfig &config,
+        float sampleRate,
+        size_t numSamples,
+        const BuzzConfig &buzz,
+        float noiseLevel)
+    {
+        SignalGenerator generator(sampleRate, 1, std::max<uint32_t>(config.numPartials, 1));
+        generator.SetString(0, config);
+        generator.SetBuzz(0, buzz);
+        generator.SetNoiseLevel(0, noiseLevel);
+
+        std::vector<float> buffer(numSamples, 0.0f);
+        generator.Render(buffer);
+        return buffer;
+    }
+
+} // namespace GuitarDiagnostics::Util
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief Parameters of the additive stiff-string model.
+     *
+     * Partial n sits at f_n = n * f0 * sqrt(1 + B * n^2) and decays exponentially with
+     * rate decayRate + decayPerPartial * (n - 1). Its initial amplitude is
+     * amplitude * sin(n * pi * p) / (n * sin(pi * p)) for pluck position p, or amplitude / n
+     * when pluckPosition is 0.
+     */
+    struct StringModelConfig
+    {
+        float fundamental;     ///< Fundamental frequency f0 in Hz.
+        float inharmonicity;   ///< Stiffness coefficient B (0 for an ideal string).
+        uint32_t numPartials;  ///< Number of partials to synthesize.
+        float amplitude;       ///< Initial amplitude of the fundamental partial.
+        float decayRate;       ///< Amplitude decay rate of the fundamental in 1/s.
+        float decayPerPartial; ///< Additional decay rate per partial index in 1/s.
+        float pluckPosition;   ///< Relative pluck position along the string in (0, 0.5]; 0 disables the comb.
+
+        /**
+         * @brief Constructs a StringModelConfig for a plain A2 (110 Hz) string.
+         */
+        StringModelConfig();
+    };
+
+    /**
+     * @brief Parameters of synthetic fret buzz.
+     *
+     * A buzzing string slaps the fret once per vibration period; each contact is modelled as a
+     * broadband noise burst with exponential decay.
+     */
+    struct BuzzConfig
+    {
+        float amplitude;   ///< Peak amplitude of each burst (0 disables buzz).
+        float duration;    ///< Time after the pluck during which bursts occur, in seconds.
+        float burstLength; ///< Decay time constant of a single burst, in seconds.
+
+        /**
+         * @brief Constructs a BuzzConfig with buzz disabled.
+         */
+        BuzzConfig();
+    };
+
+    /**
+     * @brief Vectorized multi-channel synthetic guitar signal generator.
+     *
+     * Each channel is an independent stiff string rendered by a bank of recursive complex
+     * oscillators (one rotation per partial per sample) plus optional white noise and buzz bursts.
+     * State is stored as structure-of-arrays with channels in the innermost, contiguous dimension,
+     * so the per-sample loops vectorize across channels. Oscillators are re-anchored to the exact
+     * analytic phase and envelope at the start of every chunk, so there is no long-term drift.
+     *
+     * All memory is allocated in the constructor; Render() does not allocate.
+     */
+    class SignalGenerator
+    {
+    public:
+        /**
+         * @brief Constructs the SignalGenerator.
+         * @param sampleRate Output sample rate in Hz.
+         * @param numChannels Number of independent strings to render.
+         * @param maxPartials Maximum partials per string.
+         */
+        SignalGenerator(float sampleRate, size_t numChannels, uint32_t maxPartials = 32);
+
+        /**
+         * @brief Destructor.
+         */
+        ~SignalGenerator();
+
+        SignalGenerator(const SignalGenerator &) = delete;
+
+        SignalGenerator &operator=(const SignalGenerator &) = delete;
+
+        SignalGenerator(SignalGenerator &&) noexcept = default;
+
+        SignalGenerator &operator=(SignalGenerator &&) noexcept = default;
+
+        /**
+         * @brief Configures the string model of a channel and re-plucks it.
+         * @param channel Channel index.
+         * @param config String model parameters.
+         */
+        void SetString(size_t channel, const StringModelConfig &config);
+
+        /**
+         * @brief Configures buzz bursts of a channel.
+         * @param channel Channel index.
+         * @param config Buzz parameters.
+         */
+        void SetBuzz(size_t channel, const BuzzConfig &config);
+
+        /**
+         * @brief Sets the additive white noise level of a channel.
+         * @param channel Channel index.
+         * @param level Peak noise amplitude.
+         */
+        void SetNoiseLevel(size_t channel, float level);
+
+        /**
+         * @brief Restarts the envelope (and buzz window) of a channel.
+         * @param channel Channel index.
+         */
+        void Pluck(size_t channel);
+
+        /**
+         * @brief Renders the next block of audio for all channels.
+         * @param output Planar output; channel c occupies [c * frames, (c + 1) * frames), where
+         *               frames = output.size() / GetNumChannels().
+         */
+        void Render(std::span<float> output);
+
+        /**
+         * @brief Gets the number of channels.
+         * @return Channel count.
+         */
+        size_t GetNumChannels() const;
+
+        /**
+         * @brief Gets the output sample rate.
+         * @return Sample rate in Hz.
+         */
+        float GetSampleRate() const;
+
+    private:
+        /**
+         * @brief Sets every oscillator to its exact analytic state at the current channel time.
+         */
+        void ResyncOscillators();
+
+        /**
+         * @brief Renders up to one chunk into the lane-major mix buffer.
+         * @param frames Number of frames to render.
+         */
+        void RenderChunk(size_t frames);
+
+        float sampleRate;        ///< Output sample rate in Hz.
+        size_t numChannels;      ///< Number of active channels.
+        size_t laneStride;       ///< Channel count padded to the SIMD lane multiple.
+        uint32_t maxPartials;    ///< Partials allocated per channel.
+        uint32_t activePartials; ///< Highest partial count with non-zero amplitude on any channel.
+
+        std::vector<float> partialFrequency; ///< [partial][lane] partial frequency in Hz.
+        std::vector<float> partialAmplitude; ///< [partial][lane] initial partial amplitude.
+        std::vector<float> partialDecay;     ///< [partial][lane] partial decay rate in 1/s.
+        std::vector<float> oscRe;            ///< [partial][lane] oscillator real part.
+        std::vector<float> oscIm;            ///< [partial][lane] oscillator imaginary part.
+        std::vector<float> rotRe;            ///< [partial][lane] per-sample rotation, real part.
+        std::vector<float> rotIm;            ///< [partial][lane] per-sample rotation, imaginary part.
+
+        std::vector<uint64_t> channelTime;  ///< [lane] samples since the last pluck.
+        std::vector<float> periodPhase;     ///< [lane] phase within the vibration period [0, 1).
+        std::vector<float> periodIncrement; ///< [lane] period phase increment per sample.
+        std::vector<float> noiseLevel;      ///< [lane] white noise amplitude.
+        std::vector<uint32_t> noiseState;   ///< [lane] xorshift generator state.
+        std::vector<float> buzzAmplitude;   ///< [lane] burst peak amplitude.
+        std::vector<float> buzzRemaining;   ///< [lane] samples left in the buzz window.
+        std::vector<float> buzzWindow;      ///< [lane] configured buzz window length in samples.
+        std::vector<float> burstEnvelope;   ///< [lane] current burst envelope.
+        std::vector<float> burstDecay;      ///< [lane] per-sample burst envelope multiplier.
+
+        std::vector<float> mixBuffer; ///< [frame][lane] chunk mix buffer.
+        bool noiseActive;             ///< True once any channel has noise or buzz enabled.
+    };
+
+    /**
+     * @brief Digital waveguide (Karplus-Strong) plucked string with dispersion.
+     *
+     * A delay line with a two-point averaging loss filter, a fractional-delay tuning allpass and
+     * an optional dispersion allpass that stretches upper partials like a stiff string.
+     */
+    class KarplusStrongString
+    {
+    public:
+        /**
+         * @brief Constructs the KarplusStrongString.
+         * @param sampleRate Output sample rate in Hz.
+         * @param frequency Fundamental frequency in Hz.
+         * @param feedback Loop gain per period in (0, 1); closer to 1 sustains longer.
+         * @param dispersion Dispersion allpass coefficient in [0, 0.9); 0 disables stiffness.
+         */
+        KarplusStrongString(float sampleRate, float frequency, float feedback, float dispersion);
+
+        /**
+         * @brief Destructor.
+         */
+        ~KarplusStrongString();
+
+        KarplusStrongString(const KarplusStrongString &) = default;
+
+        KarplusStrongString &operator=(const KarplusStrongString &) = default;
+
+        KarplusStrongString(KarplusStrongString &&) noexcept = default;
+
+        KarplusStrongString &operator=(KarplusStrongString &&) noexcept = default;
+
+        /**
+         * @brief Excites the string with a burst of white noise.
+         * @param amplitude Peak excitation amplitude.
+         * @param seed Noise seed.
+         */
+        void Pluck(float amplitude, uint32_t seed);
+
+        /**
+         * @brief Renders the next block of samples.
+         * @param output Destination buffer.
+         */
+        void Render(std::span<float> output);
+
+    private:
+        std::vector<float> delayLine; ///< Circular delay line (integer part of the loop delay).
+        size_t delayIndex;            ///< Current read/write position.
+        float feedback;               ///< Loop gain.
+        float tuningCoeff;            ///< Fractional delay allpass coefficient.
+        float dispersionCoeff;        ///< Dispersion allpass coefficient.
+        float lastSample;             ///< Previous delay line output for the averaging filter.
+        float tuningState;            ///< Tuning allpass state.
+        float dispersionState;        ///< Dispersion allpass state.
+    };
+
+    /**
+     * @brief Generates a pure sine wave.
+     * @param frequency Frequency in Hz.
+     * @param sampleRate Sample rate in Hz.
+     * @param numSamples Number of samples.
+     * @param amplitude Peak amplitude.
+     * @return Generated samples.
+     */
+    std::vector<float> GenerateSine(float frequency, float sampleRate, size_t numSamples, float amplitude = 1.0f);
+
+    /**
+     * @brief Generates a harmonic tone with 1/n partial amplitudes, normalized to unit peak.
+     * @param fundamental Fundamental frequency in Hz.
+     * @param sampleRate Sample rate in Hz.
+     * @param numSamples Number of samples.
+     * @param numHarmonics Number of harmonics including the fundamental.
+     * @return Generated samples.
+     */
+    std::vector<float> GenerateHarmonicTone(float fundamental,
+        float sampleRate,
+        size_t numSamples,
+        size_t numHarmonics = 5);
+
+    /**
+     * @brief Generates uniformly distributed white noise.
+     * @param numSamples Number of samples.
+     * @param amplitude Peak amplitude.
+     * @param seed Random seed.
+     * @return Generated samples.
+     */
+    std::vector<float> GenerateWhiteNoise(size_t numSamples, float amplitude = 0.1f, uint32_t seed = 42);
+
+    /**
+     * @brief Renders a single plucked note with the stiff-string model.
+     * @param config String model parameters.
+     * @param sampleRate Sample rate in Hz.
+     * @param numSamples Number of samples.
+     * @param buzz Buzz parameters.
+     * @param noiseLevel Additive white noise amplitude.
+     * @return Generated samples.
+     */
+    std::vector<float> GeneratePluckedString(const StringModelConfig &config,
+        float sampleRate,
+        size_t numSamples,
+        const BuzzConfig &buzz = BuzzConfig(),
+        float noiseLevel = 0.0f);
+
+} // namespace GuitarDiagnostics::Util
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace GuitarDiagnostics::Util
+{
+
+    /**
+     * @brief Vector with a fixed capacity whose elements live inside the object.
+     *
+     * Used for small per-hop frames such as harmonic magnitudes and peak frequencies, whose size
+     * is chosen at run time but bounded at compile time. The elements are stored inline and start
+     * on a cache line, so a frame on the stack never allocates, stays in L1 and can be loaded with
+     * aligned vector instructions. Every slot is constructed up front; GetSize() only tracks how
+     * many of them are in use.
+     *
+     * @tparam T Element type; must be default constructible.
+     * @tparam N Capacity in elements.
+     */
+    template<typename T, size_t N> class StaticVector
+    {
+    public:
+        static_assert(N > 0, "StaticVector needs a capacity of at least one element");
+        static_assert(std::is_default_constructible_v<T>, "StaticVector constructs every slot up front");
+
+        static constexpr size_t g_kAlignment = 64; ///< Alignment of the element storage, one cache line.
+
+        /**
+         * @brief Constructs an empty StaticVector.
+         */
+        StaticVector() noexcept;
+
+        /**
+         * @brief Appends an element.
+         * @param value Element to append.
+         * @return True if the element was appended, false if the vector is full.
+         */
+        bool PushBack(const T &value) noexcept;
+
+        /**
+         * @brief Changes the number of elements; new elements are value-initialized.
+         * @param size New size.
+         * @return True if resized, false if size exceeds the capacity (the vector is unchanged).
+         */
+        bool Resize(size_t size) noexcept;
+
+        /**
+         * @brief Removes all elements.
+         */
+        void Clear() noexcept;
+
+        /**
+         * @brief Gets the number of elements.
+         * @return Element count.
+         */
+        size_t GetSize() const noexcept;
+
+        /**
+         * @brief Gets the maximum number of elements.
+         * @return Capacity N.
+         */
+        static constexpr size_t GetCapacity() noexcept
+        {
+            return N;
+        }
+
+        /**
+         * @brief Checks if the vector holds no elements.
+         * @return True if empty.
+         */
+        bool IsEmpty() const noexcept;
+
+        /**
+         * @brief Checks if the vector is at capacity.
+         * @return True if full.
+         */
+        bool IsFull() const noexcept;
+
+        /**
+         * @brief Accesses an element without bounds checking.
+         * @param index Element index, less than GetSize().
+         * @return The element.
+         */
+        T &operator[](size_t index) noexcept;
+
+        /**
+         * @brief Accesses an element without bounds checking.
+         * @param index Element index, less than GetSize().
+         * @return The element.
+         */
+        const T &operator[](size_t index) const noexcept;
+
+        /**
+         * @brief Gets the used elements as a span.
+         * @return Span over the first GetSize() elements.
+         */
+        std::span<T> AsSpan() noexcept;
+
+        /**
+         * @brief Gets the used elements as a span.
+         * @return Span over the first GetSize() elements.
+         */
+        std::span<const T> AsSpan() const noexcept;
+
+        T *begin() noexcept;
+
+        T *end() noexcept;
+
+        const T *begin() const noexcept;
+
+        const T *end() const noexcept;
+
+    private:
+        alignas(g_kAlignment) std::array<T, N> elements; ///< Inline storage, all slots constructed.
+        size_t count;                                    ///< Elements in use.
+    };
+
+    template<typename T, size_t N> StaticVector<T, N>::StaticVector() noexcept : elements(), count(0)
+    {
+    }
+
+    template<typename T, size_t N> bool StaticVector<T, N>::PushBack(const T &value) noexcept
+    {
+        if (count == N)
+        {
+            return false;
+        }
+
+        elements[count++] = value;
+        return true;
+    }
+
+    template<typename T, size_t N> bool StaticVector<T, N>::Resize(size_t size) noexcept
+    {
+        if (size > N)
+        {
+            return false;
+        }
+
+        if (size > count)
+        {
+            std::fill(elements.begin() + count, elements.begin() + size, T());
+        }
+
+        count = size;
+        return true;
+    }
+
+    template<typename T, size_t N> void StaticVector<T, N>::Clear() noexcept
+    {
+        count = 0;
+    }
+
+    template<typename T, size_t N> size_t StaticVector<T, N>::GetSize() const noexcept
+    {
+        return count;
+    }
+
+    template<typename T, size_t N> bool StaticVector<T, N>::IsEmpty() const noexcept
+    {
+        return count == 0;
+    }
+
+    template<typename T, size_t N> bool StaticVector<T, N>::IsFull() const noexcept
+    {
+        return count == N;
+    }
+
+    template<typename T, size_t N> T &StaticVector<T, N>::operator[](size_t index) noexcept
+    {
+        return elements[index];
+    }
+
+    template<typename T, size_t N> const T &StaticVector<T, N>::operator[](size_t index) const noexcept
+    {
+        return elements[index];
+    }
+
+    template<typename T, size_t N> std::span<T> StaticVector<T, N>::AsSpan() noexcept
+    {
+        return std::span<T>(elements.data(), count);
+    }
+
+    template<typename T, size_t N> std::span<const T> StaticVector<T, N>::AsSpan() const noexcept
+    {
+        return std::span<const T>(elements.data(), count);
+    }
+
+    template<typename T, size_t N> T *StaticVector<T, N>::begin() noexcept
+    {
+        return elements.data();
+    }
+
+    template<typename T, size_t N> T *StaticVector<T, N>::end() noexcept
+    {
+        return elements.data() + count;
+    }
+
+    template<typename T, size_t N> const T *StaticVector<T, N>::begin() const noexcept
+    {
+        return elements.data();
+    }
+
+    template<typename T, size_t N> const T *StaticVector<T, N>::end() const noexcept
+    {
+        return elements.data() + count;
+    }
+
+} // namespace GuitarDiagnostics::Util
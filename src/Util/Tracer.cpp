@@ -0,0 +1,368 @@
+#include "Util/Tracer.h"
+
+#include <Logger.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+
+namespace GuitarDiagnostics::Util
+{
+
+    namespace
+    {
+        constexpr size_t g_kTraceThreadHeadroom = 8;                  ///< Buffers beyond one per core.
+        constexpr size_t g_kTraceEventsPerThread = size_t{ 1 } << 16; ///< Span capacity of each thread buffer.
+        constexpr int g_kTraceProcessId = 1;                          ///< Process id written to the trace.
+    } // namespace
+
+    /**
+     * @brief A completed span.
+     */
+    struct TraceEvent
+    {
+        const char *category; ///< Span category.
+        const char *name;     ///< Span name.
+        uint64_t start;       ///< Start time in nanoseconds.
+        uint64_t duration;    ///< Duration in nanoseconds.
+    };
+
+    /**
+     * @brief Span storage of one thread. Written only by the claiming thread.
+     */
+    struct TraceThreadBuffer
+    {
+        std::unique_ptr<TraceEvent[]> events; ///< Fixed-capacity event storage.
+        std::atomic<size_t> count;            ///< Published event count.
+        std::atomic<uint64_t> dropped;        ///< Spans dropped because the buffer was full.
+        std::atomic<uint64_t> session;        ///< Session the events belong to.
+        std::atomic<uint32_t> threadId;       ///< Trace thread id.
+        std::atomic<const char *> threadName; ///< Thread name, or nullptr.
+        std::atomic<bool> claimed;            ///< Owned by a live thread.
+    };
+
+    namespace
+    {
+        /**
+         * @brief Per-thread handle to the claimed buffer; releases it when the thread exits.
+         */
+        struct ThreadSlot
+        {
+            TraceThreadBuffer *buffer; ///< Claimed buffer, or nullptr.
+            const char *name;          ///< Name to apply when a buffer is claimed.
+
+            ~ThreadSlot()
+            {
+                if (buffer)
+                {
+                    buffer->claimed.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        thread_local ThreadSlot g_threadSlot{ nullptr, nullptr };
+
+        void WriteJsonString(std::ostream &stream, const char *text)
+        {
+            stream << '"';
+            for (const char *c = text; *c != '\0'; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                {
+                    stream << '\\' << *c;
+                }
+                else if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    stream << ' ';
+                }
+                else
+                {
+                    stream << *c;
+                }
+            }
+            stream << '"';
+        }
+    } // namespace
+
+    Tracer &Tracer::Get()
+    {
+        static Tracer instance;
+        return instance;
+    }
+
+    Tracer::Tracer()
+        : buffers(nullptr),
+          bufferCount(std::max<size_t>(1, std::thread::hardware_concurrency()) + g_kTraceThreadHeadroom),
+          recording(false), session(0), sessionStart(0), nextThreadId(1), droppedThreads(0), startMutex()
+    {
+    }
+
+    Tracer::~Tracer()
+    {
+    }
+
+    void Tracer::Start()
+    {
+        std::lock_guard<std::mutex> lock(startMutex);
+
+        if (!buffers)
+        {
+            buffers = std::make_unique<TraceThreadBuffer[]>(bufferCount);
+            for (size_t i = 0; i < bufferCount; ++i)
+            {
+                buffers[i].events = std::make_unique<TraceEvent[]>(g_kTraceEventsPerThread);
+            }
+        }
+
+        droppedThreads.store(0, std::memory_order_relaxed);
+        sessionStart.store(Now(), std::memory_order_relaxed);
+        session.fetch_add(1, std::memory_order_acq_rel);
+        recording.store(true, std::memory_order_release);
+    }
+
+    void Tracer::Stop() noexcept
+    {
+        recording.store(false, std::memory_order_release);
+    }
+
+    size_t Tracer::GetThreadCapacity() const noexcept
+    {
+        return bufferCount;
+    }
+
+    bool Tracer::IsRecording() const noexcept
+    {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Tracer::Now() noexcept
+    {
+        const auto sinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch).count());
+    }
+
+    void Tracer::Record(const char *category,
+        const char *name,
+        uint64_t startNanoseconds,
+        uint64_t endNanoseconds) noexcept
+    {
+        if (!recording.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        if (!g_threadSlot.buffer)
+        {
+            g_threadSlot.buffer = AcquireBuffer();
+            if (!g_threadSlot.buffer)
+            {
+                droppedThreads.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        TraceThreadBuffer &buffer = *g_threadSlot.buffer;
+        const uint64_t currentSession = session.load(std::memory_order_acquire);
+        if (buffer.session.load(std::memory_order_relaxed) != currentSession)
+        {
+            buffer.count.store(0, std::memory_order_relaxed);
+            buffer.dropped.store(0, std::memory_order_relaxed);
+            buffer.session.store(currentSession, std::memory_order_release);
+        }
+
+        const size_t index = buffer.count.load(std::memory_order_relaxed);
+        if (index >= g_kTraceEventsPerThread)
+        {
+            buffer.dropped.store(buffer.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.events[index] = TraceEvent{ category, name, startNanoseconds, endNanoseconds - startNanoseconds };
+        buffer.count.store(index + 1, std::memory_order_release);
+    }
+
+    void Tracer::SetThreadName(const char *name) noexcept
+    {
+        g_threadSlot.name = name;
+        if (g_threadSlot.buffer)
+        {
+            g_threadSlot.buffer->threadName.store(name, std::memory_order_relaxed);
+        }
+    }
+
+    size_t Tracer::GetEventCount() const
+    {
+        if (!buffers)
+        {
+            return 0;
+        }
+
+        const uint64_t currentSession = session.load(std::memory_order_acquire);
+        size_t total = 0;
+        for (size_t i = 0; i < bufferCount; ++i)
+        {
+            if (buffers[i].session.load(std::memory_order_acquire) == currentSession)
+            {
+                total += buffers[i].count.load(std::memory_order_acquire);
+            }
+        }
+        return total;
+    }
+
+    uint64_t Tracer::GetDroppedCount() const
+    {
+        uint64_t total = droppedThreads.load(std::memory_order_relaxed);
+        if (!buffers)
+        {
+            return total;
+        }
+
+        const uint64_t currentSession = session.load(std::memory_order_acquire);
+        for (size_t i = 0; i < bufferCount; ++i)
+        {
+            if (buffers[i].session.load(std::memory_order_acquire) == currentSession)
+            {
+                total += buffers[i].dropped.load(std::memory_order_relaxed);
+            }
+        }
+        return total;
+    }
+
+    void Tracer::WriteChromeTrace(std::ostream &stream) const
+    {
+        // Threads beyond the buffer count (e.g. many stations' audio callbacks) are missing from the trace.
+        const uint64_t threadlessSpans = droppedThreads.load(std::memory_order_relaxed);
+        if (threadlessSpans > 0)
+        {
+            LOG_ERROR("Trace is missing {} spans of threads beyond its {} thread buffers",
+                threadlessSpans,
+                bufferCount);
+        }
+
+        stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        if (!buffers)
+        {
+            stream << "]}\n";
+            return;
+        }
+
+        const uint64_t currentSession = session.load(std::memory_order_acquire);
+        const uint64_t origin = sessionStart.load(std::memory_order_relaxed);
+        bool first = true;
+
+        stream << std::fixed << std::setprecision(3);
+
+        for (size_t i = 0; i < bufferCount; ++i)
+        {
+            const TraceThreadBuffer &buffer = buffers[i];
+            if (buffer.session.load(std::memory_order_acquire) != currentSession)
+            {
+                continue;
+            }
+
+            const size_t count = buffer.count.load(std::memory_order_acquire);
+            if (count == 0)
+            {
+                continue;
+            }
+
+            const uint32_t threadId = buffer.threadId.load(std::memory_order_relaxed);
+            const char *threadName = buffer.threadName.load(std::memory_order_relaxed);
+            const std::string fallbackName = "Thread " + std::to_string(threadId);
+
+            stream << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << g_kTraceProcessId
+                   << ",\"tid\":" << threadId << ",\"args\":{\"name\":";
+            WriteJsonString(stream, threadName ? threadName : fallbackName.c_str());
+            stream << "}}";
+            first = false;
+
+            for (size_t j = 0; j < count; ++j)
+            {
+                const TraceEvent &event = buffer.events[j];
+                if (event.start < origin)
+                {
+                    continue;
+                }
+
+                stream << ",\n{\"name\":";
+                WriteJsonString(stream, event.name);
+                stream << ",\"cat\":";
+                WriteJsonString(stream, event.category);
+                stream << ",\"ph\":\"X\",\"pid\":" << g_kTraceProcessId << ",\"tid\":" << threadId
+                       << ",\"ts\":" << static_cast<double>(event.start - origin) / 1000.0
+                       << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << "}";
+            }
+        }
+
+        stream << "\n]}\n";
+    }
+
+    bool Tracer::WriteChromeTrace(const std::string &path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            LOG_ERROR("Failed to open trace file: {}", path);
+            return false;
+        }
+
+        WriteChromeTrace(file);
+
+        if (!file)
+        {
+            LOG_ERROR("Failed to write trace file: {}", path);
+            return false;
+        }
+
+        LOG_INFO("Wrote trace with {} events to {}", GetEventCount(), path);
+        return true;
+    }
+
+    TraceThreadBuffer *Tracer::AcquireBuffer() noexcept
+    {
+        const uint64_t currentSession = session.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i < bufferCount; ++i)
+        {
+            TraceThreadBuffer &buffer = buffers[i];
+
+            // Keep events of threads that exited during the current trace.
+            if (buffer.claimed.load(std::memory_order_relaxed)
+                || (buffer.session.load(std::memory_order_acquire) == currentSession
+                    && buffer.count.load(std::memory_order_relaxed) > 0))
+            {
+                continue;
+            }
+
+            bool expected = false;
+            if (buffer.claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            {
+                buffer.count.store(0, std::memory_order_relaxed);
+                buffer.dropped.store(0, std::memory_order_relaxed);
+                buffer.threadId.store(nextThreadId.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+                buffer.threadName.store(g_threadSlot.name, std::memory_order_relaxed);
+                buffer.session.store(currentSession, std::memory_order_release);
+                return &buffer;
+            }
+        }
+
+        return nullptr;
+    }
+
+    TraceScope::TraceScope(const char *category, const char *name) noexcept
+        : category(category), name(name), start(Tracer::Get().IsRecording() ? Tracer::Now() : 0)
+    {
+    }
+
+    TraceScope::~TraceScope()
+    {
+        if (start != 0)
+        {
+            Tracer::Get().Record(category, name, start, Tracer::Now());
+        }
+    }
+
+} // namespace GuitarDiagnostics::Util
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#ifndef GD_ENABLE_TRACING
+#define GD_ENABLE_TRACING 1
+#endif
+
+namespace GuitarDiagnostics::Util
+{
+
+    struct TraceThreadBuffer;
+
+    /**
+     * @brief Process-wide recorder of scoped timing spans, exported as Chrome Trace Event JSON.
+     *
+     * Each thread records into its own fixed-size buffer, claimed on first use, so recording is
+     * lock-free and allocation-free once Start() has run and safe on the audio callback. Span
+     * names and categories are stored as pointers and must outlive the trace; string literals are
+     * the intended use. Spans beyond a buffer's capacity are dropped and counted.
+     *
+     * Open the exported file in chrome://tracing or https://ui.perfetto.dev. Use the
+     * GD_TRACE_SCOPE and GD_TRACE_THREAD_NAME macros, which compile to nothing when the build sets
+     * GD_ENABLE_TRACING to 0.
+     */
+    class Tracer
+    {
+    public:
+        /**
+         * @brief Gets the process-wide tracer.
+         * @return Tracer instance.
+         */
+        static Tracer &Get();
+
+        /**
+         * @brief Destructor.
+         */
+        ~Tracer();
+
+        Tracer(const Tracer &) = delete;
+
+        Tracer &operator=(const Tracer &) = delete;
+
+        Tracer(Tracer &&) = delete;
+
+        Tracer &operator=(Tracer &&) = delete;
+
+        /**
+         * @brief Begins a new trace, discarding events of the previous one.
+         *
+         * Allocates the per-thread buffers on the first call.
+         */
+        void Start();
+
+        /**
+         * @brief Stops recording. Recorded events are kept until the next Start().
+         */
+        void Stop() noexcept;
+
+        /**
+         * @brief Checks whether spans are currently being recorded.
+         * @return True between Start() and Stop().
+         */
+        bool IsRecording() const noexcept;
+
+        /**
+         * @brief Gets the number of threads that can record at the same time.
+         *
+         * One buffer per hardware thread, for the analysis workers, plus headroom for the UI, main
+         * and audio callback threads. Spans of further threads are dropped and counted; exporting
+         * a trace logs them.
+         * @return Per-thread buffer count.
+         */
+        size_t GetThreadCapacity() const noexcept;
+
+        /**
+         * @brief Gets the current time on the tracer's clock.
+         * @return Monotonic timestamp in nanoseconds.
+         */
+        static uint64_t Now() noexcept;
+
+        /**
+         * @brief Records a completed span on the calling thread.
+         * @param category Span category (e.g. "audio", "engine").
+         * @param name Span name.
+         * @param startNanoseconds Start time from Now().
+         * @param endNanoseconds End time from Now().
+         */
+        void Record(const char *category,
+            const char *name,
+            uint64_t startNanoseconds,
+            uint64_t endNanoseconds) noexcept;
+
+        /**
+         * @brief Names the calling thread in exported traces.
+         * @param name Thread name; must outlive the trace.
+         */
+        void SetThreadName(const char *name) noexcept;
+
+        /**
+         * @brief Gets the number of events recorded in the current trace.
+         * @return Event count.
+         */
+        size_t GetEventCount() const;
+
+        /**
+         * @brief Gets the number of spans dropped in the current trace.
+         * @return Dropped span count.
+         */
+        uint64_t GetDroppedCount() const;
+
+        /**
+         * @brief Writes the current trace as Chrome Trace Event JSON.
+         * @param stream Output stream.
+         */
+        void WriteChromeTrace(std::ostream &stream) const;
+
+        /**
+         * @brief Writes the current trace as Chrome Trace Event JSON to a file.
+         * @param path Output file path.
+         * @return True if the file was written.
+         */
+        bool WriteChromeTrace(const std::string &path) const;
+
+    private:
+        /**
+         * @brief Constructs an idle tracer without buffers.
+         */
+        Tracer();
+
+        /**
+         * @brief Claims a free per-thread buffer for the calling thread.
+         * @return Claimed buffer, or nullptr if all buffers are in use.
+         */
+        TraceThreadBuffer *AcquireBuffer() noexcept;
+
+        std::unique_ptr<TraceThreadBuffer[]> buffers; ///< Per-thread buffers, allocated by the first Start().
+        size_t bufferCount;                           ///< Number of buffers, fixed at construction.
+        std::atomic<bool> recording;                  ///< Recording flag.
+        std::atomic<uint64_t> session;                ///< Incremented by every Start().
+        std::atomic<uint64_t> sessionStart;           ///< Now() at the last Start().
+        std::atomic<uint32_t> nextThreadId;           ///< Trace thread id of the next claimed buffer.
+        std::atomic<uint64_t> droppedThreads;         ///< Spans dropped because no buffer was free.
+        std::mutex startMutex;                        ///< Serializes Start().
+    };
+
+    /**
+     * @brief RAII span that records its lifetime into the Tracer.
+     *
+     * Costs one relaxed load when the tracer is not recording.
+     */
+    class TraceScope
+    {
+    public:
+        /**
+         * @brief Opens a span.
+         * @param category Span category; must outlive the trace.
+         * @param name Span name; must outlive the trace.
+         */
+        TraceScope(const char *category, const char *name) noexcept;
+
+        /**
+         * @brief Closes the span and records it.
+         */
+        ~TraceScope();
+
+        TraceScope(const TraceScope &) = delete;
+
+        TraceScope &operator=(const TraceScope &) = delete;
+
+        TraceScope(TraceScope &&) = delete;
+
+        TraceScope &operator=(TraceScope &&) = delete;
+
+    private:
+        const char *category; ///< Span category.
+        const char *name;     ///< Span name.
+        uint64_t start;       ///< Start time, or 0 if the tracer was not recording.
+    };
+
+} // namespace GuitarDiagnostics::Util
+
+#if GD_ENABLE_TRACING
+#define GD_TRACE_CONCAT_IMPL(a, b) a##b
+#define GD_TRACE_CONCAT(a, b) GD_TRACE_CONCAT_IMPL(a, b)
+#define GD_TRACE_SCOPE(category, name)                                                                                 \
+    ::GuitarDiagnostics::Util::TraceScope GD_TRACE_CONCAT(gdTraceScope, __LINE__)(category, name)
+#define GD_TRACE_THREAD_NAME(name) ::GuitarDiagnostics::Util::Tracer::Get().SetThreadName(name)
+#else
+#define GD_TRACE_SCOPE(category, name) static_cast<void>(0)
+#define GD_TRACE_THREAD_NAME(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/AnalysisClock.h"
+#include "Analysis/Analyzer.h"
+
+#include <chrono>
+
+using namespace GuitarDiagnostics::Analysis;
+
+TEST(AnalysisClockTest, ConfigDefaultsToSteadyClock)
+{
+    AnalysisConfig config(48000.0f, 512);
+    EXPECT_EQ(config.clock, &SteadyClock::GetInstance());
+
+    ManualClock clock;
+    EXPECT_EQ(AnalysisConfig(48000.0f, 512, &clock).clock, &clock);
+}
+
+TEST(AnalysisClockTest, SteadyClockIsMonotonicAndIgnoresHops)
+{
+    SteadyClock &clock = SteadyClock::GetInstance();
+    const auto first = clock.Now();
+    clock.OnHop(48000);
+    EXPECT_GE(clock.Now(), first);
+    EXPECT_LT(clock.Now() - first, std::chrono::seconds(1));
+}
+
+TEST(AnalysisClockTest, SampleClockCountsProcessedFrames)
+{
+    SampleClock clock(48000.0f);
+    EXPECT_EQ(clock.Now(), std::chrono::nanoseconds(0));
+
+    clock.OnHop(24000);
+    EXPECT_EQ(clock.Now(), std::chrono::milliseconds(500));
+
+    clock.OnHop(1);
+    EXPECT_EQ(clock.GetFrames(), 24001u);
+    EXPECT_EQ(clock.Now(), std::chrono::nanoseconds(500020833));
+
+    clock.Reset();
+    EXPECT_EQ(clock.Now(), std::chrono::nanoseconds(0));
+}
+
+TEST(AnalysisClockTest, SampleClockStaysExactOverLongRuns)
+{
+    // One hour of 44.1 kHz audio in 10 ms hops lands on the hour, without accumulated rounding.
+    SampleClock clock(44100.0f);
+    const uint64_t frames = 44100ull * 3600ull;
+    for (uint64_t counted = 0; counted < frames; counted += 441)
+    {
+        clock.OnHop(441);
+    }
+    EXPECT_EQ(clock.Now(), std::chrono::hours(1));
+}
+
+TEST(AnalysisClockTest, ManualClockMovesOnlyWhenTold)
+{
+    ManualClock clock;
+    EXPECT_EQ(clock.Now(), std::chrono::nanoseconds(0));
+
+    clock.OnHop(48000);
+    EXPECT_EQ(clock.Now(), std::chrono::nanoseconds(0));
+
+    clock.Advance(std::chrono::milliseconds(250));
+    clock.Advance(std::chrono::milliseconds(250));
+    EXPECT_EQ(clock.Now(), std::chrono::milliseconds(500));
+
+    clock.Set(std::chrono::seconds(10));
+    EXPECT_EQ(clock.Now(), std::chrono::seconds(10));
+}
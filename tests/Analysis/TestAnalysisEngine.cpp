@@ -1,13 +1,17 @@
 #include <gtest/gtest.h>
 
 #include "Util/LockFreeRingBuffer.h"
+#include "Analysis/AnalysisClock.h"
 #include "Analysis/AnalysisEngine.h"
+#include "Util/AllocationGuard.h"
 
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <thread>
+#include <vector>
 
 using namespace GuitarDiagnostics::Analysis;
 using namespace GuitarDiagnostics::Util;
@@ -71,6 +75,23 @@ protected:
         }
         ringBuffer.reset();
     }
+
+    /**
+     * @brief Waits until the worker thread has processed a number of hops, instead of sleeping a guessed time.
+     */
+    bool WaitForHops(uint64_t hops)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (engine->GetResultSequence() < hops)
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
 };
 
 TEST_F(AnalysisEngineTest, CreateInstance)
@@ -133,8 +154,7 @@ TEST_F(AnalysisEngineTest, ProcessAudioData)
 
     ASSERT_TRUE(ringBuffer->Write(testData));
 
-    // Give engine time to process
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(WaitForHops(1));
 
     engine->Stop();
 }
@@ -184,8 +204,7 @@ TEST_F(AnalysisEngineTest, RegisterAnalyzer)
     testData.fill(0.5f);
     ringBuffer->Write(testData);
 
-    // Give time to process
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(WaitForHops(1));
 
     // Analyzer should have processed data
     EXPECT_TRUE(analyzer->processed);
@@ -212,8 +231,7 @@ TEST_F(AnalysisEngineTest, MultipleAnalyzers)
     testData.fill(0.5f);
     ringBuffer->Write(testData);
 
-    // Give time to process
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(WaitForHops(1));
 
     // All analyzers should have processed
     EXPECT_GT(analyzer1->processCount.load(), 0);
@@ -222,3 +240,383 @@ TEST_F(AnalysisEngineTest, MultipleAnalyzers)
 
     engine->Stop();
 }
+
+TEST_F(AnalysisEngineTest, ResultSequenceAdvancesPerHop)
+{
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), config);
+    engine->RegisterAnalyzer(std::make_shared<CountingAnalyzer>());
+
+    uint64_t notifiedSequence = 0;
+    engine->SetResultListener([&notifiedSequence](uint64_t resultSequence) { notifiedSequence = resultSequence; });
+
+    EXPECT_EQ(engine->GetResultSequence(), 0u);
+    EXPECT_FALSE(engine->ProcessNextBlock());
+    EXPECT_EQ(engine->GetResultSequence(), 0u);
+
+    std::array<float, 1024> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(engine->GetResultSequence(), 2u);
+    EXPECT_EQ(notifiedSequence, 2u);
+}
+
+TEST_F(AnalysisEngineTest, ResamplesInputToAnalysisRate)
+{
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), config);
+    auto analyzer = std::make_shared<CountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+
+    EXPECT_FALSE(engine->SetInputSampleRate(44101.0f));
+    ASSERT_TRUE(engine->SetInputSampleRate(96000.0f));
+
+    // 2048 samples at 96 kHz are 1024 at 48 kHz: exactly two hops.
+    std::array<float, 2048> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+
+    EXPECT_TRUE(engine->ProcessNextBlock());
+    EXPECT_TRUE(engine->ProcessNextBlock());
+    EXPECT_FALSE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->processCount.load(), 2);
+}
+
+TEST_F(AnalysisEngineTest, AdvancesClockByProcessedAudio)
+{
+    SampleClock clock(48000.0f);
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), AnalysisConfig(48000.0f, 512, &clock));
+
+    class ClockReadingAnalyzer : public CountingAnalyzer
+    {
+    public:
+        const AnalysisClock *clock = nullptr;
+        std::chrono::nanoseconds lastSeen{ 0 };
+
+        void Configure(const AnalysisConfig &config) override
+        {
+            clock = config.clock;
+        }
+
+        void ProcessBuffer(std::span<const float> audioData) override
+        {
+            CountingAnalyzer::ProcessBuffer(audioData);
+            lastSeen = clock->Now();
+        }
+    };
+
+    auto analyzer = std::make_shared<ClockReadingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+    EXPECT_EQ(analyzer->clock, &clock);
+
+    std::array<float, 1536> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+
+    // Three hops of 512 frames at 48 kHz are 32 ms, however long processing takes; analyzers see the hop's end.
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->lastSeen, std::chrono::nanoseconds(10666667));
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(clock.GetFrames(), 1536u);
+    EXPECT_EQ(clock.Now(), std::chrono::milliseconds(32));
+    EXPECT_EQ(analyzer->lastSeen, clock.Now());
+}
+
+TEST_F(AnalysisEngineTest, CommandsRunOnCallingThreadWhileStopped)
+{
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), config);
+    auto analyzer = std::make_shared<CountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+
+    std::array<float, 512> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    ASSERT_EQ(analyzer->processCount.load(), 1);
+
+    auto completion = engine->Reset();
+    ASSERT_EQ(completion.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(completion.get());
+    EXPECT_EQ(analyzer->processCount.load(), 0);
+}
+
+TEST_F(AnalysisEngineTest, DisabledAnalyzerSkipsHops)
+{
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), config);
+    auto first = std::make_shared<CountingAnalyzer>();
+    auto second = std::make_shared<CountingAnalyzer>();
+    engine->RegisterAnalyzer(first);
+    engine->RegisterAnalyzer(second);
+
+    EXPECT_TRUE(engine->SetAnalyzerEnabled(0, false).get());
+    EXPECT_FALSE(engine->SetAnalyzerEnabled(2, false).get());
+
+    std::array<float, 1024> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+    ASSERT_TRUE(engine->ProcessNextBlock());
+
+    EXPECT_TRUE(engine->SetAnalyzerEnabled(0, true).get());
+    ASSERT_TRUE(engine->ProcessNextBlock());
+
+    EXPECT_EQ(first->processCount.load(), 1);
+    EXPECT_EQ(second->processCount.load(), 2);
+    EXPECT_EQ(engine->GetResultSequence(), 2u);
+}
+
+TEST_F(AnalysisEngineTest, CommandsFromManyThreadsRunOnWorker)
+{
+    class ParameterCountingAnalyzer : public CountingAnalyzer
+    {
+    public:
+        std::atomic<int> applyCount{ 0 };
+
+        void ApplyParameters(const AnalyzerParameters &) override
+        {
+            applyCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), config);
+    auto analyzer = std::make_shared<ParameterCountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+    ASSERT_TRUE(engine->Start());
+
+    constexpr int threadCount = 4;
+    constexpr int commandsPerThread = 50;
+    const AnalyzerParameters parameters;
+    std::atomic<int> acknowledged{ 0 };
+
+    std::vector<std::thread> controllers;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        controllers.emplace_back([&]() {
+            for (int i = 0; i < commandsPerThread; ++i)
+            {
+                // Callers that need the acknowledgement wait on the future; the worker never waits on them.
+                auto completion = engine->ApplyParameters(&parameters);
+                if (completion.wait_for(std::chrono::seconds(5)) == std::future_status::ready && completion.get())
+                {
+                    acknowledged.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto &thread : controllers)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(acknowledged.load(), threadCount * commandsPerThread);
+    EXPECT_EQ(analyzer->applyCount.load(), threadCount * commandsPerThread);
+    EXPECT_FALSE(engine->ApplyParameters(nullptr).get());
+
+    engine->Stop();
+}
+
+TEST_F(AnalysisEngineTest, FastPathRunsEveryFastBlockAndHopOnceComplete)
+{
+    class FastCountingAnalyzer : public CountingAnalyzer
+    {
+    public:
+        int fastBlockCount = 0;
+        size_t lastFastBlockSize = 0;
+
+        void ProcessFastBlock(std::span<const float> block) override
+        {
+            ++fastBlockCount;
+            lastFastBlockSize = block.size();
+        }
+    };
+
+    SampleClock clock(48000.0f);
+    AnalysisConfig fastConfig(48000.0f, 512, &clock);
+    fastConfig.fastBlockSize = 64;
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), fastConfig);
+    auto analyzer = std::make_shared<FastCountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+    EXPECT_LT(engine->GetIdlePollInterval(), std::chrono::milliseconds(1));
+
+    // A small device callback is analyzed on the fast path before a full hop is buffered.
+    std::array<float, 64> callback;
+    callback.fill(0.5f);
+    ringBuffer->Write(callback);
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->fastBlockCount, 1);
+    EXPECT_EQ(analyzer->lastFastBlockSize, 64u);
+    EXPECT_EQ(analyzer->processCount.load(), 0);
+    EXPECT_EQ(engine->GetResultSequence(), 0u);
+    EXPECT_EQ(clock.GetFrames(), 64u);
+    EXPECT_FALSE(engine->ProcessNextBlock());
+
+    // The rest of the hop arrives as one larger callback plus a partial block that has to wait.
+    std::array<float, 480> rest;
+    rest.fill(0.5f);
+    ringBuffer->Write(rest);
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->fastBlockCount, 8);
+    EXPECT_EQ(analyzer->processCount.load(), 1);
+    EXPECT_EQ(engine->GetResultSequence(), 1u);
+    EXPECT_EQ(clock.GetFrames(), 512u);
+
+    EXPECT_FALSE(engine->ProcessNextBlock());
+    ringBuffer->Write(std::span<const float>(callback.data(), 32));
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->fastBlockCount, 9);
+}
+
+TEST_F(AnalysisEngineTest, FastPathResamplesSmallCallbacks)
+{
+    class FastCountingAnalyzer : public CountingAnalyzer
+    {
+    public:
+        std::atomic<int> fastBlockCount{ 0 };
+
+        void ProcessFastBlock(std::span<const float>) override
+        {
+            fastBlockCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    AnalysisConfig fastConfig(48000.0f, 512);
+    fastConfig.fastBlockSize = 64;
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), fastConfig);
+    auto analyzer = std::make_shared<FastCountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+    ASSERT_TRUE(engine->SetInputSampleRate(96000.0f));
+
+    // 1024 samples at 96 kHz are one 512-frame hop at 48 kHz; they arrive as 128-sample callbacks.
+    std::array<float, 128> callback;
+    callback.fill(0.5f);
+    int fastBlocksAfterFirstCallback = -1;
+    for (int i = 0; i < 8; ++i)
+    {
+        ringBuffer->Write(callback);
+        while (engine->ProcessNextBlock())
+        {
+        }
+        if (i == 0)
+        {
+            fastBlocksAfterFirstCallback = analyzer->fastBlockCount.load();
+        }
+    }
+
+    // The resampler's delay line may hold back a few frames, but never more than one fast block.
+    EXPECT_GE(fastBlocksAfterFirstCallback, 0);
+    EXPECT_LE(fastBlocksAfterFirstCallback, 1);
+    EXPECT_GE(analyzer->fastBlockCount.load(), 7);
+    EXPECT_LE(analyzer->processCount.load(), 1);
+}
+
+TEST_F(AnalysisEngineTest, FastBlockNotDividingHopIsDisabled)
+{
+    AnalysisConfig fastConfig(48000.0f, 512);
+    fastConfig.fastBlockSize = 100;
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), fastConfig);
+    auto analyzer = std::make_shared<CountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+    EXPECT_EQ(engine->GetIdlePollInterval(), std::chrono::milliseconds(1));
+
+    std::array<float, 100> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+    EXPECT_FALSE(engine->ProcessNextBlock());
+}
+
+TEST_F(AnalysisEngineTest, BatchesBufferedHops)
+{
+    class BatchCountingAnalyzer : public CountingAnalyzer
+    {
+    public:
+        int batchCount = 0;
+        size_t batchFrames = 0;
+
+        void ProcessBlocks(std::span<const float> samples, size_t hop) override
+        {
+            ++batchCount;
+            batchFrames += samples.size();
+            Analyzer::ProcessBlocks(samples, hop);
+        }
+    };
+
+    SampleClock clock(48000.0f);
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), AnalysisConfig(48000.0f, 512, &clock));
+    auto analyzer = std::make_shared<BatchCountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+    EXPECT_FALSE(engine->SetMaxBatchHops(0));
+    ASSERT_TRUE(engine->SetMaxBatchHops(4));
+
+    // Five and a half hops: one batch of four, then the single remaining hop on the live path.
+    std::array<float, 2816> testData;
+    testData.fill(0.5f);
+    ringBuffer->Write(testData);
+
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->batchCount, 1);
+    EXPECT_EQ(analyzer->batchFrames, 2048u);
+    EXPECT_EQ(analyzer->processCount.load(), 4);
+    EXPECT_EQ(engine->GetResultSequence(), 4u);
+    EXPECT_EQ(clock.GetFrames(), 2048u);
+
+    ASSERT_TRUE(engine->ProcessNextBlock());
+    EXPECT_EQ(analyzer->batchCount, 1);
+    EXPECT_EQ(analyzer->processCount.load(), 5);
+    EXPECT_EQ(engine->GetResultSequence(), 5u);
+    EXPECT_FALSE(engine->ProcessNextBlock());
+}
+
+TEST_F(AnalysisEngineTest, BatchingIsRejectedWithFastPath)
+{
+    AnalysisConfig fastConfig(48000.0f, 512);
+    fastConfig.fastBlockSize = 64;
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), fastConfig);
+
+    EXPECT_FALSE(engine->SetMaxBatchHops(8));
+    EXPECT_TRUE(engine->SetMaxBatchHops(1));
+}
+
+TEST_F(AnalysisEngineTest, ProcessNextBlockDoesNotAllocate)
+{
+    if (!AllocationGuard::IsEnabled())
+    {
+        GTEST_SKIP() << "Built without GD_ENABLE_ALLOCATION_GUARD";
+    }
+
+    engine = std::make_unique<AnalysisEngine>(ringBuffer.get(), config);
+    auto analyzer = std::make_shared<CountingAnalyzer>();
+    engine->RegisterAnalyzer(analyzer);
+
+    std::array<float, 1024> testData;
+    testData.fill(0.5f);
+
+    const auto previousPolicy = AllocationGuard::GetPolicy();
+    AllocationGuard::SetPolicy(AllocationGuard::Policy::Count);
+    AllocationGuard::ResetViolationCount();
+
+    // The whole call, command drain included, not just the hop scope inside it.
+    int idleHops = 0;
+    int hops = 0;
+    {
+        NoAllocationScope scope;
+        for (int i = 0; i < 1000; ++i)
+        {
+            idleHops += engine->ProcessNextBlock() ? 1 : 0;
+        }
+
+        ringBuffer->Write(testData);
+        while (engine->ProcessNextBlock())
+        {
+            ++hops;
+        }
+    }
+
+    const uint64_t violations = AllocationGuard::GetViolationCount();
+    AllocationGuard::SetPolicy(previousPolicy);
+
+    EXPECT_EQ(violations, 0u);
+    EXPECT_EQ(idleHops, 0);
+    EXPECT_EQ(hops, 2);
+    EXPECT_EQ(analyzer->processCount.load(), 2);
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/AnalysisWorkerPool.h"
+#include "Util/LockFreeRingBuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    /**
+     * @brief Counts blocks and checks that every sample carries the engine's own marker value.
+     */
+    class MarkerAnalyzer : public Analyzer
+    {
+    public:
+        std::atomic<int> processCount;
+        std::atomic<int> foreignSamples;
+        std::thread::id resetThread;
+        float marker;
+
+        explicit MarkerAnalyzer(float marker) : processCount(0), foreignSamples(0), resetThread(), marker(marker)
+        {
+        }
+
+        void Configure(const AnalysisConfig &) override
+        {
+        }
+
+        void ProcessBuffer(std::span<const float> audioData) override
+        {
+            for (float sample : audioData)
+            {
+                if (sample != marker)
+                {
+                    foreignSamples.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            processCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::shared_ptr<AnalysisResult> GetLatestResult() const override
+        {
+            return std::make_shared<AnalysisResult>();
+        }
+
+        void Reset() override
+        {
+            resetThread = std::this_thread::get_id();
+        }
+    };
+
+    /**
+     * @brief Ring, engine and analyzer of one simulated input.
+     */
+    struct TestPipeline
+    {
+        LockFreeRingBuffer<float> ringBuffer;
+        AnalysisEngine engine;
+        std::shared_ptr<MarkerAnalyzer> analyzer;
+
+        explicit TestPipeline(float marker)
+            : ringBuffer(8192), engine(&ringBuffer, AnalysisConfig(48000.0f, 512)),
+              analyzer(std::make_shared<MarkerAnalyzer>(marker))
+        {
+            engine.RegisterAnalyzer(analyzer);
+        }
+    };
+
+    bool WaitForHops(const std::vector<std::unique_ptr<TestPipeline>> &pipelines, const std::vector<uint64_t> &hops)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            bool done = true;
+            for (size_t i = 0; i < pipelines.size(); ++i)
+            {
+                done &= pipelines[i]->engine.GetResultSequence() >= hops[i];
+            }
+            if (done)
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+} // namespace
+
+TEST(AnalysisWorkerPoolTest, StartRequiresEngines)
+{
+    AnalysisWorkerPool pool(2);
+
+    EXPECT_FALSE(pool.Start());
+    EXPECT_FALSE(pool.IsRunning());
+}
+
+TEST(AnalysisWorkerPoolTest, ThreadCountLimitedByEngines)
+{
+    TestPipeline first(1.0f);
+    TestPipeline second(2.0f);
+    AnalysisWorkerPool pool(8);
+    pool.AddEngine(&first.engine);
+    pool.AddEngine(&second.engine);
+
+    EXPECT_EQ(pool.GetEngineCount(), 2u);
+    EXPECT_EQ(pool.GetThreadCount(), 2u);
+
+    AnalysisWorkerPool defaultPool(0);
+    defaultPool.AddEngine(&first.engine);
+    EXPECT_EQ(defaultPool.GetThreadCount(), 1u);
+}
+
+TEST(AnalysisWorkerPoolTest, EnginesStayIsolated)
+{
+    std::vector<std::unique_ptr<TestPipeline>> pipelines;
+    std::vector<uint64_t> hops;
+    AnalysisWorkerPool pool(2);
+    for (int i = 0; i < 4; ++i)
+    {
+        pipelines.push_back(std::make_unique<TestPipeline>(static_cast<float>(i + 1)));
+        pool.AddEngine(&pipelines.back()->engine);
+
+        // Engine i gets i + 1 blocks filled with its own marker.
+        std::vector<float> blocks(512 * static_cast<size_t>(i + 1), static_cast<float>(i + 1));
+        ASSERT_TRUE(pipelines.back()->ringBuffer.Write(blocks));
+        hops.push_back(static_cast<uint64_t>(i + 1));
+    }
+
+    ASSERT_TRUE(pool.Start());
+    EXPECT_FALSE(pool.Start());
+    EXPECT_TRUE(WaitForHops(pipelines, hops));
+    pool.Stop();
+    EXPECT_FALSE(pool.IsRunning());
+
+    for (size_t i = 0; i < pipelines.size(); ++i)
+    {
+        EXPECT_EQ(pipelines[i]->engine.GetResultSequence(), hops[i]);
+        EXPECT_EQ(pipelines[i]->analyzer->processCount.load(), static_cast<int>(hops[i]));
+        EXPECT_EQ(pipelines[i]->analyzer->foreignSamples.load(), 0);
+        EXPECT_EQ(pipelines[i]->engine.GetMetrics().GetHopHistogram().GetCount(), hops[i]);
+    }
+}
+
+TEST(AnalysisWorkerPoolTest, RestartAfterStop)
+{
+    std::vector<std::unique_ptr<TestPipeline>> pipelines;
+    pipelines.push_back(std::make_unique<TestPipeline>(1.0f));
+    AnalysisWorkerPool pool(1);
+    pool.AddEngine(&pipelines[0]->engine);
+
+    std::vector<float> block(512, 1.0f);
+    ASSERT_TRUE(pipelines[0]->ringBuffer.Write(block));
+    ASSERT_TRUE(pool.Start());
+    EXPECT_TRUE(WaitForHops(pipelines, { 1 }));
+    pool.Stop();
+
+    ASSERT_TRUE(pipelines[0]->ringBuffer.Write(block));
+    ASSERT_TRUE(pool.Start());
+    EXPECT_TRUE(WaitForHops(pipelines, { 2 }));
+    pool.Stop();
+}
+
+TEST(AnalysisWorkerPoolTest, CommandsRunOnPoolThread)
+{
+    std::vector<std::unique_ptr<TestPipeline>> pipelines;
+    pipelines.push_back(std::make_unique<TestPipeline>(1.0f));
+    TestPipeline &pipeline = *pipelines[0];
+    AnalysisWorkerPool pool(1);
+    pool.AddEngine(&pipeline.engine);
+    ASSERT_TRUE(pool.Start());
+    EXPECT_FALSE(pipeline.engine.Start());
+
+    // The command waits for the pool thread instead of resetting the analyzer under its feet.
+    auto reset = pipeline.engine.Reset();
+    ASSERT_EQ(reset.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    EXPECT_TRUE(reset.get());
+    EXPECT_NE(pipeline.analyzer->resetThread, std::thread::id());
+    EXPECT_NE(pipeline.analyzer->resetThread, std::this_thread::get_id());
+
+    auto disable = pipeline.engine.SetAnalyzerEnabled(0, false);
+    ASSERT_EQ(disable.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    EXPECT_TRUE(disable.get());
+
+    std::vector<float> blocks(512 * 2, 1.0f);
+    ASSERT_TRUE(pipeline.ringBuffer.Write(blocks));
+    EXPECT_TRUE(WaitForHops(pipelines, { 2 }));
+    EXPECT_EQ(pipeline.analyzer->processCount.load(), 0);
+    pool.Stop();
+
+    // Once the pool let go, commands run on the caller again.
+    auto stoppedReset = pipeline.engine.Reset();
+    ASSERT_EQ(stoppedReset.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(stoppedReset.get());
+    EXPECT_EQ(pipeline.analyzer->resetThread, std::this_thread::get_id());
+}
+
+TEST(AnalysisWorkerPoolTest, ThreadStartListenerRunsOnEveryWorker)
+{
+    TestPipeline first(1.0f);
+    TestPipeline second(2.0f);
+    AnalysisWorkerPool pool(2);
+    pool.AddEngine(&first.engine);
+    pool.AddEngine(&second.engine);
+
+    std::atomic<int> startedMask(0);
+    pool.SetThreadStartListener([&startedMask](size_t workerIndex) {
+        startedMask.fetch_or(1 << workerIndex);
+    });
+    ASSERT_TRUE(pool.Start());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (startedMask.load() != 0b11 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+    pool.Stop();
+    EXPECT_EQ(startedMask.load(), 0b11);
+}
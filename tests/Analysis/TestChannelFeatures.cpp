@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/ChannelFeatures.h"
+#include "Util/SignalGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    constexpr float g_kSampleRate = 48000.0f;
+    constexpr size_t g_kHopSize = 512;
+    constexpr size_t g_kBinCount = 64;
+    constexpr size_t g_kStringCount = 6;
+    constexpr float g_kOpenStrings[g_kStringCount] = { 82.41f, 110.0f, 146.83f, 196.0f, 246.94f, 329.63f };
+
+    /**
+     * @brief Magnitude spectrum with a ramp whose slope depends on the channel.
+     */
+    std::vector<float> MakeSpectrum(size_t channel, float scale)
+    {
+        std::vector<float> magnitudes(g_kBinCount);
+        for (size_t bin = 0; bin < g_kBinCount; ++bin)
+        {
+            magnitudes[bin] = scale * static_cast<float>((bin % 7) + channel) / 10.0f;
+        }
+        return magnitudes;
+    }
+
+} // namespace
+
+TEST(ChannelFeatureCacheTest, ConfigureRejectsInvalidParameters)
+{
+    ChannelFeatureCache cache;
+    const BinRange band = { 0, g_kBinCount };
+    const BinRange outOfRange = { 4, g_kBinCount + 1 };
+
+    EXPECT_FALSE(cache.Configure(0, g_kHopSize, g_kBinCount, g_kSampleRate, {}));
+    EXPECT_FALSE(cache.Configure(g_kChannelLanes + 1, g_kHopSize, g_kBinCount, g_kSampleRate, {}));
+    EXPECT_FALSE(cache.Configure(g_kStringCount, 0, g_kBinCount, g_kSampleRate, {}));
+    EXPECT_FALSE(cache.Configure(g_kStringCount, g_kHopSize, g_kBinCount, 0.0f, {}));
+    EXPECT_FALSE(cache.Configure(g_kStringCount, g_kHopSize, g_kBinCount, g_kSampleRate, { &outOfRange, 1 }));
+    EXPECT_EQ(cache.GetChannelCount(), 0u);
+
+    EXPECT_TRUE(cache.Configure(g_kStringCount, g_kHopSize, g_kBinCount, g_kSampleRate, { &band, 1 }));
+    EXPECT_EQ(cache.GetChannelCount(), g_kStringCount);
+    EXPECT_FALSE(cache.SetChannelSamples(g_kStringCount, std::vector<float>(g_kHopSize)));
+    EXPECT_FALSE(cache.SetChannelSamples(0, std::vector<float>(g_kHopSize - 1)));
+    EXPECT_FALSE(cache.SetChannelSpectrum(0, std::vector<float>(g_kBinCount + 1)));
+}
+
+TEST(ChannelFeatureCacheTest, LockstepFeaturesMatchPerChannelComputation)
+{
+    ChannelFeatureCache cache;
+    ASSERT_TRUE(cache.Configure(g_kStringCount, g_kHopSize, g_kBinCount, g_kSampleRate, {}));
+
+    std::vector<std::vector<float>> strings;
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        strings.push_back(GenerateSine(g_kOpenStrings[channel], g_kSampleRate, g_kHopSize, 0.1f * (channel + 1)));
+        ASSERT_TRUE(cache.SetChannelSamples(channel, strings.back()));
+    }
+    cache.Compute();
+
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        const auto &samples = strings[channel];
+        float sumOfSquares = 0.0f;
+        float peak = 0.0f;
+        size_t crossings = 0;
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            sumOfSquares += samples[i] * samples[i];
+            peak = std::max(peak, std::abs(samples[i]));
+            if (i > 0 && (samples[i - 1] < 0.0f) != (samples[i] < 0.0f))
+            {
+                ++crossings;
+            }
+        }
+
+        const ChannelFeatures &features = cache.GetFeatures(channel);
+        EXPECT_NEAR(features.rms, std::sqrt(sumOfSquares / g_kHopSize), 1e-5f);
+        EXPECT_FLOAT_EQ(features.peak, peak);
+        EXPECT_FLOAT_EQ(features.zeroCrossingRate, static_cast<float>(crossings) * g_kSampleRate / g_kHopSize);
+        EXPECT_NEAR(features.rms, 0.1f * (channel + 1) / std::sqrt(2.0f), 0.01f);
+    }
+}
+
+TEST(ChannelFeatureCacheTest, DifferenceMatchesScalarYinDifference)
+{
+    ChannelFeatureCache cache;
+    ASSERT_TRUE(cache.Configure(g_kStringCount, g_kHopSize, g_kBinCount, g_kSampleRate, {}));
+
+    std::vector<std::vector<float>> strings;
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        strings.push_back(GenerateSine(g_kOpenStrings[channel] * 2.0f, g_kSampleRate, g_kHopSize));
+        ASSERT_TRUE(cache.SetChannelSamples(channel, strings.back()));
+    }
+
+    constexpr size_t window = g_kHopSize / 2;
+    constexpr size_t lagCount = g_kHopSize / 2;
+    EXPECT_FALSE(cache.ComputeDifference(window, lagCount + 1));
+    ASSERT_TRUE(cache.ComputeDifference(window, lagCount));
+
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        const auto &samples = strings[channel];
+        for (size_t lag = 0; lag < lagCount; ++lag)
+        {
+            float expected = 0.0f;
+            for (size_t j = 0; j < window; ++j)
+            {
+                const float delta = samples[j] - samples[j + lag];
+                expected += delta * delta;
+            }
+            EXPECT_NEAR(cache.GetDifference(channel, lag), expected, 1e-3f);
+        }
+
+        // The difference dips at the period of the string's octave and peaks half a period earlier.
+        const auto period = static_cast<size_t>(std::lround(g_kSampleRate / (g_kOpenStrings[channel] * 2.0f)));
+        if (period < lagCount)
+        {
+            EXPECT_LT(cache.GetDifference(channel, period), 0.05f * cache.GetDifference(channel, period / 2));
+        }
+    }
+}
+
+TEST(ChannelFeatureCacheTest, FluxAndBandEnergiesFollowTheSpectra)
+{
+    const BinRange bands[] = { { 0, 8 }, { 8, g_kBinCount } };
+    ChannelFeatureCache cache;
+    ASSERT_TRUE(cache.Configure(g_kStringCount, g_kHopSize, g_kBinCount, g_kSampleRate, bands));
+
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        ASSERT_TRUE(cache.SetChannelSpectrum(channel, MakeSpectrum(channel, 1.0f)));
+    }
+    cache.Compute();
+
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        const auto magnitudes = MakeSpectrum(channel, 1.0f);
+        float total = 0.0f;
+        float low = 0.0f;
+        float energy = 0.0f;
+        for (size_t bin = 0; bin < g_kBinCount; ++bin)
+        {
+            total += magnitudes[bin];
+            energy += magnitudes[bin] * magnitudes[bin];
+            if (bin < 8)
+            {
+                low += magnitudes[bin] * magnitudes[bin];
+            }
+        }
+
+        const ChannelFeatures &features = cache.GetFeatures(channel);
+        EXPECT_NEAR(features.spectralFlux, total, 1e-4f);
+        ASSERT_EQ(features.bandEnergies.GetSize(), 2u);
+        EXPECT_NEAR(features.bandEnergies[0], low, 1e-4f);
+        EXPECT_NEAR(features.bandEnergies[1], energy - low, 1e-3f);
+    }
+
+    // Doubling the magnitudes adds the previous spectrum once more; halving them adds nothing.
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        cache.SetChannelSpectrum(channel, MakeSpectrum(channel, 2.0f));
+    }
+    cache.Compute();
+    const auto first = MakeSpectrum(3, 1.0f);
+    float firstTotal = 0.0f;
+    for (const float magnitude : first)
+    {
+        firstTotal += magnitude;
+    }
+    EXPECT_NEAR(cache.GetFeatures(3).spectralFlux, firstTotal, 1e-4f);
+
+    for (size_t channel = 0; channel < g_kStringCount; ++channel)
+    {
+        cache.SetChannelSpectrum(channel, MakeSpectrum(channel, 1.0f));
+    }
+    cache.Compute();
+    EXPECT_FLOAT_EQ(cache.GetFeatures(3).spectralFlux, 0.0f);
+}
+
+TEST(ChannelFeatureCacheTest, ResetClearsPreviousSpectrum)
+{
+    ChannelFeatureCache cache;
+    ASSERT_TRUE(cache.Configure(1, g_kHopSize, g_kBinCount, g_kSampleRate, {}));
+
+    const auto magnitudes = MakeSpectrum(1, 1.0f);
+    cache.SetChannelSpectrum(0, magnitudes);
+    cache.Compute();
+    const float firstFlux = cache.GetFeatures(0).spectralFlux;
+    EXPECT_GT(firstFlux, 0.0f);
+
+    cache.SetChannelSpectrum(0, magnitudes);
+    cache.Compute();
+    EXPECT_FLOAT_EQ(cache.GetFeatures(0).spectralFlux, 0.0f);
+
+    cache.Reset();
+    EXPECT_FLOAT_EQ(cache.GetFeatures(0).spectralFlux, 0.0f);
+    cache.SetChannelSpectrum(0, magnitudes);
+    cache.Compute();
+    EXPECT_NEAR(cache.GetFeatures(0).spectralFlux, firstFlux, 1e-4f);
+}
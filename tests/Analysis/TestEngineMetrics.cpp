@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "Util/LockFreeRingBuffer.h"
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/EngineMetrics.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    class SleepingAnalyzer : public Analyzer
+    {
+    public:
+        SleepingAnalyzer(std::string name, std::chrono::microseconds delay) : name(std::move(name)), delay(delay)
+        {
+        }
+
+        void Configure(const AnalysisConfig &) override
+        {
+        }
+
+        void ProcessBuffer(std::span<const float>) override
+        {
+            const auto end = std::chrono::steady_clock::now() + delay;
+            while (std::chrono::steady_clock::now() < end)
+            {
+            }
+        }
+
+        std::shared_ptr<AnalysisResult> GetLatestResult() const override
+        {
+            return std::make_shared<AnalysisResult>();
+        }
+
+        void Reset() override
+        {
+        }
+
+        std::string GetName() const override
+        {
+            return name;
+        }
+
+    private:
+        std::string name;
+        std::chrono::microseconds delay;
+    };
+
+} // namespace
+
+TEST(EngineMetricsTest, RecordsPerAnalyzerAndHopTimes)
+{
+    EngineMetrics metrics;
+    metrics.Configure(10000, 4096);
+    const size_t fast = metrics.AddAnalyzer("Fast");
+    const size_t slow = metrics.AddAnalyzer("Slow");
+
+    for (int i = 0; i < 100; ++i)
+    {
+        metrics.RecordAnalyzer(fast, 1000);
+        metrics.RecordAnalyzer(slow, 5000);
+        metrics.RecordHop(6000, 512);
+    }
+    metrics.RecordHop(20000, 1024);
+
+    ASSERT_EQ(metrics.GetAnalyzerCount(), 2u);
+    EXPECT_EQ(metrics.GetAnalyzerName(slow), "Slow");
+    EXPECT_EQ(metrics.GetAnalyzerHistogram(fast).GetCount(), 100u);
+    EXPECT_NEAR(static_cast<double>(metrics.GetAnalyzerHistogram(slow).GetPercentile(50.0)), 5000.0, 160.0);
+    EXPECT_EQ(metrics.GetHopHistogram().GetCount(), 101u);
+    EXPECT_EQ(metrics.GetDeadlineMisses(), 1u);
+    EXPECT_EQ(metrics.GetRingFill(), 1024u);
+    EXPECT_EQ(metrics.GetPeakRingFill(), 1024u);
+    EXPECT_EQ(metrics.GetRingCapacity(), 4096u);
+}
+
+TEST(EngineMetricsTest, ResetIsAppliedOnNextHop)
+{
+    EngineMetrics metrics;
+    metrics.Configure(1000, 4096);
+    metrics.AddAnalyzer("Analyzer");
+
+    metrics.RecordAnalyzer(0, 5000);
+    metrics.RecordHop(5000, 100);
+    ASSERT_EQ(metrics.GetDeadlineMisses(), 1u);
+
+    metrics.RequestReset();
+    metrics.RecordHop(5000, 100);
+
+    EXPECT_EQ(metrics.GetHopHistogram().GetCount(), 0u);
+    EXPECT_EQ(metrics.GetAnalyzerHistogram(0).GetCount(), 0u);
+    EXPECT_EQ(metrics.GetDeadlineMisses(), 0u);
+    EXPECT_EQ(metrics.GetPeakRingFill(), 0u);
+}
+
+TEST(EngineMetricsTest, EngineAttributesTimeToAnalyzers)
+{
+    LockFreeRingBuffer<float> ringBuffer(4096);
+    AnalysisEngine engine(&ringBuffer, AnalysisConfig(48000.0f, 512));
+    engine.RegisterAnalyzer(std::make_shared<SleepingAnalyzer>("Quick", std::chrono::microseconds(0)));
+    engine.RegisterAnalyzer(std::make_shared<SleepingAnalyzer>("Heavy", std::chrono::microseconds(2000)));
+
+    std::vector<float> block(512, 0.0f);
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(ringBuffer.Write(block));
+        ASSERT_TRUE(engine.ProcessNextBlock());
+    }
+    EXPECT_FALSE(engine.ProcessNextBlock());
+
+    const auto &metrics = engine.GetMetrics();
+    ASSERT_EQ(metrics.GetAnalyzerCount(), 2u);
+    EXPECT_EQ(metrics.GetAnalyzerName(0), "Quick");
+    EXPECT_EQ(metrics.GetAnalyzerName(1), "Heavy");
+    EXPECT_EQ(metrics.GetHopHistogram().GetCount(), 5u);
+    EXPECT_GE(metrics.GetAnalyzerHistogram(1).GetPercentile(50.0), 2000000u);
+    EXPECT_LT(metrics.GetAnalyzerHistogram(0).GetPercentile(50.0), metrics.GetAnalyzerHistogram(1).GetPercentile(50.0));
+
+    // 512 frames at 48 kHz is a 10.67 ms budget; 2 ms per hop stays within it.
+    EXPECT_EQ(metrics.GetHopBudget(), 10666666u);
+    EXPECT_EQ(metrics.GetDeadlineMisses(), 0u);
+    EXPECT_EQ(metrics.GetRingFill(), 512u);
+}
+
+TEST(EngineMetricsTest, EngineCountsDeadlineMisses)
+{
+    LockFreeRingBuffer<float> ringBuffer(4096);
+    AnalysisEngine engine(&ringBuffer, AnalysisConfig(48000.0f, 48));
+    engine.RegisterAnalyzer(std::make_shared<SleepingAnalyzer>("Overloaded", std::chrono::microseconds(2000)));
+
+    std::vector<float> block(48, 0.0f);
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(ringBuffer.Write(block));
+        ASSERT_TRUE(engine.ProcessNextBlock());
+    }
+
+    // 48 frames at 48 kHz is a 1 ms budget.
+    EXPECT_EQ(engine.GetMetrics().GetDeadlineMisses(), 3u);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/Envelope/EnvelopeFollower.h"
+#include "Util/SignalGenerator.h"
+
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+    constexpr float g_kSampleRate = 48000.0f;
+    constexpr uint32_t g_kHopSize = 512;
+    constexpr uint32_t g_kFastBlockSize = 64;
+
+    /**
+     * @brief Silence followed by a decaying 110 Hz pluck.
+     */
+    std::vector<float> MakePluck(size_t silentFrames, size_t pluckFrames, float amplitude)
+    {
+        GuitarDiagnostics::Util::StringModelConfig string;
+        string.fundamental = 110.0f;
+        string.inharmonicity = 0.0f;
+        string.numPartials = 1;
+        string.amplitude = amplitude;
+        string.decayRate = 2.0f;
+
+        const auto pluck = GuitarDiagnostics::Util::GeneratePluckedString(string, g_kSampleRate, pluckFrames);
+        std::vector<float> signal(silentFrames, 0.0f);
+        signal.insert(signal.end(), pluck.begin(), pluck.end());
+        return signal;
+    }
+
+    void FeedFastBlocks(EnvelopeFollower &follower, const std::vector<float> &signal)
+    {
+        for (size_t offset = 0; offset + g_kFastBlockSize <= signal.size(); offset += g_kFastBlockSize)
+        {
+            follower.ProcessFastBlock(std::span<const float>(signal.data() + offset, g_kFastBlockSize));
+        }
+    }
+
+    std::shared_ptr<EnvelopeResult> GetResult(const EnvelopeFollower &follower)
+    {
+        return std::dynamic_pointer_cast<EnvelopeResult>(follower.GetLatestResult());
+    }
+} // namespace
+
+class EnvelopeFollowerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        config = AnalysisConfig(g_kSampleRate, g_kHopSize);
+        config.fastBlockSize = g_kFastBlockSize;
+        follower.Configure(config);
+    }
+
+    AnalysisConfig config{ g_kSampleRate, g_kHopSize };
+    EnvelopeFollower follower;
+};
+
+TEST_F(EnvelopeFollowerTest, SilenceHasNoOnset)
+{
+    FeedFastBlocks(follower, std::vector<float>(48000, 0.0f));
+
+    auto result = GetResult(follower);
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->isValid);
+    EXPECT_EQ(result->onsetCount, 0u);
+    EXPECT_EQ(result->framesAnalyzed, 48000u);
+    EXPECT_LE(result->levelDb, -100.0f);
+}
+
+TEST_F(EnvelopeFollowerTest, DetectsPluckWithinAFewMilliseconds)
+{
+    const size_t silentFrames = 4800;
+    const auto signal = MakePluck(silentFrames, 4800, 0.5f);
+
+    // The onset must be visible after the first fast block that contains the pluck's first peak (~2.3 ms in).
+    const size_t withinFrames = silentFrames + 3 * g_kFastBlockSize;
+    FeedFastBlocks(follower, std::vector<float>(signal.begin(), signal.begin() + withinFrames));
+
+    auto result = GetResult(follower);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->onsetCount, 1u);
+    EXPECT_GE(result->lastOnsetFrame, silentFrames);
+    EXPECT_LT(result->lastOnsetFrame, silentFrames + 48); // Within 1 ms of the attack.
+}
+
+TEST_F(EnvelopeFollowerTest, SustainedNoteDoesNotRetrigger)
+{
+    FeedFastBlocks(follower, MakePluck(2400, 96000, 0.8f));
+
+    auto result = GetResult(follower);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->onsetCount, 1u);
+}
+
+TEST_F(EnvelopeFollowerTest, SecondPluckIsDetected)
+{
+    auto signal = MakePluck(2400, 24000, 0.05f);
+    const auto second = MakePluck(0, 24000, 0.8f);
+    signal.insert(signal.end(), second.begin(), second.end());
+
+    FeedFastBlocks(follower, signal);
+
+    auto result = GetResult(follower);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->onsetCount, 2u);
+    EXPECT_GE(result->lastOnsetFrame, 26400u);
+}
+
+TEST_F(EnvelopeFollowerTest, ReportsFullScaleLevelNearZeroDb)
+{
+    const auto signal = GuitarDiagnostics::Util::GenerateSine(440.0f, g_kSampleRate, 4800);
+    FeedFastBlocks(follower, signal);
+
+    auto result = GetResult(follower);
+    ASSERT_NE(result, nullptr);
+    EXPECT_NEAR(result->levelDb, 0.0f, 1.0f);
+}
+
+TEST_F(EnvelopeFollowerTest, TracksHopsOnlyWithoutFastPath)
+{
+    const auto signal = MakePluck(1024, 1024, 0.5f);
+
+    // With a fast path the hop repeats frames already tracked and must be ignored.
+    follower.ProcessBuffer(std::span<const float>(signal.data(), g_kHopSize));
+    EXPECT_EQ(GetResult(follower)->framesAnalyzed, 0u);
+
+    config.fastBlockSize = 0;
+    follower.Configure(config);
+    for (size_t offset = 0; offset < signal.size(); offset += g_kHopSize)
+    {
+        follower.ProcessBuffer(std::span<const float>(signal.data() + offset, g_kHopSize));
+    }
+
+    auto result = GetResult(follower);
+    EXPECT_EQ(result->framesAnalyzed, signal.size());
+    EXPECT_EQ(result->onsetCount, 1u);
+
+    follower.Reset();
+    EXPECT_EQ(GetResult(follower)->onsetCount, 0u);
+    EXPECT_FALSE(GetResult(follower)->isValid);
+}
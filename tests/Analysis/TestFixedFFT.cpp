@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/FixedFFT.h"
+
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+    // Tables are constant expressions, so a broken table fails the build rather than the test.
+    static_assert(FixedFFT<2048>::GetTables().bitReverse[1] == 1024);
+    static_assert(FixedFFT<2048>::GetTables().window[0] == 0.0f);
+    static_assert(FixedFFT<2048>::GetTables().twiddleReal[0] == 1.0f);
+
+    std::vector<float> MakeTestSignal(size_t length)
+    {
+        std::vector<float> signal(length);
+        for (size_t i = 0; i < length; ++i)
+        {
+            const double t = static_cast<double>(i);
+            signal[i] = static_cast<float>(std::sin(0.37 * t) + 0.5 * std::cos(1.91 * t + 0.3) + 0.1 * std::sin(t * t));
+        }
+        return signal;
+    }
+
+    /**
+     * @brief Direct Hann-windowed DFT in double precision, for reference.
+     */
+    std::vector<std::complex<double>> ReferenceDft(const std::vector<float> &input, size_t length)
+    {
+        std::vector<std::complex<double>> output(length);
+        for (size_t k = 0; k < length; ++k)
+        {
+            std::complex<double> sum = 0.0;
+            for (size_t t = 0; t < std::min(input.size(), length); ++t)
+            {
+                const double phase = 2.0 * std::numbers::pi * static_cast<double>(t) / static_cast<double>(length - 1);
+                const double window = 0.5 - 0.5 * std::cos(phase);
+                const double turns = static_cast<double>(k * t % length) / static_cast<double>(length);
+                const double angle = -2.0 * std::numbers::pi * turns;
+                sum += window * input[t] * std::polar(1.0, angle);
+            }
+            output[k] = sum;
+        }
+        return output;
+    }
+
+    template<size_t N> void ExpectMatchesReference(const std::vector<float> &input)
+    {
+        auto fft = std::make_unique<FixedFFT<N>>();
+        fft->Transform(input);
+
+        const auto reference = ReferenceDft(input, N);
+        const double tolerance = 1e-4 * static_cast<double>(N);
+        for (size_t k = 0; k < N; ++k)
+        {
+            EXPECT_NEAR(fft->GetReal()[k], reference[k].real(), tolerance) << "N=" << N << " bin " << k;
+            EXPECT_NEAR(fft->GetImag()[k], reference[k].imag(), tolerance) << "N=" << N << " bin " << k;
+        }
+    }
+} // namespace
+
+TEST(FixedFFTTest, MatchesReferenceForEvenAndOddPowers)
+{
+    ExpectMatchesReference<4>(MakeTestSignal(4));
+    ExpectMatchesReference<8>(MakeTestSignal(8));
+    ExpectMatchesReference<16>(MakeTestSignal(16));
+    ExpectMatchesReference<32>(MakeTestSignal(32));
+    ExpectMatchesReference<256>(MakeTestSignal(256));
+    ExpectMatchesReference<2048>(MakeTestSignal(2048));
+}
+
+TEST(FixedFFTTest, ZeroPadsShortInput)
+{
+    ExpectMatchesReference<64>(MakeTestSignal(40));
+}
+
+TEST(FixedFFTTest, SinePeaksAtItsBin)
+{
+    constexpr size_t size = 2048;
+    constexpr size_t bin = 93;
+
+    std::vector<float> input(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        input[i] = std::sin(2.0f * std::numbers::pi_v<float> * static_cast<float>(bin * i) / static_cast<float>(size));
+    }
+
+    auto fft = std::make_unique<FixedFFT<size>>();
+    std::vector<float> magnitudes(FixedFFT<size>::g_kBinCount);
+    ASSERT_EQ(fft->ComputeMagnitudes(input, magnitudes), FixedFFT<size>::g_kBinCount);
+
+    const auto peak = std::max_element(magnitudes.begin(), magnitudes.end());
+    EXPECT_EQ(static_cast<size_t>(peak - magnitudes.begin()), bin);
+    // A unit sine under a Hann window (coherent gain 0.5) reads 0.25 after the 1 / N scaling.
+    EXPECT_NEAR(*peak, 0.25f, 1e-3f);
+}
+
+TEST(FixedFFTTest, ComputeMagnitudesStopsAtOutputSize)
+{
+    FixedFFT<16> fft;
+    std::vector<float> magnitudes(3, -1.0f);
+
+    EXPECT_EQ(fft.ComputeMagnitudes(MakeTestSignal(16), magnitudes), 3u);
+    EXPECT_GE(magnitudes[2], 0.0f);
+}
@@ -4,51 +4,19 @@
 #include <random>
 
 #include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Util/SignalGenerator.h"
 
 namespace
 {
 
     std::vector<float> GenerateSineWave(float frequency, float sampleRate, size_t numSamples, float amplitude = 1.0f)
     {
-        std::vector<float> buffer(numSamples);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (size_t i = 0; i < numSamples; ++i)
-        {
-            float phase = twoPi * frequency * static_cast<float>(i) / sampleRate;
-            buffer[i] = amplitude * std::sin(phase);
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateSine(frequency, sampleRate, numSamples, amplitude);
     }
 
     std::vector<float> GenerateCleanNote(float fundamental, float sampleRate, size_t numSamples)
     {
-        std::vector<float> buffer(numSamples, 0.0f);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (int harmonic = 1; harmonic <= 5; ++harmonic)
-        {
-            float amplitude = 1.0f / static_cast<float>(harmonic);
-            float freq = fundamental * static_cast<float>(harmonic);
-
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                float phase = twoPi * freq * static_cast<float>(i) / sampleRate;
-                buffer[i] += amplitude * std::sin(phase);
-            }
-        }
-
-        float maxVal = *std::max_element(buffer.begin(), buffer.end());
-        if (maxVal > 0.0f)
-        {
-            for (auto &sample : buffer)
-            {
-                sample /= maxVal;
-            }
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateHarmonicTone(fundamental, sampleRate, numSamples, 5);
     }
 
     std::vector<float> GenerateBuzzyNote(float fundamental, float sampleRate, size_t numSamples)
@@ -268,3 +236,98 @@ TEST_F(FretBuzzDetectorTest, BuzzScoreWithinRange)
     EXPECT_GE(result->inharmonicityScore, 0.0f);
     EXPECT_LE(result->inharmonicityScore, 1.0f);
 }
+
+TEST(FretBuzzParametersTest, OutOfRangeValuesAreClamped)
+{
+    GuitarDiagnostics::Analysis::FretBuzzParameters parameters;
+    parameters.fftSize = 3000;
+    parameters.numHarmonics = 100;
+
+    GuitarDiagnostics::Analysis::FretBuzzDetector detector(parameters);
+
+    EXPECT_EQ(detector.GetParameters().fftSize, 4096u);
+    EXPECT_EQ(detector.GetParameters().numHarmonics, 32u);
+}
+
+TEST(FretBuzzParametersTest, CustomParametersProduceValidResults)
+{
+    GuitarDiagnostics::Analysis::FretBuzzParameters parameters;
+    parameters.fftSize = 1024;
+    parameters.yinThreshold = 0.1f;
+    parameters.numHarmonics = 4;
+
+    GuitarDiagnostics::Analysis::FretBuzzDetector detector(parameters);
+    detector.Configure(GuitarDiagnostics::Analysis::AnalysisConfig(48000.0f, 2048));
+    detector.ProcessBuffer(GenerateCleanNote(110.0f, 48000.0f, 2048));
+
+    auto result = std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(detector.GetLatestResult());
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->isValid);
+    EXPECT_GE(result->buzzScore, 0.0f);
+    EXPECT_LE(result->buzzScore, 1.0f);
+}
+
+TEST_F(FretBuzzDetectorTest, SteadyToneHasNoOnsetAfterFirstHop)
+{
+    const float sampleRate = 48000.0f;
+    const uint32_t bufferSize = 2048;
+    const size_t hops = 10;
+
+    detector->Configure(GuitarDiagnostics::Analysis::AnalysisConfig(sampleRate, bufferSize));
+
+    const auto tone = GenerateCleanNote(110.0f, sampleRate, hops * bufferSize);
+    for (size_t hop = 0; hop < hops; ++hop)
+    {
+        detector->ProcessBuffer(std::span<const float>(tone).subspan(hop * bufferSize, bufferSize));
+
+        auto result =
+            std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(detector->GetLatestResult());
+        ASSERT_NE(result, nullptr);
+        EXPECT_FALSE(result->onsetDetected) << "hop " << hop;
+    }
+}
+
+TEST_F(FretBuzzDetectorTest, PluckIsAnOnset)
+{
+    const float sampleRate = 48000.0f;
+    const uint32_t bufferSize = 2048;
+
+    detector->Configure(GuitarDiagnostics::Analysis::AnalysisConfig(sampleRate, bufferSize));
+
+    GuitarDiagnostics::Util::SignalGenerator generator(sampleRate, 1);
+    generator.SetString(0, GuitarDiagnostics::Util::StringModelConfig());
+    std::vector<float> block(bufferSize);
+
+    // Let the first pluck ring out, then pluck again.
+    for (int hop = 0; hop < 20; ++hop)
+    {
+        generator.Render(block);
+        detector->ProcessBuffer(block);
+    }
+
+    generator.Pluck(0);
+    generator.Render(block);
+    detector->ProcessBuffer(block);
+
+    auto result = std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(detector->GetLatestResult());
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->onsetDetected);
+}
+
+TEST_F(FretBuzzDetectorTest, NewNoteAtSameLevelIsAnOnset)
+{
+    const float sampleRate = 48000.0f;
+    const uint32_t bufferSize = 2048;
+
+    detector->Configure(GuitarDiagnostics::Analysis::AnalysisConfig(sampleRate, bufferSize));
+
+    // The level barely changes, so only the spectral flux can see the new note.
+    detector->ProcessBuffer(GenerateCleanNote(110.0f, sampleRate, bufferSize));
+    detector->ProcessBuffer(GenerateCleanNote(110.0f, sampleRate, bufferSize));
+    detector->ProcessBuffer(GenerateCleanNote(164.81f, sampleRate, bufferSize));
+
+    auto result = std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(detector->GetLatestResult());
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->onsetDetected);
+}
@@ -4,23 +4,16 @@
 #include <numbers>
 #include <thread>
 
+#include "Analysis/AnalysisClock.h"
 #include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Util/SignalGenerator.h"
 
 namespace
 {
 
     std::vector<float> GenerateSineWave(float frequency, float sampleRate, size_t numSamples)
     {
-        std::vector<float> buffer(numSamples);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (size_t i = 0; i < numSamples; ++i)
-        {
-            float phase = twoPi * frequency * static_cast<float>(i) / sampleRate;
-            buffer[i] = std::sin(phase);
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateSine(frequency, sampleRate, numSamples);
     }
 
 } // namespace
@@ -137,6 +130,87 @@ TEST_F(IntonationAnalyzerTest, CalculateIntonationDeviation)
     EXPECT_GT(result->openStringFrequency, 0.0f);
 }
 
+TEST_F(IntonationAnalyzerTest, StateMachineFollowsInjectedClock)
+{
+    using GuitarDiagnostics::Analysis::IntonationState;
+
+    const float sampleRate = 48000.0f;
+    const uint32_t bufferSize = 2048;
+    const float openFreq = 110.0f;
+
+    GuitarDiagnostics::Analysis::ManualClock clock;
+    analyzer->Configure(GuitarDiagnostics::Analysis::AnalysisConfig(sampleRate, bufferSize, &clock));
+
+    auto feed = [&](float frequency, int buffers) {
+        for (int i = 0; i < buffers; ++i)
+        {
+            analyzer->ProcessBuffer(GenerateSineWave(frequency, sampleRate, bufferSize));
+        }
+        return std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::IntonationResult>(analyzer->GetLatestResult());
+    };
+
+    EXPECT_EQ(feed(openFreq, 10)->state, IntonationState::OpenString);
+
+    // However much audio arrives, the state only advances once the clock has moved by stableTime.
+    EXPECT_EQ(feed(openFreq, 40)->state, IntonationState::OpenString);
+    clock.Advance(std::chrono::milliseconds(499));
+    EXPECT_EQ(feed(openFreq, 10)->state, IntonationState::OpenString);
+    clock.Advance(std::chrono::milliseconds(1));
+    EXPECT_EQ(feed(openFreq, 1)->state, IntonationState::WaitFor12thFret);
+
+    EXPECT_EQ(feed(openFreq * 2.0f, 10)->state, IntonationState::FrettedString);
+    clock.Advance(std::chrono::milliseconds(500));
+    auto result = feed(openFreq * 2.0f, 10);
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->state, IntonationState::Complete);
+    EXPECT_NEAR(result->openStringFrequency, openFreq, 1.0f);
+    EXPECT_NEAR(result->frettedStringFrequency, openFreq * 2.0f, 2.0f);
+    EXPECT_TRUE(result->isInTune);
+}
+
+TEST_F(IntonationAnalyzerTest, BatchedHopsMatchHopByHop)
+{
+    using namespace GuitarDiagnostics::Analysis;
+
+    const float sampleRate = 48000.0f;
+    const uint32_t bufferSize = 2048;
+    const size_t batchHops = 8;
+
+    // 1.4 s open string, then 1.4 s at the 12th fret: leaving OpenString needs every hop dated right.
+    auto signal = GenerateSineWave(110.0f, sampleRate, bufferSize * batchHops * 4);
+    const auto fretted = GenerateSineWave(220.0f, sampleRate, bufferSize * batchHops * 4);
+    signal.insert(signal.end(), fretted.begin(), fretted.end());
+
+    SampleClock hopClock(sampleRate);
+    SampleClock batchClock(sampleRate);
+    IntonationAnalyzer batched;
+    analyzer->Configure(AnalysisConfig(sampleRate, bufferSize, &hopClock));
+    batched.Configure(AnalysisConfig(sampleRate, bufferSize, &batchClock));
+
+    const size_t batchFrames = bufferSize * batchHops;
+    for (size_t offset = 0; offset < signal.size(); offset += batchFrames)
+    {
+        for (size_t hop = 0; hop < batchHops; ++hop)
+        {
+            hopClock.OnHop(bufferSize);
+            analyzer->ProcessBuffer(std::span<const float>(signal.data() + offset + hop * bufferSize, bufferSize));
+        }
+        batchClock.OnHop(batchFrames);
+        batched.ProcessBlocks(std::span<const float>(signal.data() + offset, batchFrames), bufferSize);
+
+        auto expected = std::dynamic_pointer_cast<IntonationResult>(analyzer->GetLatestResult());
+        auto actual = std::dynamic_pointer_cast<IntonationResult>(batched.GetLatestResult());
+        ASSERT_NE(actual, nullptr);
+        EXPECT_EQ(actual->state, expected->state) << "after " << offset + batchFrames << " frames";
+        EXPECT_FLOAT_EQ(actual->openStringFrequency, expected->openStringFrequency);
+        EXPECT_FLOAT_EQ(actual->frettedStringFrequency, expected->frettedStringFrequency);
+    }
+
+    EXPECT_NE(std::dynamic_pointer_cast<IntonationResult>(batched.GetLatestResult())->state,
+        IntonationState::OpenString);
+}
+
 TEST_F(IntonationAnalyzerTest, InTuneWithinTolerance)
 {
     // This test verifies the tolerance calculation (±5 cents)
@@ -197,22 +271,22 @@ TEST_F(IntonationAnalyzerTest, ThreadSafeResultRetrieval)
         {
             auto audioData = GenerateSineWave(testFrequency, sampleRate, bufferSize);
             analyzer->ProcessBuffer(audioData);
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            std::this_thread::yield();
         }
         running = false;
     });
 
     // Thread 2: Read results
     std::thread readingThread([&]() {
-        while (running)
+        do
         {
             auto result = analyzer->GetLatestResult();
             if (result != nullptr)
             {
                 readCount.fetch_add(1, std::memory_order_relaxed);
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
+            std::this_thread::yield();
+        } while (running);
     });
 
     processingThread.join();
@@ -220,3 +294,13 @@ TEST_F(IntonationAnalyzerTest, ThreadSafeResultRetrieval)
 
     EXPECT_GT(readCount.load(), 0);
 }
+
+TEST(IntonationParametersTest, AccumulatorSizeIsClamped)
+{
+    GuitarDiagnostics::Analysis::IntonationParameters parameters;
+    parameters.pitchAccumulatorSize = 2;
+    EXPECT_EQ(GuitarDiagnostics::Analysis::IntonationAnalyzer(parameters).GetParameters().pitchAccumulatorSize, 10u);
+
+    parameters.pitchAccumulatorSize = 10000;
+    EXPECT_EQ(GuitarDiagnostics::Analysis::IntonationAnalyzer(parameters).GetParameters().pitchAccumulatorSize, 400u);
+}
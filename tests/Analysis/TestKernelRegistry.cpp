@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Kernels/KernelRegistry.h"
+#include "Util/SignalGenerator.h"
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+    constexpr KernelVariant g_kAllVariants[] = { KernelVariant::Baseline, KernelVariant::Avx2, KernelVariant::Avx512 };
+
+    std::vector<float> MakeNoise(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> samples(count);
+        for (auto &sample : samples)
+        {
+            sample = distribution(rng);
+        }
+        return samples;
+    }
+
+    /**
+     * @brief Restores the detected variant after tests that force one.
+     */
+    class KernelRegistryTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            KernelRegistry::ResetVariant();
+        }
+    };
+} // namespace
+
+TEST_F(KernelRegistryTest, BaselineIsAlwaysSupported)
+{
+    EXPECT_TRUE(KernelRegistry::IsSupported(KernelVariant::Baseline));
+    EXPECT_NE(KernelRegistry::GetTable(KernelVariant::Baseline), nullptr);
+    EXPECT_TRUE(KernelRegistry::IsSupported(KernelRegistry::DetectBestVariant()));
+}
+
+TEST_F(KernelRegistryTest, VariantNamesRoundTrip)
+{
+    for (const KernelVariant variant : g_kAllVariants)
+    {
+        EXPECT_EQ(KernelRegistry::ParseVariant(KernelRegistry::GetVariantName(variant)), variant);
+    }
+    EXPECT_FALSE(KernelRegistry::ParseVariant("sse9").has_value());
+}
+
+TEST_F(KernelRegistryTest, BaselineMatchesReferenceLoops)
+{
+    const KernelTable &kernels = *KernelRegistry::GetTable(KernelVariant::Baseline);
+    const std::vector<float> samples = { 0.5f, -0.25f, 0.0f, -1.5f, 2.0f, 0.0f, 0.75f };
+    const std::vector<float> previous = { 1.0f, -1.0f, 0.5f, -1.0f, 1.0f, 0.0f };
+
+    EXPECT_FLOAT_EQ(kernels.sumOfSquares(samples), 0.25f + 0.0625f + 2.25f + 4.0f + 0.5625f);
+    EXPECT_FLOAT_EQ(kernels.positiveDifferenceSum(samples, previous), 0.75f + 1.0f);
+    EXPECT_FLOAT_EQ(kernels.peakAbsolute(samples), 2.0f);
+    EXPECT_EQ(kernels.countZeroCrossings(samples), 4u);
+    EXPECT_EQ(kernels.findPeak(samples), 4u);
+    EXPECT_FLOAT_EQ(kernels.dotProduct(samples, previous), 0.5f + 0.25f - 0.0f + 1.5f + 2.0f + 0.0f);
+
+    EXPECT_FLOAT_EQ(kernels.sumOfSquares({}), 0.0f);
+    EXPECT_FLOAT_EQ(kernels.peakAbsolute({}), 0.0f);
+    EXPECT_EQ(kernels.countZeroCrossings({}), 0u);
+    EXPECT_EQ(kernels.findPeak({}), 0u);
+    EXPECT_FLOAT_EQ(kernels.dotProduct({}, samples), 0.0f);
+}
+
+TEST_F(KernelRegistryTest, EverySupportedVariantMatchesBaseline)
+{
+    const KernelTable &baseline = *KernelRegistry::GetTable(KernelVariant::Baseline);
+
+    for (const KernelVariant variant : g_kAllVariants)
+    {
+        const KernelTable *kernels = KernelRegistry::GetTable(variant);
+        if (!kernels)
+        {
+            continue;
+        }
+
+        // Lengths around the 16-lane blocking, plus a typical hop and spectrum.
+        for (const size_t count : { 1u, 15u, 16u, 17u, 33u, 512u, 1024u, 2049u })
+        {
+            const auto current = MakeNoise(count, static_cast<uint32_t>(count));
+            const auto previous = MakeNoise(count, static_cast<uint32_t>(count) + 1);
+            SCOPED_TRACE(std::string(KernelRegistry::GetVariantName(variant)) + " n=" + std::to_string(count));
+
+            const float tolerance = 1e-5f * static_cast<float>(count);
+            EXPECT_NEAR(kernels->sumOfSquares(current), baseline.sumOfSquares(current), tolerance);
+            EXPECT_NEAR(kernels->positiveDifferenceSum(current, previous),
+                baseline.positiveDifferenceSum(current, previous),
+                tolerance);
+            EXPECT_EQ(kernels->peakAbsolute(current), baseline.peakAbsolute(current));
+            EXPECT_EQ(kernels->countZeroCrossings(current), baseline.countZeroCrossings(current));
+            EXPECT_EQ(kernels->findPeak(current), baseline.findPeak(current));
+            EXPECT_NEAR(kernels->dotProduct(current, previous), baseline.dotProduct(current, previous), tolerance);
+        }
+    }
+}
+
+TEST_F(KernelRegistryTest, ChannelKernelsMatchMonoKernelsPerLane)
+{
+    const KernelTable &baseline = *KernelRegistry::GetTable(KernelVariant::Baseline);
+
+    for (const KernelVariant variant : g_kAllVariants)
+    {
+        const KernelTable *kernels = KernelRegistry::GetTable(variant);
+        if (!kernels)
+        {
+            continue;
+        }
+
+        // Frame counts around the two-frame blocking, plus a typical hop.
+        for (const size_t frameCount : { 1u, 2u, 3u, 17u, 512u })
+        {
+            const auto current = MakeNoise(frameCount * g_kChannelLanes, static_cast<uint32_t>(frameCount));
+            const auto previous = MakeNoise(frameCount * g_kChannelLanes, static_cast<uint32_t>(frameCount) + 1);
+            SCOPED_TRACE(std::string(KernelRegistry::GetVariantName(variant)) + " frames="
+                         + std::to_string(frameCount));
+
+            std::array<float, g_kChannelLanes> sums{};
+            std::array<float, g_kChannelLanes> flux{};
+            std::array<float, g_kChannelLanes> peaks{};
+            std::array<uint32_t, g_kChannelLanes> crossings{};
+            std::array<float, g_kChannelLanes> difference{};
+            const size_t lag = frameCount / 3;
+            kernels->channelSumOfSquares(current, sums);
+            kernels->channelPositiveDifferenceSum(current, previous, flux);
+            kernels->channelPeakAbsolute(current, peaks);
+            kernels->channelZeroCrossings(current, crossings);
+            kernels->channelDifference(current, frameCount, lag, difference);
+
+            for (size_t channel = 0; channel < g_kChannelLanes; ++channel)
+            {
+                std::vector<float> lane(frameCount);
+                std::vector<float> previousLane(frameCount);
+                for (size_t i = 0; i < frameCount; ++i)
+                {
+                    lane[i] = current[i * g_kChannelLanes + channel];
+                    previousLane[i] = previous[i * g_kChannelLanes + channel];
+                }
+
+                float expectedDifference = 0.0f;
+                for (size_t i = 0; i + lag < frameCount; ++i)
+                {
+                    expectedDifference += (lane[i] - lane[i + lag]) * (lane[i] - lane[i + lag]);
+                }
+
+                const float tolerance = 1e-5f * static_cast<float>(frameCount);
+                EXPECT_NEAR(sums[channel], baseline.sumOfSquares(lane), tolerance);
+                EXPECT_NEAR(flux[channel], baseline.positiveDifferenceSum(lane, previousLane), tolerance);
+                EXPECT_EQ(peaks[channel], baseline.peakAbsolute(lane));
+                EXPECT_EQ(crossings[channel], baseline.countZeroCrossings(lane));
+                EXPECT_NEAR(difference[channel], expectedDifference, tolerance);
+            }
+        }
+    }
+}
+
+TEST_F(KernelRegistryTest, ForcedVariantIsUsedByAnalyzers)
+{
+    const auto tone = GuitarDiagnostics::Util::GenerateHarmonicTone(110.0f, 48000.0f, 2048 * 4, 5);
+    std::vector<float> scores;
+
+    for (const KernelVariant variant : g_kAllVariants)
+    {
+        if (!KernelRegistry::ForceVariant(variant))
+        {
+            EXPECT_FALSE(KernelRegistry::IsSupported(variant));
+            continue;
+        }
+        EXPECT_EQ(KernelRegistry::GetActiveVariant(), variant);
+
+        FretBuzzDetector detector;
+        detector.Configure(AnalysisConfig(48000.0f, 2048));
+        for (size_t offset = 0; offset < tone.size(); offset += 2048)
+        {
+            detector.ProcessBuffer(std::span<const float>(tone.data() + offset, 2048));
+        }
+
+        const auto result = std::static_pointer_cast<FretBuzzResult>(detector.GetLatestResult());
+        scores.push_back(result->buzzScore);
+    }
+
+    ASSERT_FALSE(scores.empty());
+    for (const float score : scores)
+    {
+        EXPECT_NEAR(score, scores.front(), 1e-4f);
+    }
+}
+
+TEST_F(KernelRegistryTest, ResetReturnsToDetectedVariant)
+{
+    ASSERT_TRUE(KernelRegistry::ForceVariant(KernelVariant::Baseline));
+    EXPECT_EQ(KernelRegistry::GetActiveVariant(), KernelVariant::Baseline);
+
+    KernelRegistry::ResetVariant();
+    EXPECT_EQ(KernelRegistry::GetActiveVariant(), KernelRegistry::DetectBestVariant());
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/AnalysisEngine.h"
+#include "Analysis/AnalyzerParameters.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/ParameterStore.h"
+#include "Util/LockFreeRingBuffer.h"
+#include "Util/SignalGenerator.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+
+    std::filesystem::path WriteTempFile(const std::string &name, const std::string &contents)
+    {
+        const auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::trunc);
+        file << contents;
+        return path;
+    }
+
+} // namespace
+
+TEST(AnalyzerParametersTest, MissingKeysKeepDefaults)
+{
+    const auto parameters = ParseAnalyzerParameters(R"({"fretBuzz": {"onsetThreshold": 2.5}})");
+
+    ASSERT_TRUE(parameters.has_value());
+    EXPECT_FLOAT_EQ(parameters->fretBuzz.onsetThreshold, 2.5f);
+    EXPECT_EQ(parameters->fretBuzz.fftSize, FretBuzzParameters().fftSize);
+    EXPECT_FLOAT_EQ(parameters->intonation.inTuneTolerance, IntonationParameters().inTuneTolerance);
+}
+
+TEST(AnalyzerParametersTest, RejectsInvalidDocuments)
+{
+    EXPECT_FALSE(ParseAnalyzerParameters("{not json").has_value());
+    EXPECT_FALSE(ParseAnalyzerParameters(R"({"intonation": 5})").has_value());
+    EXPECT_FALSE(ParseAnalyzerParameters(R"({"stringHealth": {"numHarmonics": "ten"}})").has_value());
+    EXPECT_FALSE(ParseAnalyzerParameters(R"({"stringHealth": {"decayHistorySize": -1}})").has_value());
+}
+
+TEST(AnalyzerParametersTest, SerializationRoundTrips)
+{
+    AnalyzerParameters original;
+    original.fretBuzz.highFreqWeight = 0.6f;
+    original.intonation.stableTime = std::chrono::milliseconds(250);
+    original.stringHealth.decayHistorySize = 30;
+
+    const auto parsed = ParseAnalyzerParameters(SerializeAnalyzerParameters(original));
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_FLOAT_EQ(parsed->fretBuzz.highFreqWeight, 0.6f);
+    EXPECT_EQ(parsed->intonation.stableTime, std::chrono::milliseconds(250));
+    EXPECT_EQ(parsed->stringHealth.decayHistorySize, 30u);
+}
+
+TEST(ParameterStoreTest, PublishSwapsSnapshot)
+{
+    ParameterStore store;
+    const AnalyzerParameters *initial = store.GetCurrent();
+    ASSERT_NE(initial, nullptr);
+    EXPECT_EQ(store.GetVersion(), 0u);
+
+    AnalyzerParameters update;
+    update.intonation.confidenceThreshold = 0.9f;
+    store.Publish(update);
+
+    EXPECT_NE(store.GetCurrent(), initial);
+    EXPECT_FLOAT_EQ(store.GetCurrent()->intonation.confidenceThreshold, 0.9f);
+    EXPECT_FLOAT_EQ(initial->intonation.confidenceThreshold, IntonationParameters().confidenceThreshold);
+    EXPECT_EQ(store.GetVersion(), 1u);
+}
+
+TEST(ParameterStoreTest, InvalidFileKeepsCurrentSnapshot)
+{
+    ParameterStore store;
+    const auto path = WriteTempFile("gd-parameters-invalid.json", R"({"fretBuzz": {"onsetThreshold": "high"}})");
+
+    EXPECT_FALSE(store.LoadFromFile(path));
+    EXPECT_FALSE(store.LoadFromFile(path.string() + ".missing"));
+    EXPECT_EQ(store.GetVersion(), 0u);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ParameterStoreTest, ReloadsEditedFile)
+{
+    ParameterStore store;
+    const auto path = WriteTempFile("gd-parameters-reload.json", R"({"fretBuzz": {"onsetThreshold": 2.0}})");
+
+    ASSERT_TRUE(store.LoadFromFile(path));
+    EXPECT_FALSE(store.ReloadIfChanged());
+
+    WriteTempFile("gd-parameters-reload.json", R"({"fretBuzz": {"onsetThreshold": 3.0}})");
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(2));
+
+    EXPECT_TRUE(store.ReloadIfChanged());
+    EXPECT_FLOAT_EQ(store.GetCurrent()->fretBuzz.onsetThreshold, 3.0f);
+    EXPECT_EQ(store.GetVersion(), 2u);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ParameterStoreTest, EngineAppliesUpdatesAtNextHop)
+{
+    const uint32_t bufferSize = 2048;
+    GuitarDiagnostics::Util::LockFreeRingBuffer<float> ringBuffer(bufferSize * 4);
+    AnalysisEngine engine(&ringBuffer, AnalysisConfig(48000.0f, bufferSize));
+    auto detector = std::make_shared<FretBuzzDetector>();
+    engine.RegisterAnalyzer(detector);
+
+    ParameterStore store;
+    engine.SetParameterStore(&store);
+
+    AnalyzerParameters update;
+    update.fretBuzz.transientWeight = 0.0f;
+    update.fretBuzz.highFreqWeight = 0.0f;
+    update.fretBuzz.inharmonicityWeight = 0.0f;
+    update.fretBuzz.fftSize = 4096;
+    store.Publish(update);
+
+    EXPECT_FLOAT_EQ(detector->GetParameters().highFreqWeight, FretBuzzParameters().highFreqWeight);
+
+    const auto tone = GuitarDiagnostics::Util::GenerateHarmonicTone(110.0f, 48000.0f, bufferSize, 5);
+    ringBuffer.Write(tone);
+    ASSERT_TRUE(engine.ProcessNextBlock());
+
+    EXPECT_FLOAT_EQ(detector->GetParameters().highFreqWeight, 0.0f);
+    EXPECT_EQ(detector->GetParameters().fftSize, FretBuzzParameters().fftSize);
+
+    auto result = std::dynamic_pointer_cast<FretBuzzResult>(detector->GetLatestResult());
+    ASSERT_NE(result, nullptr);
+    EXPECT_FLOAT_EQ(result->buzzScore, 0.0f);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/Resampler.h"
+#include "Util/SignalGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    /**
+     * @brief Sine with the phase kept in double, so phase rounding does not show up as noise.
+     */
+    std::vector<float> MakeSine(float frequency, float sampleRate, size_t count)
+    {
+        std::vector<float> samples(count);
+        const double omega = 2.0 * std::numbers::pi * frequency / sampleRate;
+        for (size_t i = 0; i < count; ++i)
+        {
+            samples[i] = static_cast<float>(std::sin(omega * static_cast<double>(i)));
+        }
+        return samples;
+    }
+
+    std::vector<float> ResampleAll(Resampler &resampler, const std::vector<float> &input, size_t blockSize)
+    {
+        std::vector<float> output;
+        std::vector<float> block(resampler.GetMaxOutputSize(blockSize));
+        for (size_t offset = 0; offset < input.size(); offset += blockSize)
+        {
+            const size_t count = std::min(blockSize, input.size() - offset);
+            const size_t written = resampler.Process(std::span<const float>(input.data() + offset, count), block);
+            output.insert(output.end(), block.begin(), block.begin() + static_cast<std::ptrdiff_t>(written));
+        }
+        return output;
+    }
+
+    /**
+     * @brief Fits a sine of known frequency by least squares and returns its amplitude and the residual RMS.
+     */
+    std::pair<float, float> FitSine(std::span<const float> samples, float frequency, float sampleRate)
+    {
+        double sinSum = 0.0;
+        double cosSum = 0.0;
+        const double omega = 2.0 * std::numbers::pi * frequency / sampleRate;
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            sinSum += samples[i] * std::sin(omega * static_cast<double>(i));
+            cosSum += samples[i] * std::cos(omega * static_cast<double>(i));
+        }
+
+        const double scale = 2.0 / static_cast<double>(samples.size());
+        const double sinWeight = sinSum * scale;
+        const double cosWeight = cosSum * scale;
+
+        double residual = 0.0;
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            const double phase = omega * static_cast<double>(i);
+            const double fitted = sinWeight * std::sin(phase) + cosWeight * std::cos(phase);
+            residual += (samples[i] - fitted) * (samples[i] - fitted);
+        }
+
+        return { static_cast<float>(std::hypot(sinWeight, cosWeight)),
+            static_cast<float>(std::sqrt(residual / static_cast<double>(samples.size()))) };
+    }
+
+} // namespace
+
+TEST(ResamplerTest, ReducesTheRateRatio)
+{
+    Resampler resampler;
+    EXPECT_FALSE(resampler.IsConfigured());
+
+    ASSERT_TRUE(resampler.Configure(44100.0f, 48000.0f, 512));
+    EXPECT_TRUE(resampler.IsConfigured());
+    EXPECT_EQ(resampler.GetInterpolation(), 160u);
+    EXPECT_EQ(resampler.GetDecimation(), 147u);
+
+    // Downsampling widens each phase so the cutoff keeps its sharpness at the input rate.
+    ASSERT_TRUE(resampler.Configure(96000.0f, 48000.0f, 512));
+    EXPECT_EQ(resampler.GetInterpolation(), 1u);
+    EXPECT_EQ(resampler.GetDecimation(), 2u);
+    EXPECT_EQ(resampler.GetTapsPerPhase(), 128u);
+}
+
+TEST(ResamplerTest, RejectsUnsupportedRates)
+{
+    Resampler resampler;
+    EXPECT_FALSE(resampler.Configure(0.0f, 48000.0f, 512));
+    EXPECT_FALSE(resampler.Configure(48000.0f, 48000.0f, 0));
+    EXPECT_FALSE(resampler.Configure(44101.0f, 48000.0f, 512)); // Ratio 48000 / 44101 needs 48000 phases.
+    EXPECT_FALSE(resampler.IsConfigured());
+}
+
+TEST(ResamplerTest, ProducesOutputAtTheTargetRate)
+{
+    for (const float inputRate : { 44100.0f, 88200.0f, 96000.0f, 32000.0f })
+    {
+        Resampler resampler;
+        ASSERT_TRUE(resampler.Configure(inputRate, 48000.0f, 512));
+
+        const std::vector<float> input(static_cast<size_t>(inputRate), 0.0f);
+        const auto output = ResampleAll(resampler, input, 441);
+        EXPECT_NEAR(static_cast<double>(output.size()), 48000.0, 1.0) << inputRate;
+    }
+}
+
+TEST(ResamplerTest, KeepsToneAmplitudeAndPurity)
+{
+    for (const float inputRate : { 44100.0f, 96000.0f })
+    {
+        Resampler resampler;
+        ASSERT_TRUE(resampler.Configure(inputRate, 48000.0f, 512));
+
+        const auto input = MakeSine(1000.0f, inputRate, static_cast<size_t>(inputRate / 2));
+        const auto output = ResampleAll(resampler, input, 512);
+
+        // Skip the filter's start-up transient.
+        const std::span<const float> settled(output.data() + 1024, output.size() - 1024);
+        const auto [amplitude, residual] = FitSine(settled, 1000.0f, 48000.0f);
+        EXPECT_NEAR(amplitude, 1.0f, 1e-3f) << inputRate;
+        EXPECT_LT(residual, 1e-3f) << inputRate;
+    }
+}
+
+TEST(ResamplerTest, RemovesContentAboveTheOutputNyquist)
+{
+    Resampler resampler;
+    ASSERT_TRUE(resampler.Configure(96000.0f, 48000.0f, 512));
+
+    // 30 kHz would alias to 18 kHz without the low-pass.
+    const auto input = MakeSine(30000.0f, 96000.0f, 48000);
+    const auto output = ResampleAll(resampler, input, 512);
+
+    float peak = 0.0f;
+    for (size_t i = 1024; i < output.size(); ++i)
+    {
+        peak = std::max(peak, std::abs(output[i]));
+    }
+    EXPECT_LT(peak, 1e-4f);
+}
+
+TEST(ResamplerTest, OutputDoesNotDependOnBlockSize)
+{
+    const auto input = GenerateHarmonicTone(110.0f, 44100.0f, 10000, 8);
+
+    Resampler whole;
+    ASSERT_TRUE(whole.Configure(44100.0f, 48000.0f, 512));
+    const auto reference = ResampleAll(whole, input, input.size());
+
+    for (const size_t blockSize : { 1u, 7u, 147u, 512u, 1000u })
+    {
+        Resampler blocked;
+        ASSERT_TRUE(blocked.Configure(44100.0f, 48000.0f, 512));
+        EXPECT_EQ(ResampleAll(blocked, input, blockSize), reference) << blockSize;
+    }
+}
+
+TEST(ResamplerTest, ResetRestartsTheStream)
+{
+    const auto input = GenerateSine(440.0f, 44100.0f, 4096);
+
+    Resampler resampler;
+    ASSERT_TRUE(resampler.Configure(44100.0f, 48000.0f, 512));
+    const auto first = ResampleAll(resampler, input, 512);
+
+    resampler.Reset();
+    EXPECT_EQ(ResampleAll(resampler, input, 512), first);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/ResultPool.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Util/SignalGenerator.h"
+
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+
+    struct TestResult
+    {
+        int value = 0;
+    };
+
+    std::set<const AnalysisResult *> CollectResultObjects(Analyzer &analyzer, int hops)
+    {
+        const auto tone = GuitarDiagnostics::Util::GenerateHarmonicTone(196.0f, 48000.0f, 2048, 5);
+        std::set<const AnalysisResult *> objects;
+
+        for (int i = 0; i < hops; ++i)
+        {
+            analyzer.ProcessBuffer(tone);
+            objects.insert(analyzer.GetLatestResult().get());
+        }
+
+        return objects;
+    }
+
+} // namespace
+
+TEST(ResultPoolTest, NeverReturnsPublishedResult)
+{
+    ResultPool<TestResult> pool;
+    std::shared_ptr<TestResult> published = pool.Acquire(nullptr);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        auto next = pool.Acquire(published);
+        ASSERT_NE(next, published);
+        published = std::move(next);
+    }
+}
+
+TEST(ResultPoolTest, SkipsResultsHeldByReaders)
+{
+    ResultPool<TestResult> pool;
+    std::shared_ptr<TestResult> published = pool.Acquire(nullptr);
+    std::shared_ptr<TestResult> heldByReader = published;
+
+    published = pool.Acquire(published);
+    auto next = pool.Acquire(published);
+
+    EXPECT_NE(next, heldByReader);
+    EXPECT_NE(next, published);
+}
+
+TEST(ResultPoolTest, FallsBackToAllocationWhenAllSlotsAreHeld)
+{
+    ResultPool<TestResult> pool;
+    std::vector<std::shared_ptr<TestResult>> held;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        held.push_back(pool.Acquire(nullptr));
+        ASSERT_NE(held.back(), nullptr);
+    }
+
+    std::set<TestResult *> distinct;
+    for (const auto &result : held)
+    {
+        distinct.insert(result.get());
+    }
+    EXPECT_EQ(distinct.size(), held.size());
+}
+
+TEST(ResultPoolTest, AnalyzersRecycleResultObjects)
+{
+    FretBuzzDetector fretBuzz;
+    IntonationAnalyzer intonation;
+    StringHealthAnalyzer stringHealth;
+
+    const AnalysisConfig config(48000.0f, 2048);
+    fretBuzz.Configure(config);
+    intonation.Configure(config);
+    stringHealth.Configure(config);
+
+    EXPECT_LE(CollectResultObjects(fretBuzz, 50).size(), 4u);
+    EXPECT_LE(CollectResultObjects(intonation, 50).size(), 4u);
+    EXPECT_LE(CollectResultObjects(stringHealth, 50).size(), 4u);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Spectrogram.h"
+#include "Util/SignalGenerator.h"
+
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+    constexpr float g_kSampleRate = 48000.0f;
+    constexpr size_t g_kFftSize = 4096;
+    constexpr size_t g_kBands = 32;
+} // namespace
+
+TEST(SpectrogramTest, StartsEmpty)
+{
+    Spectrogram spectrogram(g_kSampleRate, g_kFftSize, g_kBands, 64, 50.0f, 12000.0f, -100.0f, 0.0f);
+
+    EXPECT_EQ(spectrogram.GetRowCount(), 0u);
+    EXPECT_EQ(spectrogram.GetBandCount(), g_kBands);
+    EXPECT_EQ(spectrogram.GetReadableRows(), 32u);
+}
+
+TEST(SpectrogramTest, PeakLightsOnlyItsBand)
+{
+    Spectrogram spectrogram(g_kSampleRate, g_kFftSize, g_kBands, 64, 50.0f, 12000.0f, -100.0f, 0.0f);
+
+    // 1 kHz lands in bin 1000 * 4096 / 48000 = 85.
+    std::vector<float> magnitudes(g_kFftSize / 2, 0.0f);
+    magnitudes[85] = 1.0f;
+    spectrogram.PushSpectrum(magnitudes);
+
+    ASSERT_EQ(spectrogram.GetRowCount(), 1u);
+    const auto row = spectrogram.GetRow(0);
+    ASSERT_EQ(row.size(), g_kBands);
+
+    const auto peakBand = static_cast<size_t>(spectrogram.GetFrequencyPosition(1000.0f) * g_kBands);
+    size_t litBands = 0;
+    for (size_t band = 0; band < row.size(); ++band)
+    {
+        if (row[band] != spectrogram.GetBackgroundColor())
+        {
+            ++litBands;
+            EXPECT_EQ(band, peakBand);
+        }
+    }
+    EXPECT_EQ(litBands, 1u);
+}
+
+TEST(SpectrogramTest, LouderIsBrighter)
+{
+    Spectrogram spectrogram(g_kSampleRate, g_kFftSize, g_kBands, 64, 50.0f, 12000.0f, -100.0f, 0.0f);
+    std::vector<float> magnitudes(g_kFftSize / 2, 0.0f);
+
+    magnitudes[85] = 0.001f;
+    spectrogram.PushSpectrum(magnitudes);
+    magnitudes[85] = 1.0f;
+    spectrogram.PushSpectrum(magnitudes);
+
+    const auto band = static_cast<size_t>(spectrogram.GetFrequencyPosition(1000.0f) * g_kBands);
+    const uint32_t quiet = spectrogram.GetRow(0)[band];
+    const uint32_t loud = spectrogram.GetRow(1)[band];
+
+    // The palette ramps every channel from dark to bright, so green alone orders the levels.
+    EXPECT_GT((loud >> 8) & 0xFF, (quiet >> 8) & 0xFF);
+}
+
+TEST(SpectrogramTest, LevelsMapOntoThePaletteAbsolutely)
+{
+    Spectrogram spectrogram(g_kSampleRate, g_kFftSize, g_kBands, 64, 50.0f, 12000.0f, -100.0f, 0.0f);
+    std::vector<float> magnitudes(g_kFftSize / 2, 0.0f);
+
+    // 0 dB is the ceiling, -50 dB the midpoint between floor and ceiling.
+    magnitudes[85] = 1.0f;
+    spectrogram.PushSpectrum(magnitudes);
+    magnitudes[85] = 0.0031622777f;
+    spectrogram.PushSpectrum(magnitudes);
+
+    const auto band = static_cast<size_t>(spectrogram.GetFrequencyPosition(1000.0f) * g_kBands);
+
+    // Last palette entry: the brightest color stop (252, 255, 164).
+    EXPECT_EQ(spectrogram.GetRow(0)[band], 0xFFA4FFFCu);
+    // Palette entry 127 of 256, just below the (188, 55, 84) stop at 0.5: (187, 55, 84).
+    EXPECT_EQ(spectrogram.GetRow(1)[band], 0xFF5437BBu);
+}
+
+TEST(SpectrogramTest, RingKeepsNewestRows)
+{
+    Spectrogram spectrogram(g_kSampleRate, g_kFftSize, g_kBands, 8, 50.0f, 12000.0f, -100.0f, 0.0f);
+    std::vector<float> silence(g_kFftSize / 2, 0.0f);
+    std::vector<float> tone(g_kFftSize / 2, 0.0f);
+    tone[85] = 1.0f;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        spectrogram.PushSpectrum(silence);
+    }
+    spectrogram.PushSpectrum(tone);
+
+    ASSERT_EQ(spectrogram.GetRowCount(), 11u);
+    const auto band = static_cast<size_t>(spectrogram.GetFrequencyPosition(1000.0f) * g_kBands);
+    EXPECT_NE(spectrogram.GetRow(10)[band], spectrogram.GetBackgroundColor());
+    EXPECT_EQ(spectrogram.GetRow(9)[band], spectrogram.GetBackgroundColor());
+}
+
+TEST(SpectrogramTest, FrequencyPositionIsLogarithmic)
+{
+    Spectrogram spectrogram(g_kSampleRate, g_kFftSize, g_kBands, 8, 100.0f, 6400.0f, -100.0f, 0.0f);
+
+    EXPECT_FLOAT_EQ(spectrogram.GetFrequencyPosition(50.0f), 0.0f);
+    EXPECT_FLOAT_EQ(spectrogram.GetFrequencyPosition(100.0f), 0.0f);
+    EXPECT_NEAR(spectrogram.GetFrequencyPosition(800.0f), 0.5f, 1e-5f);
+    EXPECT_FLOAT_EQ(spectrogram.GetFrequencyPosition(20000.0f), 1.0f);
+}
+
+TEST(SpectrogramTest, FretBuzzDetectorPushesOneRowPerBuffer)
+{
+    FretBuzzDetector detector;
+    detector.Configure(AnalysisConfig(g_kSampleRate, 2048));
+
+    const size_t fftSize = detector.GetParameters().fftSize;
+    Spectrogram spectrogram(g_kSampleRate, fftSize, g_kBands, 16, 50.0f, 12000.0f, -100.0f, 0.0f);
+    detector.SetSpectrogram(&spectrogram);
+
+    const auto tone = GuitarDiagnostics::Util::GenerateSine(1000.0f, g_kSampleRate, 2048);
+    detector.ProcessBuffer(tone);
+    detector.ProcessBuffer(tone);
+
+    ASSERT_EQ(spectrogram.GetRowCount(), 2u);
+    const auto band = static_cast<size_t>(spectrogram.GetFrequencyPosition(1000.0f) * g_kBands);
+    EXPECT_NE(spectrogram.GetRow(1)[band], spectrogram.GetBackgroundColor());
+}
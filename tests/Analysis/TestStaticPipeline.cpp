@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/AnalysisClock.h"
+#include "Analysis/AnalyzerParameters.h"
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/StaticPipeline.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Util/SignalGenerator.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GuitarDiagnostics::Analysis;
+
+namespace
+{
+
+    /**
+     * @brief Appends its tag to a shared log on every call, to check call order.
+     */
+    template<char Tag> class LoggingAnalyzer final : public Analyzer
+    {
+    public:
+        std::string *log;
+        uint32_t configuredBufferSize;
+
+        LoggingAnalyzer() : log(nullptr), configuredBufferSize(0)
+        {
+        }
+
+        void Configure(const AnalysisConfig &config) override
+        {
+            configuredBufferSize = config.bufferSize;
+        }
+
+        void ProcessBuffer(std::span<const float>) override
+        {
+            log->push_back(Tag);
+        }
+
+        std::shared_ptr<AnalysisResult> GetLatestResult() const override
+        {
+            return nullptr;
+        }
+
+        void Reset() override
+        {
+            log->push_back('r');
+        }
+    };
+
+    using LoggingPipeline = StaticPipeline<LoggingAnalyzer<'a'>, LoggingAnalyzer<'b'>, LoggingAnalyzer<'c'>>;
+
+} // namespace
+
+TEST(StaticPipelineTest, RunsAnalyzersInDeclarationOrder)
+{
+    std::string log;
+    LoggingPipeline pipeline;
+    pipeline.ForEach([&log](auto &analyzer) { analyzer.log = &log; });
+
+    const std::vector<float> hop(64, 0.0f);
+    pipeline.ProcessBuffer(hop);
+    pipeline.ProcessBuffer(hop);
+    pipeline.Reset();
+
+    EXPECT_EQ(log, "abcabcrrr");
+}
+
+TEST(StaticPipelineTest, ProcessBlocksRunsEachAnalyzerOverTheBatch)
+{
+    std::string log;
+    LoggingPipeline pipeline;
+    SampleClock clock(48000.0f);
+    pipeline.Configure(AnalysisConfig(48000.0f, 64, &clock));
+    pipeline.ForEach([&log](auto &analyzer) { analyzer.log = &log; });
+
+    // Three whole hops and a partial one that is left for the caller.
+    const std::vector<float> samples(3 * 64 + 10, 0.0f);
+    pipeline.ProcessBlocks(samples, 64);
+
+    EXPECT_EQ(log, "aaabbbccc");
+    EXPECT_EQ(clock.GetFrames(), 192u);
+}
+
+TEST(StaticPipelineTest, ConfiguresEveryAnalyzer)
+{
+    LoggingPipeline pipeline;
+    pipeline.Configure(AnalysisConfig(48000.0f, 256));
+
+    EXPECT_EQ(pipeline.GetAnalyzerCount(), 3u);
+    EXPECT_EQ(pipeline.Get<LoggingAnalyzer<'a'>>().configuredBufferSize, 256u);
+    EXPECT_EQ(pipeline.Get<LoggingAnalyzer<'b'>>().configuredBufferSize, 256u);
+    EXPECT_EQ(pipeline.Get<LoggingAnalyzer<'c'>>().configuredBufferSize, 256u);
+}
+
+TEST(StaticPipelineTest, RunsTheApplicationAnalyzers)
+{
+    AnalyzerParameters parameters;
+    parameters.fretBuzz.numHarmonics = 6;
+
+    auto pipeline = std::make_unique<StaticPipeline<FretBuzzDetector, IntonationAnalyzer, StringHealthAnalyzer>>(
+        parameters.fretBuzz, parameters.intonation, parameters.stringHealth);
+    EXPECT_EQ(pipeline->Get<FretBuzzDetector>().GetParameters().numHarmonics, 6u);
+
+    constexpr float sampleRate = 48000.0f;
+    constexpr size_t hopSize = 2048;
+    pipeline->Configure(AnalysisConfig(sampleRate, hopSize));
+
+    const auto tone = GuitarDiagnostics::Util::GenerateHarmonicTone(110.0f, sampleRate, hopSize * 8, 5);
+    for (size_t offset = 0; offset + hopSize <= tone.size(); offset += hopSize)
+    {
+        pipeline->ProcessBuffer(std::span<const float>(tone.data() + offset, hopSize));
+    }
+
+    EXPECT_TRUE(pipeline->Get<FretBuzzDetector>().GetLatestResult()->isValid);
+    EXPECT_TRUE(pipeline->Get<IntonationAnalyzer>().GetLatestResult()->isValid);
+    EXPECT_TRUE(pipeline->Get<StringHealthAnalyzer>().GetLatestResult()->isValid);
+}
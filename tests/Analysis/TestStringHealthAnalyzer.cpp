@@ -1,45 +1,24 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
-#include <numbers>
-#include <random>
 
+#include "Analysis/AnalysisClock.h"
 #include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "Util/SignalGenerator.h"
 
 namespace
 {
 
     std::vector<float> GenerateSineWave(float frequency, float sampleRate, size_t numSamples, float amplitude = 1.0f)
     {
-        std::vector<float> buffer(numSamples);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (size_t i = 0; i < numSamples; ++i)
-        {
-            float phase = twoPi * frequency * static_cast<float>(i) / sampleRate;
-            buffer[i] = amplitude * std::sin(phase);
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateSine(frequency, sampleRate, numSamples, amplitude);
     }
 
-    std::vector<float> GenerateHealthyString(float fundamental, float sampleRate, size_t numSamples)
+    /**
+     * @brief Peak-normalizes a buffer so its largest positive sample is 1.
+     */
+    std::vector<float> NormalizePeak(std::vector<float> buffer)
     {
-        std::vector<float> buffer(numSamples, 0.0f);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (int harmonic = 1; harmonic <= 8; ++harmonic)
-        {
-            float amplitude = 1.0f / static_cast<float>(harmonic);
-            float freq = fundamental * static_cast<float>(harmonic);
-
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                float phase = twoPi * freq * static_cast<float>(i) / sampleRate;
-                float decay = std::exp(-0.5f * static_cast<float>(i) / static_cast<float>(numSamples));
-                buffer[i] += amplitude * std::sin(phase) * decay;
-            }
-        }
-
         float maxVal = *std::max_element(buffer.begin(), buffer.end());
         if (maxVal > 0.0f)
         {
@@ -52,43 +31,39 @@ namespace
         return buffer;
     }
 
-    std::vector<float> GenerateWornString(float fundamental, float sampleRate, size_t numSamples)
+    /**
+     * @brief Ten harmonic 1/n partials that lose 0.5 nepers over the buffer.
+     */
+    std::vector<float> GenerateHealthyString(float fundamental, float sampleRate, size_t numSamples)
     {
-        std::vector<float> buffer(numSamples, 0.0f);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        std::mt19937 rng(42);
-        std::uniform_real_distribution<float> dist(-0.05f, 0.05f);
-
-        for (int harmonic = 1; harmonic <= 4; ++harmonic)
-        {
-            float amplitude = 1.0f / static_cast<float>(harmonic * harmonic);
-            float freqDeviation = 1.0f + dist(rng) * 0.02f;
-            float freq = fundamental * static_cast<float>(harmonic) * freqDeviation;
-
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                float phase = twoPi * freq * static_cast<float>(i) / sampleRate;
-                float decay = std::exp(-3.0f * static_cast<float>(i) / static_cast<float>(numSamples));
-                buffer[i] += amplitude * std::sin(phase) * decay;
-            }
-        }
-
-        for (size_t i = 0; i < numSamples; ++i)
-        {
-            buffer[i] += dist(rng) * 0.1f;
-        }
-
-        float maxVal = *std::max_element(buffer.begin(), buffer.end());
-        if (maxVal > 0.0f)
-        {
-            for (auto &sample : buffer)
-            {
-                sample /= maxVal;
-            }
-        }
+        GuitarDiagnostics::Util::StringModelConfig config;
+        config.fundamental = fundamental;
+        config.inharmonicity = 0.0f;
+        config.numPartials = 10;
+        config.amplitude = 1.0f;
+        config.decayRate = 0.5f * sampleRate / static_cast<float>(numSamples);
+        config.decayPerPartial = 0.0f;
+        config.pluckPosition = 0.0f;
+
+        return NormalizePeak(GuitarDiagnostics::Util::GeneratePluckedString(config, sampleRate, numSamples));
+    }
 
-        return buffer;
+    /**
+     * @brief Ten stiff 1/n partials that lose 3 nepers over the buffer, faster on the upper partials, in noise.
+     */
+    std::vector<float> GenerateWornString(float fundamental, float sampleRate, size_t numSamples)
+    {
+        GuitarDiagnostics::Util::StringModelConfig config;
+        config.fundamental = fundamental;
+        config.inharmonicity = 1e-3f;
+        config.numPartials = 10;
+        config.amplitude = 1.0f;
+        config.decayRate = 3.0f * sampleRate / static_cast<float>(numSamples);
+        config.decayPerPartial = config.decayRate;
+        config.pluckPosition = 0.0f;
+
+        return NormalizePeak(GuitarDiagnostics::Util::GeneratePluckedString(
+            config, sampleRate, numSamples, GuitarDiagnostics::Util::BuzzConfig(), 0.005f));
     }
 
 } // namespace
@@ -269,6 +244,43 @@ TEST_F(StringHealthAnalyzerTest, ResetClearsHistory)
     EXPECT_EQ(result->fundamentalFrequency, 0.0f);
 }
 
+TEST_F(StringHealthAnalyzerTest, BatchedHopsMatchHopByHop)
+{
+    using namespace GuitarDiagnostics::Analysis;
+
+    const float sampleRate = 48000.0f;
+    const size_t bufferSize = 2048;
+    const size_t batchHops = 8;
+    const auto signal = GenerateHealthyString(110.0f, sampleRate, bufferSize * batchHops * 2);
+
+    SampleClock hopClock(sampleRate);
+    SampleClock batchClock(sampleRate);
+    StringHealthAnalyzer batched;
+    analyzer->Configure(AnalysisConfig(sampleRate, bufferSize, &hopClock));
+    batched.Configure(AnalysisConfig(sampleRate, bufferSize, &batchClock));
+
+    for (size_t offset = 0; offset + bufferSize <= signal.size(); offset += bufferSize)
+    {
+        hopClock.OnHop(bufferSize);
+        analyzer->ProcessBuffer(std::span<const float>(signal.data() + offset, bufferSize));
+    }
+    const size_t batchFrames = bufferSize * batchHops;
+    for (size_t offset = 0; offset + batchFrames <= signal.size(); offset += batchFrames)
+    {
+        batchClock.OnHop(batchFrames);
+        batched.ProcessBlocks(std::span<const float>(signal.data() + offset, batchFrames), bufferSize);
+    }
+
+    auto expected = std::dynamic_pointer_cast<StringHealthResult>(analyzer->GetLatestResult());
+    auto actual = std::dynamic_pointer_cast<StringHealthResult>(batched.GetLatestResult());
+    ASSERT_NE(actual, nullptr);
+    EXPECT_NE(expected->decayRate, 0.0f);
+    EXPECT_NEAR(actual->decayRate, expected->decayRate, std::abs(expected->decayRate) * 1e-4f);
+    EXPECT_NEAR(actual->healthScore, expected->healthScore, 1e-4f);
+    EXPECT_FLOAT_EQ(actual->spectralCentroid, expected->spectralCentroid);
+    EXPECT_FLOAT_EQ(actual->fundamentalFrequency, expected->fundamentalFrequency);
+}
+
 TEST_F(StringHealthAnalyzerTest, HealthScoreWithinRange)
 {
     const float sampleRate = 48000.0f;
@@ -289,3 +301,39 @@ TEST_F(StringHealthAnalyzerTest, HealthScoreWithinRange)
     EXPECT_GE(result->inharmonicity, 0.0f);
     EXPECT_LE(result->inharmonicity, 1.0f);
 }
+
+TEST(StringHealthParametersTest, OutOfRangeValuesAreClamped)
+{
+    GuitarDiagnostics::Analysis::StringHealthParameters parameters;
+    parameters.fftSize = 100;
+    parameters.numHarmonics = 0;
+    parameters.decayHistorySize = 1000;
+
+    GuitarDiagnostics::Analysis::StringHealthAnalyzer analyzer(parameters);
+
+    EXPECT_EQ(analyzer.GetParameters().fftSize, 256u);
+    EXPECT_EQ(analyzer.GetParameters().numHarmonics, 1u);
+    EXPECT_EQ(analyzer.GetParameters().decayHistorySize, 200u);
+}
+
+TEST(StringHealthParametersTest, ShortHistoryStillReportsDecay)
+{
+    GuitarDiagnostics::Analysis::StringHealthParameters parameters;
+    parameters.decayHistorySize = 10;
+
+    GuitarDiagnostics::Analysis::StringHealthAnalyzer analyzer(parameters);
+    analyzer.Configure(GuitarDiagnostics::Analysis::AnalysisConfig(48000.0f, 2048));
+
+    for (int i = 0; i < 20; ++i)
+    {
+        analyzer.ProcessBuffer(GenerateHealthyString(220.0f, 48000.0f, 2048));
+    }
+
+    auto result =
+        std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::StringHealthResult>(analyzer.GetLatestResult());
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->isValid);
+    EXPECT_GE(result->healthScore, 0.0f);
+    EXPECT_LE(result->healthScore, 1.0f);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "Analysis/Fretbuzz/FretBuzzDetector.h"
+#include "Analysis/Intonation/IntonationAnalyzer.h"
+#include "Analysis/ParameterStore.h"
+#include "Analysis/Spectrogram.h"
+#include "Analysis/StringHealth/StringHealthAnalyzer.h"
+#include "App/AudioProcessingLayer.h"
+#include "App/StationManager.h"
+#include "Audio/FileAudioSource.h"
+#include "Audio/NullAudioSource.h"
+#include "Audio/SyntheticAudioSource.h"
+
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <thread>
+
+using namespace GuitarDiagnostics;
+using namespace GuitarDiagnostics::App;
+
+namespace
+{
+
+    std::unique_ptr<Audio::AudioSource> MakeSyntheticSource(float fundamental)
+    {
+        Audio::SyntheticToneConfig tone;
+        tone.fundamental = fundamental;
+        auto source = std::make_unique<Audio::SyntheticAudioSource>(tone);
+        source->SetRealTimePacing(false);
+        return source;
+    }
+
+} // namespace
+
+class StationManagerTest : public ::testing::Test
+{
+protected:
+    StationManagerTest() : parameterStore(), stations(&parameterStore, 48000.0f, 512)
+    {
+    }
+
+    Analysis::ParameterStore parameterStore;
+    StationManager stations;
+};
+
+TEST_F(StationManagerTest, StationsHaveIsolatedPipelines)
+{
+    ASSERT_TRUE(stations.AddStation("A", std::make_unique<Audio::NullAudioSource>(), true));
+    ASSERT_TRUE(stations.AddStation("B", std::make_unique<Audio::NullAudioSource>(), false));
+    ASSERT_EQ(stations.GetStationCount(), 2u);
+
+    const Station &first = stations.GetStation(0);
+    const Station &second = stations.GetStation(1);
+    EXPECT_EQ(first.name, "A");
+    EXPECT_EQ(second.name, "B");
+    EXPECT_NE(first.ringBuffer.get(), second.ringBuffer.get());
+    EXPECT_NE(first.engine.get(), second.engine.get());
+
+    EXPECT_NE(first.monitorBuffer, nullptr);
+    EXPECT_NE(first.spectrogram, nullptr);
+    EXPECT_EQ(second.monitorBuffer, nullptr);
+    EXPECT_EQ(second.spectrogram, nullptr);
+
+    for (const Station *station : { &first, &second })
+    {
+        EXPECT_TRUE(station->audioLayer->IsOpen());
+        EXPECT_NE(station->engine->GetAnalyzer<Analysis::FretBuzzDetector>(), nullptr);
+        EXPECT_NE(station->engine->GetAnalyzer<Analysis::IntonationAnalyzer>(), nullptr);
+        EXPECT_NE(station->engine->GetAnalyzer<Analysis::StringHealthAnalyzer>(), nullptr);
+    }
+    EXPECT_NE(first.engine->GetAnalyzer<Analysis::FretBuzzDetector>(),
+        second.engine->GetAnalyzer<Analysis::FretBuzzDetector>());
+}
+
+TEST_F(StationManagerTest, FailedSourceIsNotAdded)
+{
+    const auto missing = std::filesystem::temp_directory_path() / "gd_station_manager_missing.wav";
+    EXPECT_FALSE(stations.AddStation("Missing", std::make_unique<Audio::FileAudioSource>(missing), false));
+    EXPECT_EQ(stations.GetStationCount(), 0u);
+    EXPECT_FALSE(stations.Start(1));
+}
+
+TEST_F(StationManagerTest, AllStationsRunOnSharedWorkers)
+{
+    ASSERT_TRUE(stations.AddStation("E", MakeSyntheticSource(82.41f), true));
+    ASSERT_TRUE(stations.AddStation("A", MakeSyntheticSource(110.0f), false));
+    ASSERT_TRUE(stations.AddStation("D", MakeSyntheticSource(146.83f), false));
+
+    ASSERT_TRUE(stations.Start(2));
+    EXPECT_TRUE(stations.IsRunning());
+    EXPECT_EQ(stations.GetWorkerCount(), 2u);
+    EXPECT_FALSE(stations.AddStation("G", std::make_unique<Audio::NullAudioSource>(), false));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    auto allAnalyzed = [&]() {
+        for (size_t i = 0; i < stations.GetStationCount(); ++i)
+        {
+            if (stations.GetStation(i).engine->GetResultSequence() < 8)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    while (!allAnalyzed() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    stations.Stop();
+    EXPECT_FALSE(stations.IsRunning());
+    EXPECT_EQ(stations.GetWorkerCount(), 0u);
+    ASSERT_TRUE(allAnalyzed());
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < stations.GetStationCount(); ++i)
+    {
+        const auto &metrics = stations.GetStation(i).engine->GetMetrics();
+        EXPECT_EQ(metrics.GetHopHistogram().GetCount(), stations.GetStation(i).engine->GetResultSequence());
+        total += stations.GetStation(i).engine->GetResultSequence();
+    }
+    EXPECT_EQ(stations.GetResultSequence(), total);
+    EXPECT_GT(stations.GetStation(0).spectrogram->GetRowCount(), 0u);
+}
+
+TEST_F(StationManagerTest, EngineCommandsWaitForTheWorkerPool)
+{
+    ASSERT_TRUE(stations.AddStation("E", MakeSyntheticSource(82.41f), false));
+    ASSERT_TRUE(stations.Start(1));
+
+    Analysis::AnalysisEngine &engine = *stations.GetStation(0).engine;
+    EXPECT_FALSE(engine.Start());
+
+    auto reset = engine.Reset();
+    ASSERT_EQ(reset.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    EXPECT_TRUE(reset.get());
+    stations.Stop();
+}
+
+TEST_F(StationManagerTest, EngineWithOwnThreadIsNotPooled)
+{
+    ASSERT_TRUE(stations.AddStation("E", std::make_unique<Audio::NullAudioSource>(), false));
+    ASSERT_TRUE(stations.GetStation(0).engine->Start());
+
+    EXPECT_FALSE(stations.Start(1));
+    EXPECT_FALSE(stations.IsRunning());
+    stations.GetStation(0).engine->Stop();
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include "Audio/FileAudioSource.h"
+#include "Audio/NullAudioSource.h"
+#include "Audio/SyntheticAudioSource.h"
+#include "Audio/WavFile.h"
+#include "Util/LockFreeRingBuffer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+using namespace GuitarDiagnostics::Audio;
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    std::vector<float> GenerateRamp(size_t numSamples)
+    {
+        std::vector<float> buffer(numSamples);
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            buffer[i] = static_cast<float>(i) / static_cast<float>(numSamples);
+        }
+        return buffer;
+    }
+
+    bool WaitFor(const std::function<bool()> &condition, std::chrono::milliseconds timeout)
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            if (condition())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return condition();
+    }
+
+} // namespace
+
+class AudioSourceTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ringBuffer = std::make_unique<LockFreeRingBuffer<float>>(16384);
+        wavPath = std::filesystem::temp_directory_path() / "gd_audio_source_test.wav";
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove(wavPath, ec);
+        ringBuffer.reset();
+    }
+
+    std::unique_ptr<LockFreeRingBuffer<float>> ringBuffer;
+    std::filesystem::path wavPath;
+};
+
+TEST_F(AudioSourceTest, NullSourceProducesNothing)
+{
+    NullAudioSource source;
+    source.SetRingBuffer(ringBuffer.get());
+
+    ASSERT_TRUE(source.Open(48000.0f, 512));
+    ASSERT_TRUE(source.Start());
+    EXPECT_TRUE(source.IsRunning());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(ringBuffer->GetAvailableRead(), 0);
+
+    source.Close();
+    EXPECT_FALSE(source.IsOpen());
+    EXPECT_FALSE(source.IsRunning());
+}
+
+TEST_F(AudioSourceTest, SyntheticSourcePushesBlocks)
+{
+    SyntheticAudioSource source{ SyntheticToneConfig() };
+    source.SetRingBuffer(ringBuffer.get());
+    source.SetRealTimePacing(false);
+
+    ASSERT_TRUE(source.Open(48000.0f, 512));
+    ASSERT_TRUE(source.Start());
+
+    EXPECT_TRUE(WaitFor([&]() { return ringBuffer->GetAvailableRead() >= 4096; }, std::chrono::seconds(2)));
+    source.Stop();
+
+    EXPECT_EQ(ringBuffer->GetAvailableRead() % 512, 0);
+
+    std::vector<float> output(512);
+    ASSERT_EQ(ringBuffer->Read(output), 512);
+
+    float peak = 0.0f;
+    for (float sample : output)
+    {
+        peak = std::max(peak, std::abs(sample));
+    }
+    EXPECT_GT(peak, 0.1f);
+    EXPECT_LE(peak, 1.0f);
+}
+
+TEST_F(AudioSourceTest, FreeRunningSourceDoesNotOverflow)
+{
+    SyntheticAudioSource source{ SyntheticToneConfig() };
+    source.SetRingBuffer(ringBuffer.get());
+    source.SetRealTimePacing(false);
+
+    ASSERT_TRUE(source.Open(48000.0f, 512));
+    ASSERT_TRUE(source.Start());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    source.Stop();
+
+    EXPECT_EQ(source.GetDroppedSamples(), 0u);
+}
+
+TEST_F(AudioSourceTest, WavRoundTrip)
+{
+    auto input = GenerateRamp(1000);
+    ASSERT_TRUE(WriteWavFile(wavPath, input, 44100.0f));
+
+    auto wav = ReadWavFile(wavPath);
+    ASSERT_TRUE(wav.has_value());
+    EXPECT_FLOAT_EQ(wav->sampleRate, 44100.0f);
+    EXPECT_EQ(wav->channels, 1u);
+    ASSERT_EQ(wav->samples.size(), input.size());
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(wav->samples[i], input[i]);
+    }
+}
+
+TEST_F(AudioSourceTest, FileSourcePlaysWholeFile)
+{
+    auto input = GenerateRamp(2000);
+    ASSERT_TRUE(WriteWavFile(wavPath, input, 48000.0f));
+
+    FileAudioSource source(wavPath);
+    source.SetRingBuffer(ringBuffer.get());
+    source.SetRealTimePacing(false);
+
+    ASSERT_TRUE(source.Open(48000.0f, 512));
+    EXPECT_EQ(source.GetTotalFrames(), input.size());
+    ASSERT_TRUE(source.Start());
+
+    EXPECT_TRUE(WaitFor([&]() { return source.IsFinished(); }, std::chrono::seconds(2)));
+    EXPECT_FALSE(source.IsRunning());
+
+    std::vector<float> output(4096);
+    ASSERT_EQ(ringBuffer->Read(output), input.size());
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(output[i], input[i]);
+    }
+}
+
+TEST_F(AudioSourceTest, MonitorBufferReceivesCopy)
+{
+    auto input = GenerateRamp(2000);
+    ASSERT_TRUE(WriteWavFile(wavPath, input, 48000.0f));
+
+    LockFreeRingBuffer<float> monitorBuffer(1024);
+    FileAudioSource source(wavPath);
+    source.SetRingBuffer(ringBuffer.get());
+    source.SetMonitorBuffer(&monitorBuffer);
+    source.SetRealTimePacing(false);
+
+    ASSERT_TRUE(source.Open(48000.0f, 512));
+    ASSERT_TRUE(source.Start());
+    EXPECT_TRUE(WaitFor([&]() { return source.IsFinished(); }, std::chrono::seconds(2)));
+
+    // The monitor is full after the first blocks; the analysis stream must still be complete.
+    EXPECT_EQ(ringBuffer->GetAvailableRead(), input.size());
+    EXPECT_EQ(source.GetDroppedSamples(), 0u);
+
+    std::vector<float> monitored(1024);
+    const size_t monitoredCount = monitorBuffer.Read(monitored);
+    ASSERT_GT(monitoredCount, 0u);
+    for (size_t i = 0; i < monitoredCount; ++i)
+    {
+        EXPECT_FLOAT_EQ(monitored[i], input[i]);
+    }
+}
+
+TEST_F(AudioSourceTest, FileSourcePlaysAtFileSampleRate)
+{
+    auto input = GenerateRamp(100);
+    ASSERT_TRUE(WriteWavFile(wavPath, input, 44100.0f));
+
+    FileAudioSource source(wavPath);
+    ASSERT_TRUE(source.Open(48000.0f, 512));
+    EXPECT_FLOAT_EQ(source.GetSampleRate(), 44100.0f);
+
+    source.Close();
+    EXPECT_FLOAT_EQ(source.GetSampleRate(), 0.0f);
+}
+
+TEST_F(AudioSourceTest, FileSourceMissingFile)
+{
+    FileAudioSource source(wavPath);
+    EXPECT_FALSE(source.Open(48000.0f, 512));
+}
@@ -1,75 +1,33 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
-#include <numbers>
-#include <random>
 #include <thread>
 
+#include "Analysis/AnalysisClock.h"
 #include "Analysis/Fretbuzz/FretBuzzDetector.h"
 #include "Analysis/Intonation/IntonationAnalyzer.h"
 #include "Analysis/StringHealth/StringHealthAnalyzer.h"
 #include "App/AudioProcessingLayer.h"
 #include "Util/LockFreeRingBuffer.h"
 #include "Analysis/AnalysisEngine.h"
+#include "Util/SignalGenerator.h"
 
 namespace
 {
 
     std::vector<float> GenerateSineWave(float frequency, float sampleRate, size_t numSamples, float amplitude = 1.0f)
     {
-        std::vector<float> buffer(numSamples);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (size_t i = 0; i < numSamples; ++i)
-        {
-            float phase = twoPi * frequency * static_cast<float>(i) / sampleRate;
-            buffer[i] = amplitude * std::sin(phase);
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateSine(frequency, sampleRate, numSamples, amplitude);
     }
 
     std::vector<float> GenerateHarmonicSignal(float fundamental, float sampleRate, size_t numSamples)
     {
-        std::vector<float> buffer(numSamples, 0.0f);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
-
-        for (int harmonic = 1; harmonic <= 5; ++harmonic)
-        {
-            float amplitude = 1.0f / static_cast<float>(harmonic);
-            float freq = fundamental * static_cast<float>(harmonic);
-
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                float phase = twoPi * freq * static_cast<float>(i) / sampleRate;
-                buffer[i] += amplitude * std::sin(phase);
-            }
-        }
-
-        float maxVal = *std::max_element(buffer.begin(), buffer.end());
-        if (maxVal > 0.0f)
-        {
-            for (auto &sample : buffer)
-            {
-                sample /= maxVal;
-            }
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateHarmonicTone(fundamental, sampleRate, numSamples, 5);
     }
 
     std::vector<float> GenerateWhiteNoise(size_t numSamples, float amplitude = 0.1f)
     {
-        std::vector<float> buffer(numSamples);
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> dist(-amplitude, amplitude);
-
-        for (size_t i = 0; i < numSamples; ++i)
-        {
-            buffer[i] = dist(gen);
-        }
-
-        return buffer;
+        return GuitarDiagnostics::Util::GenerateWhiteNoise(numSamples, amplitude);
     }
 
     std::vector<float> GenerateSilence(size_t numSamples)
@@ -93,22 +51,16 @@ namespace
 
     std::vector<float> GenerateDecayingHarmonic(float fundamental, float sampleRate, size_t numSamples, float decayRate)
     {
-        std::vector<float> buffer(numSamples, 0.0f);
-        const float twoPi = 2.0f * std::numbers::pi_v<float>;
+        GuitarDiagnostics::Util::StringModelConfig config;
+        config.fundamental = fundamental;
+        config.inharmonicity = 0.0f;
+        config.numPartials = 10;
+        config.amplitude = 1.0f;
+        config.decayRate = decayRate;
+        config.decayPerPartial = 0.0f;
+        config.pluckPosition = 0.0f;
 
-        for (int harmonic = 1; harmonic <= 10; ++harmonic)
-        {
-            float amplitude = 1.0f / static_cast<float>(harmonic);
-            float freq = fundamental * static_cast<float>(harmonic);
-
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                float time = static_cast<float>(i) / sampleRate;
-                float decay = std::exp(-decayRate * time);
-                float phase = twoPi * freq * time;
-                buffer[i] += amplitude * decay * std::sin(phase);
-            }
-        }
+        auto buffer = GuitarDiagnostics::Util::GeneratePluckedString(config, sampleRate, numSamples);
 
         float maxVal = *std::max_element(buffer.begin(), buffer.end());
         if (maxVal > 0.0f)
@@ -135,7 +87,8 @@ protected:
 
         ringBuffer = std::make_unique<GuitarDiagnostics::Util::LockFreeRingBuffer<float>>(ringBufferSize);
 
-        config = std::make_unique<GuitarDiagnostics::Analysis::AnalysisConfig>(sampleRate, bufferSize);
+        clock = std::make_unique<GuitarDiagnostics::Analysis::SampleClock>(sampleRate);
+        config = std::make_unique<GuitarDiagnostics::Analysis::AnalysisConfig>(sampleRate, bufferSize, clock.get());
 
         engine = std::make_unique<GuitarDiagnostics::Analysis::AnalysisEngine>(ringBuffer.get(), *config);
     }
@@ -149,6 +102,24 @@ protected:
         engine.reset();
         ringBuffer.reset();
         config.reset();
+        clock.reset();
+    }
+
+    /**
+     * @brief Writes a signal a number of times and analyzes it on the calling thread.
+     *
+     * The engine runs on the SampleClock, so time-dependent analysis sees exactly the duration
+     * of the audio fed, without the test waiting for a worker thread.
+     */
+    void Feed(const std::vector<float> &signal, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            ASSERT_TRUE(ringBuffer->Write(signal));
+            while (engine->ProcessNextBlock())
+            {
+            }
+        }
     }
 
     float sampleRate;
@@ -156,6 +127,7 @@ protected:
     size_t ringBufferSize;
 
     std::unique_ptr<GuitarDiagnostics::Util::LockFreeRingBuffer<float>> ringBuffer;
+    std::unique_ptr<GuitarDiagnostics::Analysis::SampleClock> clock;
     std::unique_ptr<GuitarDiagnostics::Analysis::AnalysisConfig> config;
     std::unique_ptr<GuitarDiagnostics::Analysis::AnalysisEngine> engine;
 };
@@ -170,17 +142,9 @@ TEST_F(AnalysisPipelineTest, AllAnalyzersProcessSimultaneously)
     engine->RegisterAnalyzer(fretBuzzDetector);
     engine->RegisterAnalyzer(stringHealthAnalyzer);
 
-    ASSERT_TRUE(engine->Start());
-
     auto testSignal = GenerateHarmonicSignal(110.0f, sampleRate, bufferSize);
 
-    for (int i = 0; i < 20; ++i)
-    {
-        ringBuffer->Write(testSignal);
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    Feed(testSignal, 20);
 
     auto intonationResult =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::IntonationResult>(intonationAnalyzer->GetLatestResult());
@@ -196,8 +160,6 @@ TEST_F(AnalysisPipelineTest, AllAnalyzersProcessSimultaneously)
     EXPECT_TRUE(intonationResult->isValid);
     EXPECT_TRUE(fretBuzzResult->isValid);
     EXPECT_TRUE(stringHealthResult->isValid);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, ThreadSafeResultRetrieval)
@@ -220,13 +182,13 @@ TEST_F(AnalysisPipelineTest, ThreadSafeResultRetrieval)
         for (int i = 0; i < 100; ++i)
         {
             ringBuffer->Write(testSignal);
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            std::this_thread::yield();
         }
         running = false;
     });
 
     std::thread consumerThread([&]() {
-        while (running)
+        do
         {
             auto intonationResult = intonationAnalyzer->GetLatestResult();
             auto fretBuzzResult = fretBuzzDetector->GetLatestResult();
@@ -237,8 +199,8 @@ TEST_F(AnalysisPipelineTest, ThreadSafeResultRetrieval)
                 readCount.fetch_add(1, std::memory_order_relaxed);
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
+            std::this_thread::yield();
+        } while (running);
     });
 
     producerThread.join();
@@ -259,17 +221,9 @@ TEST_F(AnalysisPipelineTest, ResetAllAnalyzers)
     engine->RegisterAnalyzer(fretBuzzDetector);
     engine->RegisterAnalyzer(stringHealthAnalyzer);
 
-    ASSERT_TRUE(engine->Start());
-
     auto testSignal = GenerateHarmonicSignal(110.0f, sampleRate, bufferSize);
 
-    for (int i = 0; i < 10; ++i)
-    {
-        ringBuffer->Write(testSignal);
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    Feed(testSignal, 10);
 
     engine->Reset();
 
@@ -279,8 +233,6 @@ TEST_F(AnalysisPipelineTest, ResetAllAnalyzers)
     ASSERT_NE(intonationResult, nullptr);
     EXPECT_EQ(intonationResult->state, GuitarDiagnostics::Analysis::IntonationState::Idle);
     EXPECT_EQ(intonationResult->openStringFrequency, 0.0f);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, ContinuousProcessing)
@@ -288,28 +240,18 @@ TEST_F(AnalysisPipelineTest, ContinuousProcessing)
     auto fretBuzzDetector = std::make_shared<GuitarDiagnostics::Analysis::FretBuzzDetector>();
     engine->RegisterAnalyzer(fretBuzzDetector);
 
-    ASSERT_TRUE(engine->Start());
-
     for (int frequency = 82; frequency <= 330; frequency += 82)
     {
         auto testSignal = GenerateSineWave(static_cast<float>(frequency), sampleRate, bufferSize);
 
-        for (int i = 0; i < 5; ++i)
-        {
-            ringBuffer->Write(testSignal);
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
+        Feed(testSignal, 5);
     }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
     auto result =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(fretBuzzDetector->GetLatestResult());
 
     ASSERT_NE(result, nullptr);
     EXPECT_TRUE(result->isValid);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, EngineStartStop)
@@ -334,14 +276,11 @@ TEST_F(AnalysisPipelineTest, EmptyBufferHandling)
     auto analyzer = std::make_shared<GuitarDiagnostics::Analysis::IntonationAnalyzer>();
     engine->RegisterAnalyzer(analyzer);
 
-    ASSERT_TRUE(engine->Start());
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(engine->ProcessNextBlock());
+    EXPECT_EQ(clock->GetFrames(), 0u);
 
     auto result = analyzer->GetLatestResult();
     ASSERT_NE(result, nullptr);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, AudioProcessingLayerInitialization)
@@ -365,15 +304,29 @@ TEST_F(AnalysisPipelineTest, HighFrequencyWriteStressTest)
     ASSERT_TRUE(engine->Start());
 
     auto testSignal = GenerateHarmonicSignal(110.0f, sampleRate, bufferSize);
+    const uint64_t hops = 100;
 
-    for (int i = 0; i < 100; ++i)
+    // Write as fast as the ring accepts; a full ring waits for the worker to drain it.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    uint64_t written = 0;
+    while (written < hops && std::chrono::steady_clock::now() < deadline)
     {
-        bool writeSuccess = ringBuffer->Write(testSignal);
-        EXPECT_TRUE(writeSuccess);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (ringBuffer->Write(testSignal))
+        {
+            ++written;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
     }
+    ASSERT_EQ(written, hops);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    while (engine->GetResultSequence() < hops && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(engine->GetResultSequence(), hops);
 
     auto fretBuzzResult =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(fretBuzzDetector->GetLatestResult());
@@ -398,25 +351,15 @@ TEST_F(AnalysisPipelineTest, SilenceHandling)
     auto fretBuzzDetector = std::make_shared<GuitarDiagnostics::Analysis::FretBuzzDetector>();
     engine->RegisterAnalyzer(fretBuzzDetector);
 
-    ASSERT_TRUE(engine->Start());
-
     auto silence = GenerateSilence(bufferSize);
 
-    for (int i = 0; i < 10; ++i)
-    {
-        ringBuffer->Write(silence);
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    Feed(silence, 10);
 
     auto result =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(fretBuzzDetector->GetLatestResult());
 
     ASSERT_NE(result, nullptr);
     EXPECT_TRUE(result->isValid);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, FretBuzzDetectionWithNoiseSignal)
@@ -424,17 +367,9 @@ TEST_F(AnalysisPipelineTest, FretBuzzDetectionWithNoiseSignal)
     auto fretBuzzDetector = std::make_shared<GuitarDiagnostics::Analysis::FretBuzzDetector>();
     engine->RegisterAnalyzer(fretBuzzDetector);
 
-    ASSERT_TRUE(engine->Start());
-
     auto buzzSignal = GenerateFretBuzzSignal(110.0f, sampleRate, bufferSize);
 
-    for (int i = 0; i < 20; ++i)
-    {
-        ringBuffer->Write(buzzSignal);
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    Feed(buzzSignal, 20);
 
     auto result =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(fretBuzzDetector->GetLatestResult());
@@ -443,8 +378,6 @@ TEST_F(AnalysisPipelineTest, FretBuzzDetectionWithNoiseSignal)
     EXPECT_TRUE(result->isValid);
     EXPECT_GE(result->buzzScore, 0.0f);
     EXPECT_LE(result->buzzScore, 1.0f);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, StringHealthWithDecayingSignal)
@@ -452,17 +385,9 @@ TEST_F(AnalysisPipelineTest, StringHealthWithDecayingSignal)
     auto stringHealthAnalyzer = std::make_shared<GuitarDiagnostics::Analysis::StringHealthAnalyzer>();
     engine->RegisterAnalyzer(stringHealthAnalyzer);
 
-    ASSERT_TRUE(engine->Start());
-
     auto decayingSignal = GenerateDecayingHarmonic(110.0f, sampleRate, bufferSize, 2.0f);
 
-    for (int i = 0; i < 30; ++i)
-    {
-        ringBuffer->Write(decayingSignal);
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    Feed(decayingSignal, 30);
 
     auto result = std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::StringHealthResult>(
         stringHealthAnalyzer->GetLatestResult());
@@ -471,8 +396,6 @@ TEST_F(AnalysisPipelineTest, StringHealthWithDecayingSignal)
     EXPECT_TRUE(result->isValid);
     EXPECT_GE(result->healthScore, 0.0f);
     EXPECT_LE(result->healthScore, 1.0f);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, IntonationStateTransitions)
@@ -480,8 +403,6 @@ TEST_F(AnalysisPipelineTest, IntonationStateTransitions)
     auto intonationAnalyzer = std::make_shared<GuitarDiagnostics::Analysis::IntonationAnalyzer>();
     engine->RegisterAnalyzer(intonationAnalyzer);
 
-    ASSERT_TRUE(engine->Start());
-
     auto result =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::IntonationResult>(intonationAnalyzer->GetLatestResult());
     ASSERT_NE(result, nullptr);
@@ -489,21 +410,13 @@ TEST_F(AnalysisPipelineTest, IntonationStateTransitions)
 
     auto openStringSignal = GenerateHarmonicSignal(82.41f, sampleRate, bufferSize);
 
-    for (int i = 0; i < 30; ++i)
-    {
-        ringBuffer->Write(openStringSignal);
-        std::this_thread::sleep_for(std::chrono::milliseconds(20));
-    }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    Feed(openStringSignal, 30);
 
     result =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::IntonationResult>(intonationAnalyzer->GetLatestResult());
     ASSERT_NE(result, nullptr);
     EXPECT_TRUE(result->state == GuitarDiagnostics::Analysis::IntonationState::OpenString
                 || result->state == GuitarDiagnostics::Analysis::IntonationState::WaitFor12thFret);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, RapidFrequencyChanges)
@@ -511,8 +424,6 @@ TEST_F(AnalysisPipelineTest, RapidFrequencyChanges)
     auto fretBuzzDetector = std::make_shared<GuitarDiagnostics::Analysis::FretBuzzDetector>();
     engine->RegisterAnalyzer(fretBuzzDetector);
 
-    ASSERT_TRUE(engine->Start());
-
     float frequencies[] = { 82.41f, 110.0f, 146.83f, 196.0f, 246.94f, 329.63f };
     const int numFrequencies = sizeof(frequencies) / sizeof(frequencies[0]);
 
@@ -520,22 +431,14 @@ TEST_F(AnalysisPipelineTest, RapidFrequencyChanges)
     {
         auto signal = GenerateHarmonicSignal(frequencies[i], sampleRate, bufferSize);
 
-        for (int j = 0; j < 5; ++j)
-        {
-            ringBuffer->Write(signal);
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-        }
+        Feed(signal, 5);
     }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(200));
-
     auto result =
         std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(fretBuzzDetector->GetLatestResult());
 
     ASSERT_NE(result, nullptr);
     EXPECT_TRUE(result->isValid);
-
-    engine->Stop();
 }
 
 TEST_F(AnalysisPipelineTest, BufferOverflowPrevention)
@@ -567,19 +470,11 @@ TEST_F(AnalysisPipelineTest, MultipleResetCycles)
     engine->RegisterAnalyzer(fretBuzzDetector);
     engine->RegisterAnalyzer(intonationAnalyzer);
 
-    ASSERT_TRUE(engine->Start());
-
     for (int cycle = 0; cycle < 3; ++cycle)
     {
         auto testSignal = GenerateHarmonicSignal(110.0f, sampleRate, bufferSize);
 
-        for (int i = 0; i < 10; ++i)
-        {
-            ringBuffer->Write(testSignal);
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        Feed(testSignal, 10);
 
         auto fretBuzzResult =
             std::dynamic_pointer_cast<GuitarDiagnostics::Analysis::FretBuzzResult>(fretBuzzDetector->GetLatestResult());
@@ -598,6 +493,4 @@ TEST_F(AnalysisPipelineTest, MultipleResetCycles)
         ASSERT_NE(intonationResult, nullptr);
         EXPECT_EQ(intonationResult->state, GuitarDiagnostics::Analysis::IntonationState::Idle);
     }
-
-    engine->Stop();
 }
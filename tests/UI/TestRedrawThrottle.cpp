@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "UI/RedrawThrottle.h"
+
+#include <chrono>
+
+using namespace GuitarDiagnostics::UI;
+using namespace std::chrono_literals;
+
+class RedrawThrottleTest : public ::testing::Test
+{
+protected:
+    RedrawThrottle throttle;
+    RedrawThrottle::Clock::time_point start;
+
+    RedrawThrottleTest() : throttle(30ms, 500ms, 200ms), start(RedrawThrottle::Clock::now())
+    {
+    }
+};
+
+TEST_F(RedrawThrottleTest, FirstFrameIsDrawnImmediately)
+{
+    EXPECT_EQ(throttle.GetWaitTime(0, start), RedrawThrottle::Clock::duration::zero());
+}
+
+TEST_F(RedrawThrottleTest, IdleFramesUseIdleInterval)
+{
+    throttle.MarkRendered(7, start);
+
+    EXPECT_EQ(throttle.GetWaitTime(7, start + 100ms), 400ms);
+    EXPECT_EQ(throttle.GetWaitTime(7, start + 600ms), RedrawThrottle::Clock::duration::zero());
+}
+
+TEST_F(RedrawThrottleTest, NewResultsAreRateLimited)
+{
+    throttle.MarkRendered(7, start);
+
+    EXPECT_EQ(throttle.GetWaitTime(8, start + 10ms), 20ms);
+    EXPECT_EQ(throttle.GetWaitTime(8, start + 30ms), RedrawThrottle::Clock::duration::zero());
+
+    throttle.MarkRendered(8, start + 30ms);
+    EXPECT_EQ(throttle.GetWaitTime(8, start + 40ms), 490ms);
+}
+
+TEST_F(RedrawThrottleTest, InputKeepsFullRate)
+{
+    throttle.MarkRendered(7, start);
+    throttle.NotifyInput(start + 5ms);
+
+    EXPECT_EQ(throttle.GetWaitTime(7, start + 10ms), RedrawThrottle::Clock::duration::zero());
+    EXPECT_EQ(throttle.GetWaitTime(7, start + 204ms), RedrawThrottle::Clock::duration::zero());
+    EXPECT_EQ(throttle.GetWaitTime(7, start + 205ms), 295ms);
+}
+
+TEST_F(RedrawThrottleTest, DisabledDrawsEveryFrame)
+{
+    throttle.MarkRendered(7, start);
+    throttle.SetEnabled(false);
+
+    EXPECT_FALSE(throttle.IsEnabled());
+    EXPECT_EQ(throttle.GetWaitTime(7, start + 1ms), RedrawThrottle::Clock::duration::zero());
+    EXPECT_EQ(throttle.GetRenderedFrames(), 1u);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include "Util/AllocationGuard.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    class AllocationGuardTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!AllocationGuard::IsEnabled())
+            {
+                GTEST_SKIP() << "Built without GD_ENABLE_ALLOCATION_GUARD";
+            }
+
+            previousPolicy = AllocationGuard::GetPolicy();
+            AllocationGuard::SetPolicy(AllocationGuard::Policy::Count);
+            AllocationGuard::ResetViolationCount();
+        }
+
+        void TearDown() override
+        {
+            if (AllocationGuard::IsEnabled())
+            {
+                AllocationGuard::SetPolicy(previousPolicy);
+            }
+        }
+
+        AllocationGuard::Policy previousPolicy = AllocationGuard::Policy::Log;
+    };
+
+} // namespace
+
+TEST_F(AllocationGuardTest, AllocationOutsideScopeIsAllowed)
+{
+    auto value = std::make_unique<int>(42);
+    std::vector<float> buffer(1024);
+
+    EXPECT_EQ(AllocationGuard::GetViolationCount(), 0u);
+}
+
+TEST_F(AllocationGuardTest, AllocationInsideScopeIsCounted)
+{
+    std::unique_ptr<int> value;
+    {
+        NoAllocationScope scope;
+        value = std::make_unique<int>(42);
+    }
+
+    EXPECT_EQ(*value, 42);
+    EXPECT_EQ(AllocationGuard::GetViolationCount(), 1u);
+}
+
+TEST_F(AllocationGuardTest, PreallocatedWorkIsClean)
+{
+    std::vector<float> buffer;
+    buffer.reserve(512);
+    {
+        NoAllocationScope scope;
+        for (int i = 0; i < 512; ++i)
+        {
+            buffer.push_back(static_cast<float>(i));
+        }
+        buffer.clear();
+    }
+
+    EXPECT_EQ(AllocationGuard::GetViolationCount(), 0u);
+}
+
+TEST_F(AllocationGuardTest, ScopesNest)
+{
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(2);
+    {
+        NoAllocationScope outer;
+        {
+            NoAllocationScope inner;
+            values.push_back(std::make_unique<int>(1));
+        }
+        values.push_back(std::make_unique<int>(2));
+    }
+    values.push_back(std::make_unique<int>(3));
+
+    EXPECT_EQ(AllocationGuard::GetViolationCount(), 2u);
+}
+
+TEST_F(AllocationGuardTest, ScopeOnlyAppliesToItsThread)
+{
+    std::atomic<bool> go{ false };
+    std::atomic<bool> done{ false };
+    std::unique_ptr<int> value;
+
+    std::thread other([&]() {
+        while (!go.load())
+        {
+            std::this_thread::yield();
+        }
+        value = std::make_unique<int>(7);
+        done.store(true);
+    });
+
+    {
+        NoAllocationScope scope;
+        go.store(true);
+        while (!done.load())
+        {
+            std::this_thread::yield();
+        }
+    }
+    other.join();
+
+    EXPECT_EQ(*value, 7);
+    EXPECT_EQ(AllocationGuard::GetViolationCount(), 0u);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "Util/Arena.h"
+
+#include <chrono>
+#include <cstdint>
+
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+    bool IsCacheLineAligned(const void *pointer)
+    {
+        return reinterpret_cast<uintptr_t>(pointer) % Arena::g_kAlignment == 0;
+    }
+} // namespace
+
+TEST(ArenaTest, EmptyArenaRejectsAllocations)
+{
+    Arena arena;
+
+    EXPECT_EQ(arena.GetCapacity(), 0u);
+    EXPECT_TRUE(arena.Allocate<float>(1).empty());
+}
+
+TEST(ArenaTest, FootprintRoundsUpToCacheLines)
+{
+    EXPECT_EQ(Arena::GetFootprint<float>(0), 0u);
+    EXPECT_EQ(Arena::GetFootprint<float>(1), 64u);
+    EXPECT_EQ(Arena::GetFootprint<float>(16), 64u);
+    EXPECT_EQ(Arena::GetFootprint<float>(17), 128u);
+    EXPECT_EQ(Arena::GetFootprint<double>(9), 128u);
+}
+
+TEST(ArenaTest, BuffersAreContiguousAlignedAndZeroed)
+{
+    Arena arena;
+    arena.Reset(Arena::GetFootprint<float>(10) + Arena::GetFootprint<double>(20));
+
+    auto floats = arena.Allocate<float>(10);
+    auto doubles = arena.Allocate<double>(20);
+    ASSERT_EQ(floats.size(), 10u);
+    ASSERT_EQ(doubles.size(), 20u);
+
+    EXPECT_TRUE(IsCacheLineAligned(floats.data()));
+    EXPECT_TRUE(IsCacheLineAligned(doubles.data()));
+    EXPECT_EQ(reinterpret_cast<const std::byte *>(doubles.data()),
+        reinterpret_cast<const std::byte *>(floats.data()) + Arena::GetFootprint<float>(10));
+
+    for (float value : floats)
+    {
+        EXPECT_EQ(value, 0.0f);
+    }
+    for (double value : doubles)
+    {
+        EXPECT_EQ(value, 0.0);
+    }
+    EXPECT_EQ(arena.GetUsed(), arena.GetCapacity());
+}
+
+TEST(ArenaTest, AllocationBeyondCapacityFails)
+{
+    Arena arena;
+    arena.Reset(Arena::GetFootprint<float>(16));
+
+    EXPECT_TRUE(arena.Allocate<float>(17).empty());
+    EXPECT_EQ(arena.Allocate<float>(16).size(), 16u);
+    EXPECT_TRUE(arena.Allocate<float>(1).empty());
+}
+
+TEST(ArenaTest, ResetReleasesEverything)
+{
+    Arena arena;
+    arena.Reset(Arena::GetFootprint<float>(8));
+    auto first = arena.Allocate<float>(8);
+    first[0] = 1.0f;
+
+    arena.Reset(Arena::GetFootprint<std::chrono::steady_clock::time_point>(4));
+    EXPECT_EQ(arena.GetUsed(), 0u);
+    auto times = arena.Allocate<std::chrono::steady_clock::time_point>(4);
+    ASSERT_EQ(times.size(), 4u);
+    EXPECT_EQ(times[0], std::chrono::steady_clock::time_point());
+
+    arena.Reset(0);
+    EXPECT_EQ(arena.GetCapacity(), 0u);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "Util/LatencyHistogram.h"
+
+#include <cstdint>
+#include <thread>
+
+using namespace GuitarDiagnostics::Util;
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero)
+{
+    LatencyHistogram histogram;
+
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0u);
+    EXPECT_EQ(histogram.GetMin(), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0u);
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), 0.0);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact)
+{
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 20; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    EXPECT_EQ(histogram.GetCount(), 20u);
+    EXPECT_EQ(histogram.GetMin(), 1u);
+    EXPECT_EQ(histogram.GetMax(), 20u);
+    EXPECT_EQ(histogram.GetPercentile(50.0), 10u);
+    EXPECT_EQ(histogram.GetPercentile(100.0), 20u);
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), 10.5);
+}
+
+TEST(LatencyHistogramTest, PercentilesWithinRelativeResolution)
+{
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100000; ++value)
+    {
+        histogram.Record(value * 100);
+    }
+
+    const struct
+    {
+        double percentile;
+        double expected;
+    } checks[] = { { 50.0, 5.0e6 }, { 99.0, 9.9e6 }, { 99.9, 9.99e6 } };
+
+    for (const auto &check : checks)
+    {
+        const auto value = static_cast<double>(histogram.GetPercentile(check.percentile));
+        EXPECT_NEAR(value, check.expected, check.expected * 0.035) << "p" << check.percentile;
+    }
+}
+
+TEST(LatencyHistogramTest, WeightedRecordAndMerge)
+{
+    LatencyHistogram first;
+    LatencyHistogram second;
+
+    first.Record(1000, 99);
+    second.Record(1000000, 1);
+    first.Merge(second);
+
+    EXPECT_EQ(first.GetCount(), 100u);
+    EXPECT_LE(first.GetPercentile(99.0), 1031u);
+    EXPECT_EQ(first.GetPercentile(100.0), 1000000u);
+    EXPECT_EQ(first.GetMax(), 1000000u);
+    EXPECT_EQ(first.GetMin(), 1000u);
+}
+
+TEST(LatencyHistogramTest, HugeValuesClampToLastBucket)
+{
+    LatencyHistogram histogram;
+    histogram.Record(UINT64_C(1) << 62);
+
+    EXPECT_EQ(histogram.GetCount(), 1u);
+    EXPECT_EQ(histogram.GetPercentile(50.0), UINT64_C(1) << 62);
+}
+
+TEST(LatencyHistogramTest, ResetClearsSamples)
+{
+    LatencyHistogram histogram;
+    histogram.Record(500, 10);
+    histogram.Reset();
+
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(99.0), 0u);
+}
+
+TEST(LatencyHistogramTest, ConcurrentReaderSeesMonotonicCount)
+{
+    LatencyHistogram histogram;
+
+    std::thread writer([&histogram]() {
+        for (uint64_t i = 0; i < 200000; ++i)
+        {
+            histogram.Record(i % 5000);
+        }
+    });
+
+    uint64_t previous = 0;
+    while (previous < 200000)
+    {
+        const uint64_t current = histogram.GetCount();
+        ASSERT_GE(current, previous);
+        histogram.GetPercentile(99.0);
+        previous = current;
+    }
+
+    writer.join();
+    EXPECT_EQ(histogram.GetCount(), 200000u);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "Util/MinMaxPyramid.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace GuitarDiagnostics::Util;
+
+TEST(MinMaxPyramidTest, EmptyHistoryReadsAsSilence)
+{
+    MinMaxPyramid pyramid(4, 4, 3, 16);
+    std::array<float, 8> minimums;
+    std::array<float, 8> maximums;
+    minimums.fill(1.0f);
+    maximums.fill(1.0f);
+
+    EXPECT_EQ(pyramid.GetEnvelope(64, minimums, maximums), 8u);
+    for (size_t i = 0; i < minimums.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(minimums[i], 0.0f);
+        EXPECT_FLOAT_EQ(maximums[i], 0.0f);
+    }
+}
+
+TEST(MinMaxPyramidTest, ColumnsMatchBruteForceMinMax)
+{
+    MinMaxPyramid pyramid(4, 4, 3, 64);
+    std::vector<float> samples(256);
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        samples[i] = static_cast<float>((i * 37) % 101) / 50.0f - 1.0f;
+    }
+    pyramid.Push(samples);
+
+    // 256 samples over 4 columns selects 64-sample bins at level 2 (4 * 4 * 4).
+    std::array<float, 4> minimums;
+    std::array<float, 4> maximums;
+    ASSERT_EQ(pyramid.SelectLevel(256, 4), 2u);
+    pyramid.GetEnvelope(256, minimums, maximums);
+
+    for (size_t column = 0; column < 4; ++column)
+    {
+        float expectedMin = samples[column * 64];
+        float expectedMax = samples[column * 64];
+        for (size_t i = column * 64; i < (column + 1) * 64; ++i)
+        {
+            expectedMin = std::min(expectedMin, samples[i]);
+            expectedMax = std::max(expectedMax, samples[i]);
+        }
+        EXPECT_FLOAT_EQ(minimums[column], expectedMin);
+        EXPECT_FLOAT_EQ(maximums[column], expectedMax);
+    }
+}
+
+TEST(MinMaxPyramidTest, NewestColumnIncludesPartialBin)
+{
+    MinMaxPyramid pyramid(4, 4, 2, 16);
+    const std::array<float, 6> samples = { 0.1f, 0.2f, 0.1f, 0.2f, -0.9f, 0.7f };
+    pyramid.Push(samples);
+
+    std::array<float, 2> minimums;
+    std::array<float, 2> maximums;
+    pyramid.GetEnvelope(8, minimums, maximums);
+
+    EXPECT_FLOAT_EQ(minimums[0], 0.1f);
+    EXPECT_FLOAT_EQ(maximums[0], 0.2f);
+    EXPECT_FLOAT_EQ(minimums[1], -0.9f);
+    EXPECT_FLOAT_EQ(maximums[1], 0.7f);
+}
+
+TEST(MinMaxPyramidTest, LongSpansUseCoarseLevels)
+{
+    MinMaxPyramid pyramid(4, 4, 4, 32);
+
+    // Levels cover 128, 512, 2048 and 8192 samples; an old spike survives only on the coarsest.
+    std::vector<float> block(1024, 0.0f);
+    block[0] = 1.0f;
+    pyramid.Push(block);
+    block[0] = 0.0f;
+    for (int i = 0; i < 3; ++i)
+    {
+        pyramid.Push(block);
+    }
+
+    EXPECT_EQ(pyramid.GetSampleCount(), 4096u);
+    EXPECT_EQ(pyramid.GetHistoryCapacity(), 8192u);
+    EXPECT_EQ(pyramid.SelectLevel(4096, 1024), 3u);
+
+    std::array<float, 16> minimums;
+    std::array<float, 16> maximums;
+    pyramid.GetEnvelope(4096, minimums, maximums);
+    EXPECT_FLOAT_EQ(maximums[0], 1.0f);
+    for (size_t column = 1; column < maximums.size(); ++column)
+    {
+        EXPECT_FLOAT_EQ(maximums[column], 0.0f);
+    }
+}
+
+TEST(MinMaxPyramidTest, ResetClearsHistory)
+{
+    MinMaxPyramid pyramid(2, 2, 2, 8);
+    const std::array<float, 4> samples = { 0.5f, -0.5f, 0.5f, -0.5f };
+    pyramid.Push(samples);
+    pyramid.Reset();
+
+    std::array<float, 2> minimums;
+    std::array<float, 2> maximums;
+    pyramid.GetEnvelope(4, minimums, maximums);
+
+    EXPECT_EQ(pyramid.GetSampleCount(), 0u);
+    EXPECT_FLOAT_EQ(minimums[0], 0.0f);
+    EXPECT_FLOAT_EQ(maximums[1], 0.0f);
+}
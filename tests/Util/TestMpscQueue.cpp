@@ -0,0 +1,112 @@
+#include "Util/MpscQueue.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using GuitarDiagnostics::Util::MpscQueue;
+
+TEST(MpscQueueTest, CapacityRoundsUpToPowerOfTwo)
+{
+    EXPECT_EQ(MpscQueue<int>(0).GetCapacity(), 2u);
+    EXPECT_EQ(MpscQueue<int>(8).GetCapacity(), 8u);
+    EXPECT_EQ(MpscQueue<int>(9).GetCapacity(), 16u);
+}
+
+TEST(MpscQueueTest, PopsInPushOrder)
+{
+    MpscQueue<int> queue(4);
+    EXPECT_TRUE(queue.IsEmpty());
+
+    int value = 0;
+    EXPECT_FALSE(queue.TryPop(value));
+
+    // Several laps around the slots.
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(queue.TryPush(lap * 10 + i));
+        }
+        EXPECT_FALSE(queue.IsEmpty());
+        for (int i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(queue.TryPop(value));
+            EXPECT_EQ(value, lap * 10 + i);
+        }
+        EXPECT_TRUE(queue.IsEmpty());
+    }
+}
+
+TEST(MpscQueueTest, RejectsPushWhenFullAndKeepsValue)
+{
+    MpscQueue<std::unique_ptr<int>> queue(2);
+    ASSERT_TRUE(queue.TryPush(std::make_unique<int>(1)));
+    ASSERT_TRUE(queue.TryPush(std::make_unique<int>(2)));
+
+    auto rejected = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.TryPush(std::move(rejected)));
+    ASSERT_NE(rejected, nullptr);
+    EXPECT_EQ(*rejected, 3);
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(*value, 1);
+    EXPECT_TRUE(queue.TryPush(std::move(rejected)));
+}
+
+TEST(MpscQueueTest, ConcurrentProducersDeliverEverythingOnce)
+{
+    constexpr int producerCount = 4;
+    constexpr int perProducer = 20000;
+    MpscQueue<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producerCount; ++producer)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (int i = 0; i < perProducer; ++i)
+            {
+                while (!queue.TryPush(producer * perProducer + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Every value arrives exactly once, and each producer's values arrive in order.
+    std::vector<int> lastSeen(producerCount, -1);
+    std::vector<int> received(producerCount, 0);
+    bool inOrder = true;
+    int total = 0;
+    while (total < producerCount * perProducer)
+    {
+        int value = 0;
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const int producer = value / perProducer;
+        const int index = value % perProducer;
+        inOrder = inOrder && index > lastSeen[producer];
+        lastSeen[producer] = index;
+        ++received[producer];
+        ++total;
+    }
+
+    for (auto &thread : producers)
+    {
+        thread.join();
+    }
+
+    EXPECT_TRUE(inOrder);
+    for (int producer = 0; producer < producerCount; ++producer)
+    {
+        EXPECT_EQ(received[producer], perProducer);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
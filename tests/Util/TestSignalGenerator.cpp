@@ -0,0 +1,325 @@
+#include <gtest/gtest.h>
+
+#include "Util/SignalGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    constexpr float g_kSampleRate = 48000.0f;
+
+    float ComputeRMS(const float *data, size_t count)
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            sum += data[i] * data[i];
+        }
+        return std::sqrt(sum / static_cast<float>(count));
+    }
+
+    float MagnitudeAt(const std::vector<float> &signal, float frequency, float sampleRate)
+    {
+        // Single-bin Goertzel-style projection with a Hann window.
+        const float twoPi = 2.0f * std::numbers::pi_v<float>;
+        const size_t n = signal.size();
+        double re = 0.0;
+        double im = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float window = 0.5f - 0.5f * std::cos(twoPi * static_cast<float>(i) / static_cast<float>(n - 1));
+            const double phase = 2.0 * std::numbers::pi * frequency * static_cast<double>(i) / sampleRate;
+            re += window * signal[i] * std::cos(phase);
+            im += window * signal[i] * std::sin(phase);
+        }
+        return static_cast<float>(std::sqrt(re * re + im * im) / static_cast<double>(n));
+    }
+
+    float HighPassEnergy(const std::vector<float> &signal)
+    {
+        float energy = 0.0f;
+        for (size_t i = 1; i < signal.size(); ++i)
+        {
+            const float diff = signal[i] - signal[i - 1];
+            energy += diff * diff;
+        }
+        return energy;
+    }
+
+    float EstimateFrequency(const std::vector<float> &signal, size_t start, float sampleRate)
+    {
+        // Average period between positive-going zero crossings (linearly interpolated).
+        float first = -1.0f;
+        float last = -1.0f;
+        size_t crossings = 0;
+        for (size_t i = start + 1; i < signal.size(); ++i)
+        {
+            if (signal[i - 1] < 0.0f && signal[i] >= 0.0f)
+            {
+                const float position =
+                    static_cast<float>(i - 1) + signal[i - 1] / (signal[i - 1] - signal[i]);
+                if (first < 0.0f)
+                {
+                    first = position;
+                }
+                last = position;
+                ++crossings;
+            }
+        }
+        if (crossings < 2)
+        {
+            return 0.0f;
+        }
+        return sampleRate * static_cast<float>(crossings - 1) / (last - first);
+    }
+
+    float EstimatePeriodicity(const std::vector<float> &signal, float minFrequency, float maxFrequency, float sampleRate)
+    {
+        // Autocorrelation peak with parabolic interpolation; robust to rich harmonic content.
+        const size_t minLag = static_cast<size_t>(sampleRate / maxFrequency);
+        const size_t maxLag = static_cast<size_t>(sampleRate / minFrequency) + 1;
+        const size_t window = signal.size() - maxLag - 1;
+
+        std::vector<float> correlation(maxLag + 2, 0.0f);
+        for (size_t lag = minLag - 1; lag <= maxLag + 1; ++lag)
+        {
+            for (size_t i = 0; i < window; ++i)
+            {
+                correlation[lag] += signal[i] * signal[i + lag];
+            }
+        }
+
+        size_t best = minLag;
+        for (size_t lag = minLag; lag <= maxLag; ++lag)
+        {
+            if (correlation[lag] > correlation[best])
+            {
+                best = lag;
+            }
+        }
+
+        const float left = correlation[best - 1];
+        const float centre = correlation[best];
+        const float right = correlation[best + 1];
+        const float offset = 0.5f * (left - right) / (left - 2.0f * centre + right);
+        return sampleRate / (static_cast<float>(best) + offset);
+    }
+
+} // namespace
+
+TEST(SignalGeneratorTest, GenerateSineMatchesAnalyticSine)
+{
+    auto signal = GenerateSine(440.0f, g_kSampleRate, 4800, 0.5f);
+    ASSERT_EQ(signal.size(), 4800u);
+
+    for (size_t i = 0; i < signal.size(); i += 97)
+    {
+        const double expected = 0.5 * std::sin(2.0 * std::numbers::pi * 440.0 * static_cast<double>(i) / 48000.0);
+        EXPECT_NEAR(signal[i], expected, 1e-3);
+    }
+}
+
+TEST(SignalGeneratorTest, HarmonicToneIsNormalized)
+{
+    auto signal = GenerateHarmonicTone(110.0f, g_kSampleRate, 9600, 5);
+    const float peak = *std::max_element(signal.begin(), signal.end());
+    EXPECT_FLOAT_EQ(peak, 1.0f);
+
+    const float fundamental = MagnitudeAt(signal, 110.0f, g_kSampleRate);
+    const float third = MagnitudeAt(signal, 330.0f, g_kSampleRate);
+    EXPECT_NEAR(third / fundamental, 1.0f / 3.0f, 0.02f);
+}
+
+TEST(SignalGeneratorTest, WhiteNoiseIsDeterministicAndBounded)
+{
+    auto first = GenerateWhiteNoise(1024, 0.2f, 7);
+    auto second = GenerateWhiteNoise(1024, 0.2f, 7);
+    EXPECT_EQ(first, second);
+
+    for (float sample : first)
+    {
+        EXPECT_LE(std::abs(sample), 0.2f);
+    }
+}
+
+TEST(SignalGeneratorTest, StringPartialsFollowInharmonicity)
+{
+    StringModelConfig config;
+    config.fundamental = 110.0f;
+    config.inharmonicity = 1e-3f;
+    config.decayRate = 0.0f;
+    config.decayPerPartial = 0.0f;
+    config.pluckPosition = 0.2f;
+
+    auto signal = GeneratePluckedString(config, g_kSampleRate, 48000);
+
+    const float n = 8.0f;
+    const float stretched = n * 110.0f * std::sqrt(1.0f + 1e-3f * n * n);
+    const float harmonic = n * 110.0f;
+
+    EXPECT_GT(MagnitudeAt(signal, stretched, g_kSampleRate), 5.0f * MagnitudeAt(signal, harmonic, g_kSampleRate));
+}
+
+TEST(SignalGeneratorTest, StringDecaysOverTime)
+{
+    StringModelConfig config;
+    config.decayRate = 3.0f;
+
+    auto signal = GeneratePluckedString(config, g_kSampleRate, 48000);
+
+    const float early = ComputeRMS(signal.data(), 4800);
+    const float late = ComputeRMS(signal.data() + 43200, 4800);
+    EXPECT_GT(early, 0.05f);
+    EXPECT_LT(late, early * 0.2f);
+}
+
+TEST(SignalGeneratorTest, MatchesExactSynthesisOverLongRender)
+{
+    StringModelConfig config;
+    config.numPartials = 3;
+    config.inharmonicity = 0.0f;
+    config.decayRate = 0.5f;
+    config.decayPerPartial = 0.0f;
+    config.pluckPosition = 0.5f;
+
+    auto signal = GeneratePluckedString(config, g_kSampleRate, 96000);
+
+    // With pluckPosition 0.5 only odd partials survive: amplitude * (sin(n*pi/2) / n).
+    for (size_t i = 0; i < signal.size(); i += 1013)
+    {
+        const double t = static_cast<double>(i) / 48000.0;
+        const double envelope = 0.5 * std::exp(-0.5 * t);
+        const double expected = envelope * (std::sin(2.0 * std::numbers::pi * 110.0 * t)
+                                            - std::sin(2.0 * std::numbers::pi * 330.0 * t) / 3.0);
+        EXPECT_NEAR(signal[i], expected, 1e-3);
+    }
+}
+
+TEST(SignalGeneratorTest, ZeroPluckPositionGivesInverseHarmonicAmplitudes)
+{
+    StringModelConfig config;
+    config.numPartials = 3;
+    config.inharmonicity = 0.0f;
+    config.amplitude = 1.0f;
+    config.decayRate = 2.0f;
+    config.decayPerPartial = 0.0f;
+    config.pluckPosition = 0.0f;
+
+    auto signal = GeneratePluckedString(config, g_kSampleRate, 24000);
+
+    for (size_t i = 0; i < signal.size(); i += 1013)
+    {
+        const double t = static_cast<double>(i) / 48000.0;
+        double expected = 0.0;
+        for (int n = 1; n <= 3; ++n)
+        {
+            expected += std::sin(2.0 * std::numbers::pi * 110.0 * n * t) / n;
+        }
+        EXPECT_NEAR(signal[i], std::exp(-2.0 * t) * expected, 1e-3);
+    }
+}
+
+TEST(SignalGeneratorTest, RendersIndependentPlanarChannels)
+{
+    SignalGenerator generator(g_kSampleRate, 3, 8);
+
+    StringModelConfig config;
+    config.numPartials = 1;
+    config.decayRate = 0.0f;
+    config.decayPerPartial = 0.0f;
+
+    config.fundamental = 110.0f;
+    generator.SetString(0, config);
+    config.fundamental = 220.0f;
+    generator.SetString(1, config);
+
+    const size_t frames = 9600;
+    std::vector<float> output(frames * generator.GetNumChannels(), 1.0f);
+    generator.Render(std::span<float>(output).first(output.size() / 2));
+    generator.Render(std::span<float>(output).last(output.size() / 2));
+
+    // The two halves are rendered as separate calls, so reassemble each channel.
+    std::vector<float> channel0;
+    std::vector<float> channel1;
+    std::vector<float> channel2;
+    const size_t half = frames / 2;
+    for (size_t block = 0; block < 2; ++block)
+    {
+        const float *base = output.data() + block * half * 3;
+        channel0.insert(channel0.end(), base, base + half);
+        channel1.insert(channel1.end(), base + half, base + 2 * half);
+        channel2.insert(channel2.end(), base + 2 * half, base + 3 * half);
+    }
+
+    EXPECT_NEAR(EstimateFrequency(channel0, 0, g_kSampleRate), 110.0f, 0.5f);
+    EXPECT_NEAR(EstimateFrequency(channel1, 0, g_kSampleRate), 220.0f, 0.5f);
+    EXPECT_FLOAT_EQ(ComputeRMS(channel2.data(), channel2.size()), 0.0f);
+}
+
+TEST(SignalGeneratorTest, BuzzAddsHighFrequencyEnergy)
+{
+    StringModelConfig config;
+
+    BuzzConfig buzz;
+    buzz.amplitude = 0.2f;
+
+    auto clean = GeneratePluckedString(config, g_kSampleRate, 9600);
+    auto buzzing = GeneratePluckedString(config, g_kSampleRate, 9600, buzz);
+
+    EXPECT_GT(HighPassEnergy(buzzing), 4.0f * HighPassEnergy(clean));
+}
+
+TEST(SignalGeneratorTest, PluckRestartsEnvelope)
+{
+    SignalGenerator generator(g_kSampleRate, 1, 16);
+
+    StringModelConfig config;
+    config.decayRate = 5.0f;
+    generator.SetString(0, config);
+
+    std::vector<float> first(4800);
+    generator.Render(first);
+
+    std::vector<float> decayed(48000);
+    generator.Render(decayed);
+
+    generator.Pluck(0);
+    std::vector<float> second(4800);
+    generator.Render(second);
+
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        EXPECT_NEAR(first[i], second[i], 1e-4f);
+    }
+}
+
+TEST(SignalGeneratorTest, KarplusStrongIsTunedToFrequency)
+{
+    KarplusStrongString string(g_kSampleRate, 196.0f, 0.996f, 0.0f);
+    string.Pluck(0.5f, 1);
+
+    std::vector<float> signal(9600);
+    string.Render(signal);
+
+    EXPECT_NEAR(EstimatePeriodicity(signal, 150.0f, 250.0f, g_kSampleRate), 196.0f, 1.0f);
+}
+
+TEST(SignalGeneratorTest, KarplusStrongDecays)
+{
+    KarplusStrongString string(g_kSampleRate, 110.0f, 0.99f, 0.3f);
+    string.Pluck(0.5f, 3);
+
+    std::vector<float> signal(48000);
+    string.Render(signal);
+
+    const float early = ComputeRMS(signal.data(), 4800);
+    const float late = ComputeRMS(signal.data() + 43200, 4800);
+    EXPECT_GT(early, 0.01f);
+    EXPECT_LT(late, early);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "Util/StaticVector.h"
+
+#include <cstdint>
+#include <numeric>
+
+using namespace GuitarDiagnostics::Util;
+
+TEST(StaticVectorTest, StartsEmpty)
+{
+    StaticVector<float, 8> vector;
+
+    EXPECT_TRUE(vector.IsEmpty());
+    EXPECT_FALSE(vector.IsFull());
+    EXPECT_EQ(vector.GetSize(), 0u);
+    EXPECT_EQ(vector.GetCapacity(), 8u);
+    EXPECT_TRUE(vector.AsSpan().empty());
+}
+
+TEST(StaticVectorTest, PushBackStopsAtCapacity)
+{
+    StaticVector<int, 3> vector;
+
+    EXPECT_TRUE(vector.PushBack(1));
+    EXPECT_TRUE(vector.PushBack(2));
+    EXPECT_TRUE(vector.PushBack(3));
+    EXPECT_TRUE(vector.IsFull());
+    EXPECT_FALSE(vector.PushBack(4));
+
+    ASSERT_EQ(vector.GetSize(), 3u);
+    EXPECT_EQ(vector[0], 1);
+    EXPECT_EQ(vector[2], 3);
+    EXPECT_EQ(std::accumulate(vector.begin(), vector.end(), 0), 6);
+}
+
+TEST(StaticVectorTest, ResizeValueInitializesNewElements)
+{
+    StaticVector<float, 4> vector;
+    vector.PushBack(5.0f);
+    vector.PushBack(6.0f);
+    vector.Clear();
+
+    EXPECT_TRUE(vector.Resize(3));
+    ASSERT_EQ(vector.GetSize(), 3u);
+    EXPECT_FLOAT_EQ(vector[0], 0.0f);
+    EXPECT_FLOAT_EQ(vector[1], 0.0f);
+    EXPECT_FLOAT_EQ(vector[2], 0.0f);
+
+    EXPECT_FALSE(vector.Resize(5));
+    EXPECT_EQ(vector.GetSize(), 3u);
+}
+
+TEST(StaticVectorTest, StorageIsInlineAndCacheLineAligned)
+{
+    using Frame = StaticVector<float, 32>;
+    static_assert(alignof(Frame) == Frame::g_kAlignment);
+
+    Frame frames[2];
+    frames[1].PushBack(1.0f);
+
+    for (const Frame &frame : frames)
+    {
+        const auto address = reinterpret_cast<uintptr_t>(frame.begin());
+        EXPECT_EQ(address % Frame::g_kAlignment, 0u);
+        EXPECT_GE(address, reinterpret_cast<uintptr_t>(&frame));
+        EXPECT_LT(address, reinterpret_cast<uintptr_t>(&frame) + sizeof(Frame));
+    }
+}
+
+TEST(StaticVectorTest, CopiesAreIndependent)
+{
+    StaticVector<float, 4> original;
+    original.PushBack(1.0f);
+
+    StaticVector<float, 4> copy = original;
+    copy.PushBack(2.0f);
+    copy[0] = 3.0f;
+
+    ASSERT_EQ(original.GetSize(), 1u);
+    EXPECT_FLOAT_EQ(original[0], 1.0f);
+    EXPECT_EQ(copy.GetSize(), 2u);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "Util/Tracer.h"
+
+#include <algorithm>
+#include <latch>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GuitarDiagnostics::Util;
+
+namespace
+{
+
+    size_t CountOccurrences(const std::string &text, const std::string &pattern)
+    {
+        size_t count = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    std::string Export()
+    {
+        std::ostringstream stream;
+        Tracer::Get().WriteChromeTrace(stream);
+        return stream.str();
+    }
+
+} // namespace
+
+TEST(TracerTest, SpansOutsideRecordingAreIgnored)
+{
+    auto &tracer = Tracer::Get();
+    tracer.Start();
+    tracer.Stop();
+
+    {
+        TraceScope scope("test", "Ignored");
+    }
+
+    EXPECT_FALSE(tracer.IsRecording());
+    EXPECT_EQ(tracer.GetEventCount(), 0u);
+    EXPECT_EQ(Export().find("Ignored"), std::string::npos);
+}
+
+TEST(TracerTest, RecordsNestedSpansAsCompleteEvents)
+{
+    auto &tracer = Tracer::Get();
+    tracer.Start();
+
+    {
+        TraceScope outer("engine", "Hop");
+        TraceScope inner("Fret Buzz", "FFT");
+    }
+
+    tracer.Stop();
+    ASSERT_EQ(tracer.GetEventCount(), 2u);
+
+    const std::string json = Export();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"X\""), 2u);
+    EXPECT_NE(json.find("\"name\":\"Hop\",\"cat\":\"engine\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"FFT\",\"cat\":\"Fret Buzz\""), std::string::npos);
+}
+
+TEST(TracerTest, StartDiscardsPreviousTrace)
+{
+    auto &tracer = Tracer::Get();
+    tracer.Start();
+    {
+        TraceScope scope("test", "First");
+    }
+
+    tracer.Start();
+    {
+        TraceScope scope("test", "Second");
+    }
+    tracer.Stop();
+
+    const std::string json = Export();
+    EXPECT_EQ(tracer.GetEventCount(), 1u);
+    EXPECT_EQ(json.find("\"First\""), std::string::npos);
+    EXPECT_NE(json.find("\"Second\""), std::string::npos);
+}
+
+TEST(TracerTest, ThreadsRecordIntoSeparateNamedTracks)
+{
+    auto &tracer = Tracer::Get();
+    tracer.Start();
+
+    auto work = [](const char *threadName) {
+        GD_TRACE_THREAD_NAME(threadName);
+        for (int i = 0; i < 100; ++i)
+        {
+            GD_TRACE_SCOPE("test", "Work");
+        }
+    };
+
+    std::thread first(work, "Producer");
+    std::thread second(work, "Consumer");
+    first.join();
+    second.join();
+    tracer.Stop();
+
+    const std::string json = Export();
+    EXPECT_EQ(tracer.GetEventCount(), 200u);
+    EXPECT_EQ(tracer.GetDroppedCount(), 0u);
+    EXPECT_EQ(CountOccurrences(json, "\"thread_name\""), 2u);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"Producer\"}"), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"Consumer\"}"), std::string::npos);
+}
+
+TEST(TracerTest, EveryCoreAndTheAudioAndUiThreadsGetTracks)
+{
+    auto &tracer = Tracer::Get();
+    const size_t threadCount = std::max(1u, std::thread::hardware_concurrency()) + 2;
+    ASSERT_GE(tracer.GetThreadCapacity(), threadCount + 1);
+    tracer.Start();
+
+    // All threads record while the others are alive, as analysis and audio callback threads do.
+    std::latch recorded(static_cast<std::ptrdiff_t>(threadCount));
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&recorded]() {
+            {
+                GD_TRACE_SCOPE("test", "Work");
+            }
+            recorded.arrive_and_wait();
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    tracer.Stop();
+
+    EXPECT_EQ(tracer.GetEventCount(), threadCount);
+    EXPECT_EQ(tracer.GetDroppedCount(), 0u);
+}